@@ -284,7 +284,11 @@ enum LIBVSGPT_RUNTIME_ERROR
 
 	/* An abort was requested
 	 */
-	LIBVSGPT_RUNTIME_ERROR_ABORT_REQUESTED		= 15
+	LIBVSGPT_RUNTIME_ERROR_ABORT_REQUESTED		= 15,
+
+	/* The operation exceeded its deadline
+	 */
+	LIBVSGPT_RUNTIME_ERROR_TIMED_OUT		= 16
 };
 
 #endif /* !defined( _LIBVSGPT_ERROR_H ) */
@@ -170,6 +170,46 @@ int libvsgpt_boot_record_free(
 	return( result );
 }
 
+/* Checks if data contains a boot record signature
+ * Returns 1 if the signature matches, 0 if not or -1 on error
+ */
+int libvsgpt_boot_record_check_signature(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_boot_record_check_signature";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sizeof( vsgpt_boot_record_classical_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( (vsgpt_boot_record_classical_t *) data )->boot_signature[ 0 ] != 0x55 )
+	 || ( ( (vsgpt_boot_record_classical_t *) data )->boot_signature[ 1 ] != 0xaa ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Reads a boot record
  * Returns 1 if successful or -1 on error
  */
@@ -218,6 +258,22 @@ int libvsgpt_boot_record_read_data(
 
 		return( -1 );
 	}
+	/* The boot record can be reused to read multiple records
+	 */
+	if( libcdata_array_empty(
+	     boot_record->partition_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsgpt_mbr_partition_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty partition entries array.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -55,6 +55,11 @@ int libvsgpt_boot_record_free(
      libvsgpt_boot_record_t **boot_record,
      libcerror_error_t **error );
 
+int libvsgpt_boot_record_check_signature(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libvsgpt_boot_record_read_data(
      libvsgpt_boot_record_t *boot_record,
      const uint8_t *data,
@@ -64,6 +64,12 @@ int libvsgpt_error_backtrace_sprint(
      char *string,
      size_t size );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_error_matches(
+     libvsgpt_error_t *error,
+     int error_domain,
+     int error_code );
+
 #endif /* !defined( HAVE_LOCAL_LIBVSGPT ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,914 @@
+/*
+ * The partition table header scan functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libvsgpt_checksum.h"
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_header_scan.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+
+#include "vsgpt_partition_table.h"
+
+/* Searches data for the partition table header signature: "EFI PART"
+ * The search for the first byte of the signature is done with memchr,
+ * which the C runtime provides as a vectorized implementation
+ * Returns 1 if found, 0 if not
+ */
+int libvsgpt_header_scan_search_signature(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *signature_offset )
+{
+	const uint8_t *data_end       = NULL;
+	const uint8_t *search_data    = NULL;
+	const uint8_t *signature_data = NULL;
+
+	if( ( data == NULL )
+	 || ( data_size < 8 )
+	 || ( signature_offset == NULL ) )
+	{
+		return( 0 );
+	}
+	search_data = data;
+	data_end    = &( data[ data_size - 7 ] );
+
+	while( search_data < data_end )
+	{
+		signature_data = (const uint8_t *) memchr(
+		                                    (void *) search_data,
+		                                    (int) 'E',
+		                                    (size_t) ( data_end - search_data ) );
+
+		if( signature_data == NULL )
+		{
+			break;
+		}
+		if( memory_compare(
+		     signature_data,
+		     "EFI PART",
+		     8 ) == 0 )
+		{
+			*signature_offset = (size_t) ( signature_data - data );
+
+			return( 1 );
+		}
+		search_data = &( signature_data[ 1 ] );
+	}
+	return( 0 );
+}
+
+/* Validates partition table header data that was found by a scan
+ * Unlike when opening a volume the header is only considered valid if
+ * the stored checksum matches the calculated checksum
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libvsgpt_header_scan_validate_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *header_block_number,
+     uint8_t *disk_identifier,
+     size_t disk_identifier_size,
+     libcerror_error_t **error )
+{
+	uint8_t empty_checksum_data[ 4 ]  = { 0, 0, 0, 0 };
+
+	static char *function             = "libvsgpt_header_scan_validate_header";
+	uint64_t safe_header_block_number = 0;
+	uint32_t calculated_checksum      = 0;
+	uint32_t header_data_size         = 0;
+	uint32_t stored_checksum          = 0;
+	uint16_t major_format_version     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( disk_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( disk_identifier_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid disk identifier size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( vsgpt_partition_table_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (vsgpt_partition_table_header_t *) data )->signature,
+	     "EFI PART",
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (vsgpt_partition_table_header_t *) data )->major_format_version,
+	 major_format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (vsgpt_partition_table_header_t *) data )->header_data_size,
+	 header_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (vsgpt_partition_table_header_t *) data )->header_data_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (vsgpt_partition_table_header_t *) data )->header_block_number,
+	 safe_header_block_number );
+
+	if( ( major_format_version != 1 )
+	 || ( header_data_size < sizeof( vsgpt_partition_table_header_t ) )
+	 || ( header_data_size > LIBVSGPT_HEADER_SCAN_MAXIMUM_HEADER_DATA_SIZE )
+	 || ( (size_t) header_data_size > data_size )
+	 || ( safe_header_block_number == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libvsgpt_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     data,
+	     16,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     empty_checksum_data,
+	     4,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     &( data[ 20 ] ),
+	     header_data_size - 20,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     disk_identifier,
+	     ( (vsgpt_partition_table_header_t *) data )->disk_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy disk identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*header_block_number = safe_header_block_number;
+
+	return( 1 );
+}
+
+/* Determines the sector size implied by the offset of a partition table header
+ * and the block number stored in the header
+ * Returns 1 if successful or 0 if the offset does not match a supported sector size
+ */
+int libvsgpt_header_scan_get_sector_size(
+     off64_t offset,
+     uint64_t header_block_number,
+     uint32_t *sector_size )
+{
+	uint32_t safe_sector_size = 0;
+
+	if( ( offset <= 0 )
+	 || ( header_block_number == 0 )
+	 || ( sector_size == NULL ) )
+	{
+		return( 0 );
+	}
+	for( safe_sector_size = 512;
+	     safe_sector_size <= 4096;
+	     safe_sector_size *= 2 )
+	{
+		if( ( ( (uint64_t) offset % safe_sector_size ) == 0 )
+		 && ( ( (uint64_t) offset / safe_sector_size ) == header_block_number ) )
+		{
+			*sector_size = safe_sector_size;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Scans a file for partition table headers
+ * The callback is called for every header with a valid checksum with its offset,
+ * the header block number, the implied sector size or 0 if the offset does not
+ * match a supported sector size and the disk identifier, which consists of 16 bytes
+ * The callback should return 1 to continue, 0 to stop the scan or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_scan_for_headers(
+     const char *filename,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsgpt_scan_for_headers";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_scan_for_headers_file_io_handle(
+	     file_io_handle,
+	     0,
+	     0,
+	     callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan for partition table headers using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Scans a file for partition table headers
+ * The callback is called for every header with a valid checksum with its offset,
+ * the header block number, the implied sector size or 0 if the offset does not
+ * match a supported sector size and the disk identifier, which consists of 16 bytes
+ * The callback should return 1 to continue, 0 to stop the scan or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_scan_for_headers_wide(
+     const wchar_t *filename,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsgpt_scan_for_headers_wide";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_scan_for_headers_file_io_handle(
+	     file_io_handle,
+	     0,
+	     0,
+	     callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan for partition table headers using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Scans a range of a file for partition table headers using a Basic File IO (bfio) handle
+ * Headers are reported if their signature starts within the range, a size of 0 scans
+ * up to the end of the file. The data is read sequentially in large buffers, where
+ * the last bytes of a buffer are kept so that headers that cross a buffer boundary are found
+ * The callback is called for every header with a valid checksum with its offset,
+ * the header block number, the implied sector size or 0 if the offset does not
+ * match a supported sector size and the disk identifier, which consists of 16 bytes
+ * The callback should return 1 to continue, 0 to stop the scan or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_scan_for_headers_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	uint8_t disk_identifier[ 16 ];
+
+	uint8_t *buffer              = NULL;
+	static char *function        = "libvsgpt_scan_for_headers_file_io_handle";
+	size64_t file_size           = 0;
+	size_t buffer_size           = 0;
+	size_t data_size             = 0;
+	size_t read_size             = 0;
+	size_t scan_offset           = 0;
+	size_t search_end_offset     = 0;
+	size_t search_size           = 0;
+	size_t signature_offset      = 0;
+	ssize_t read_count           = 0;
+	off64_t data_offset          = 0;
+	off64_t end_offset           = 0;
+	off64_t read_end_offset      = 0;
+	off64_t read_offset          = 0;
+	uint64_t header_block_number = 0;
+	uint32_t sector_size         = 0;
+	int file_io_handle_is_open   = 0;
+	int stop_scan                = 0;
+	int result                   = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	end_offset = (off64_t) file_size;
+
+	if( ( size != 0 )
+	 && ( size < ( file_size - (size64_t) start_offset ) ) )
+	{
+		end_offset = start_offset + (off64_t) size;
+	}
+	/* Data beyond the end of the range is read for headers that start within the range
+	 */
+	read_end_offset = end_offset + ( LIBVSGPT_HEADER_SCAN_MAXIMUM_HEADER_DATA_SIZE - 1 );
+
+	if( read_end_offset > (off64_t) file_size )
+	{
+		read_end_offset = (off64_t) file_size;
+	}
+	if( start_offset < end_offset )
+	{
+		buffer_size = LIBVSGPT_HEADER_SCAN_BUFFER_SIZE + LIBVSGPT_HEADER_SCAN_MAXIMUM_HEADER_DATA_SIZE;
+
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * buffer_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset = start_offset;
+		read_offset = start_offset;
+	}
+	while( start_offset < end_offset )
+	{
+		read_size = buffer_size - data_size;
+
+		if( (off64_t) read_size > ( read_end_offset - read_offset ) )
+		{
+			read_size = (size_t) ( read_end_offset - read_offset );
+		}
+		if( read_size > 0 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( buffer[ data_size ] ),
+			              read_size,
+			              read_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 read_offset,
+				 read_offset );
+
+				goto on_error;
+			}
+			read_offset += (off64_t) read_size;
+			data_size   += read_size;
+		}
+		/* Signatures that start after the search end offset are searched
+		 * in the next buffer, when all the data of their header is available
+		 */
+		if( read_offset >= read_end_offset )
+		{
+			search_end_offset = (size_t) ( end_offset - data_offset );
+		}
+		else
+		{
+			search_end_offset = data_size - ( LIBVSGPT_HEADER_SCAN_MAXIMUM_HEADER_DATA_SIZE - 1 );
+		}
+		scan_offset = 0;
+
+		while( scan_offset < search_end_offset )
+		{
+			search_size = search_end_offset - scan_offset + 7;
+
+			if( search_size > ( data_size - scan_offset ) )
+			{
+				search_size = data_size - scan_offset;
+			}
+			if( libvsgpt_header_scan_search_signature(
+			     &( buffer[ scan_offset ] ),
+			     search_size,
+			     &signature_offset ) != 1 )
+			{
+				break;
+			}
+			scan_offset += signature_offset;
+
+			result = libvsgpt_header_scan_validate_header(
+			          &( buffer[ scan_offset ] ),
+			          data_size - scan_offset,
+			          &header_block_number,
+			          disk_identifier,
+			          16,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to validate partition table header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_offset + (off64_t) scan_offset,
+				 data_offset + (off64_t) scan_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				sector_size = 0;
+
+				libvsgpt_header_scan_get_sector_size(
+				 data_offset + (off64_t) scan_offset,
+				 header_block_number,
+				 &sector_size );
+
+				result = callback(
+				          data_offset + (off64_t) scan_offset,
+				          header_block_number,
+				          sector_size,
+				          disk_identifier,
+				          user_data,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback failed for partition table header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 data_offset + (off64_t) scan_offset,
+					 data_offset + (off64_t) scan_offset );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					stop_scan = 1;
+
+					break;
+				}
+			}
+			/* The signature cannot overlap with itself
+			 */
+			scan_offset += 8;
+		}
+		if( ( stop_scan != 0 )
+		 || ( read_offset >= read_end_offset ) )
+		{
+			break;
+		}
+		/* Keep the data that was not searched for the next buffer
+		 */
+		data_size -= search_end_offset;
+
+		if( memory_copy(
+		     buffer,
+		     &( buffer[ search_end_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy remaining data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (off64_t) search_end_offset;
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * The partition table header scan functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBVSGPT_HEADER_SCAN_H )
+#define _LIBVSGPT_HEADER_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_extern.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libvsgpt_header_scan_search_signature(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *signature_offset );
+
+int libvsgpt_header_scan_validate_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *header_block_number,
+     uint8_t *disk_identifier,
+     size_t disk_identifier_size,
+     libcerror_error_t **error );
+
+int libvsgpt_header_scan_get_sector_size(
+     off64_t offset,
+     uint64_t header_block_number,
+     uint32_t *sector_size );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_scan_for_headers(
+     const char *filename,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSGPT_EXTERN \
+int libvsgpt_scan_for_headers_wide(
+     const wchar_t *filename,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSGPT_EXTERN \
+int libvsgpt_scan_for_headers_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     off64_t start_offset,
+     size64_t size,
+     int (*callback)(
+            off64_t offset,
+            uint64_t header_block_number,
+            uint32_t sector_size,
+            const uint8_t *disk_identifier,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_HEADER_SCAN_H ) */
+
@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libvsgpt_io_handle.h"
+#include "libvsgpt_io_trace.h"
 #include "libvsgpt_libcerror.h"
 
 /* Creates an IO handle
@@ -132,6 +133,7 @@ int libvsgpt_io_handle_free(
 }
 
 /* Clears the IO handle
+ * The timeout is retained since it is a setting of the volume
  * Returns 1 if successful or -1 on error
  */
 int libvsgpt_io_handle_clear(
@@ -139,6 +141,7 @@ int libvsgpt_io_handle_clear(
      libcerror_error_t **error )
 {
 	static char *function = "libvsgpt_io_handle_clear";
+	int64_t timeout       = 0;
 
 	if( io_handle == NULL )
 	{
@@ -151,6 +154,8 @@ int libvsgpt_io_handle_clear(
 
 		return( -1 );
 	}
+	timeout = io_handle->timeout;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -166,7 +171,70 @@ int libvsgpt_io_handle_clear(
 		return( -1 );
 	}
 	io_handle->bytes_per_sector = 512;
+	io_handle->timeout          = timeout;
+
+	return( 1 );
+}
+
+/* Determines the deadline of an operation that starts now
+ * Returns the deadline in microseconds or 0 if the operation has no deadline
+ */
+int64_t libvsgpt_io_handle_get_deadline(
+         libvsgpt_io_handle_t *io_handle )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->timeout <= 0 ) )
+	{
+		return( 0 );
+	}
+	return( libvsgpt_io_trace_get_current_time() + io_handle->timeout );
+}
+
+/* Checks if an operation can continue
+ * This function is intended to be called at chunk boundaries of long running operations
+ * Returns 1 if the operation can continue or -1 if abort was signalled or the deadline has passed
+ */
+int libvsgpt_io_handle_check_abort(
+     libvsgpt_io_handle_t *io_handle,
+     int64_t deadline,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_handle_check_abort";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
 
+		return( -1 );
+	}
+	if( ( deadline > 0 )
+	 && ( libvsgpt_io_trace_get_current_time() >= deadline ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBVSGPT_IO_HANDLE_RUNTIME_ERROR_TIMED_OUT,
+		 "%s: operation timed out.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -33,6 +33,11 @@
 extern "C" {
 #endif
 
+/* The runtime error code of an operation that exceeded its deadline
+ * libcerror does not define this code, it corresponds with LIBVSGPT_RUNTIME_ERROR_TIMED_OUT
+ */
+#define LIBVSGPT_IO_HANDLE_RUNTIME_ERROR_TIMED_OUT	16
+
 typedef struct libvsgpt_io_handle libvsgpt_io_handle_t;
 
 struct libvsgpt_io_handle
@@ -41,6 +46,10 @@ struct libvsgpt_io_handle
 	 */
 	size_t bytes_per_sector;
 
+	/* The timeout of an operation in microseconds, where 0 represents no timeout
+	 */
+	int64_t timeout;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -58,6 +67,14 @@ int libvsgpt_io_handle_clear(
      libvsgpt_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int64_t libvsgpt_io_handle_get_deadline(
+         libvsgpt_io_handle_t *io_handle );
+
+int libvsgpt_io_handle_check_abort(
+     libvsgpt_io_handle_t *io_handle,
+     int64_t deadline,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
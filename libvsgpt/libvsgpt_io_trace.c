@@ -0,0 +1,331 @@
+/*
+ * The IO trace functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_io_trace.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+
+/* Creates an IO trace
+ * Make sure the value io_trace is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_io_trace_initialize(
+     libvsgpt_io_trace_t **io_trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_trace_initialize";
+
+	if( io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_trace != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO trace value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_trace = memory_allocate_structure(
+	             libvsgpt_io_trace_t );
+
+	if( *io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_trace,
+	     0,
+	     sizeof( libvsgpt_io_trace_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO trace.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *io_trace != NULL )
+	{
+		memory_free(
+		 *io_trace );
+
+		*io_trace = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO trace
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_io_trace_free(
+     libvsgpt_io_trace_t **io_trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_trace_free";
+
+	if( io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_trace != NULL )
+	{
+		memory_free(
+		 *io_trace );
+
+		*io_trace = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the trace callback
+ * A trace callback of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_io_trace_set_callback(
+     libvsgpt_io_trace_t *io_trace,
+     void (*trace_callback)(
+            int event_type,
+            int phase,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_trace_set_callback";
+
+	if( io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO trace.",
+		 function );
+
+		return( -1 );
+	}
+	io_trace->trace_callback = trace_callback;
+	io_trace->user_data      = user_data;
+
+	return( 1 );
+}
+
+/* Starts a phase
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_io_trace_start_phase(
+     libvsgpt_io_trace_t *io_trace,
+     int phase,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_trace_start_phase";
+
+	if( io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_trace->trace_callback == NULL )
+	{
+		return( 1 );
+	}
+	io_trace->phase            = phase;
+	io_trace->phase_start_time = libvsgpt_io_trace_get_current_time();
+	io_trace->phase_read_size  = 0;
+
+	return( 1 );
+}
+
+/* Ends the current phase
+ * The trace callback is called with the duration of the phase and the number of bytes read
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_io_trace_end_phase(
+     libvsgpt_io_trace_t *io_trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_io_trace_end_phase";
+	int64_t duration      = 0;
+
+	if( io_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_trace->trace_callback == NULL )
+	{
+		return( 1 );
+	}
+	duration = libvsgpt_io_trace_get_current_time() - io_trace->phase_start_time;
+
+	if( duration < 0 )
+	{
+		duration = 0;
+	}
+	io_trace->trace_callback(
+	 LIBVSGPT_TRACE_EVENT_TYPE_PHASE,
+	 io_trace->phase,
+	 0,
+	 io_trace->phase_read_size,
+	 (uint64_t) duration,
+	 io_trace->user_data );
+
+	io_trace->phase           = 0;
+	io_trace->phase_read_size = 0;
+
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset from a file IO handle and traces the read
+ * The IO trace can be NULL, in which case the read is not traced
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_io_trace_read_buffer_at_offset(
+         libvsgpt_io_trace_t *io_trace,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	int64_t duration   = 0;
+	int64_t start_time = 0;
+	ssize_t read_count = 0;
+
+	if( ( io_trace == NULL )
+	 || ( io_trace->trace_callback == NULL ) )
+	{
+		return( libbfio_handle_read_buffer_at_offset(
+		         file_io_handle,
+		         buffer,
+		         size,
+		         offset,
+		         error ) );
+	}
+	start_time = libvsgpt_io_trace_get_current_time();
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	duration = libvsgpt_io_trace_get_current_time() - start_time;
+
+	if( duration < 0 )
+	{
+		duration = 0;
+	}
+	if( read_count > 0 )
+	{
+		io_trace->phase_read_size += (size64_t) read_count;
+	}
+	io_trace->trace_callback(
+	 LIBVSGPT_TRACE_EVENT_TYPE_READ,
+	 io_trace->phase,
+	 offset,
+	 (size64_t) size,
+	 (uint64_t) duration,
+	 io_trace->user_data );
+
+	return( read_count );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ * Returns the current time
+ */
+int64_t libvsgpt_io_trace_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( 0 );
+#endif
+}
+
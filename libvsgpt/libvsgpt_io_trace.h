@@ -0,0 +1,111 @@
+/*
+ * The IO trace functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_IO_TRACE_H )
+#define _LIBVSGPT_IO_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_io_trace libvsgpt_io_trace_t;
+
+struct libvsgpt_io_trace
+{
+	/* The trace callback function
+	 */
+	void (*trace_callback)(
+	       int event_type,
+	       int phase,
+	       off64_t offset,
+	       size64_t size,
+	       uint64_t duration,
+	       void *user_data );
+
+	/* The trace callback user data
+	 */
+	void *user_data;
+
+	/* The current phase
+	 */
+	int phase;
+
+	/* The start time of the current phase
+	 */
+	int64_t phase_start_time;
+
+	/* The number of bytes read in the current phase
+	 */
+	size64_t phase_read_size;
+};
+
+int libvsgpt_io_trace_initialize(
+     libvsgpt_io_trace_t **io_trace,
+     libcerror_error_t **error );
+
+int libvsgpt_io_trace_free(
+     libvsgpt_io_trace_t **io_trace,
+     libcerror_error_t **error );
+
+int libvsgpt_io_trace_set_callback(
+     libvsgpt_io_trace_t *io_trace,
+     void (*trace_callback)(
+            int event_type,
+            int phase,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libvsgpt_io_trace_start_phase(
+     libvsgpt_io_trace_t *io_trace,
+     int phase,
+     libcerror_error_t **error );
+
+int libvsgpt_io_trace_end_phase(
+     libvsgpt_io_trace_t *io_trace,
+     libcerror_error_t **error );
+
+ssize_t libvsgpt_io_trace_read_buffer_at_offset(
+         libvsgpt_io_trace_t *io_trace,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int64_t libvsgpt_io_trace_get_current_time(
+         void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_IO_TRACE_H ) */
+
@@ -0,0 +1,335 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_io_trace.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcnotify.h"
+#include "libvsgpt_metadata_cache.h"
+
+/* Creates a metadata cache
+ * Make sure the value metadata_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_metadata_cache_initialize(
+     libvsgpt_metadata_cache_t **metadata_cache,
+     size64_t volume_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_metadata_cache_initialize";
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_cache = memory_allocate_structure(
+	                   libvsgpt_metadata_cache_t );
+
+	if( *metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_cache,
+	     0,
+	     sizeof( libvsgpt_metadata_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *metadata_cache )->volume_size = volume_size;
+
+	return( 1 );
+
+on_error:
+	if( *metadata_cache != NULL )
+	{
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata cache
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_metadata_cache_free(
+     libvsgpt_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_metadata_cache_free";
+	int block_index       = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+		for( block_index = 0;
+		     block_index < LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS;
+		     block_index++ )
+		{
+			if( ( *metadata_cache )->blocks_data[ block_index ] != NULL )
+			{
+				memory_free(
+				 ( *metadata_cache )->blocks_data[ block_index ] );
+			}
+		}
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves data from the metadata cache
+ * The data is read from the file IO handle in blocks, so that subsequent
+ * requests for data in the same block are served from memory
+ * The data remains valid until the next call
+ * Returns 1 if successful, 0 if the data is outside the volume or -1 on error
+ */
+int libvsgpt_metadata_cache_get_data(
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function  = "libvsgpt_metadata_cache_get_data";
+	size_t block_size      = 0;
+	ssize_t read_count     = 0;
+	off64_t block_offset   = 0;
+	int block_index        = 0;
+	int least_recent_index = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBVSGPT_METADATA_CACHE_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) data_offset >= metadata_cache->volume_size )
+	 || ( (size64_t) data_size > ( metadata_cache->volume_size - (size64_t) data_offset ) ) )
+	{
+		return( 0 );
+	}
+	metadata_cache->access_time += 1;
+
+	for( block_index = 0;
+	     block_index < LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		block_offset = metadata_cache->blocks_offsets[ block_index ];
+		block_size   = metadata_cache->blocks_sizes[ block_index ];
+
+		if( ( block_size != 0 )
+		 && ( data_offset >= block_offset )
+		 && ( ( data_offset + (off64_t) data_size ) <= ( block_offset + (off64_t) block_size ) ) )
+		{
+			metadata_cache->blocks_access_times[ block_index ] = metadata_cache->access_time;
+
+			*data = &( metadata_cache->blocks_data[ block_index ][ data_offset - block_offset ] );
+
+			return( 1 );
+		}
+		if( metadata_cache->blocks_access_times[ block_index ] < metadata_cache->blocks_access_times[ least_recent_index ] )
+		{
+			least_recent_index = block_index;
+		}
+	}
+	block_index = least_recent_index;
+
+	if( metadata_cache->blocks_data[ block_index ] == NULL )
+	{
+		metadata_cache->blocks_data[ block_index ] = (uint8_t *) memory_allocate(
+		                                                          sizeof( uint8_t ) * LIBVSGPT_METADATA_CACHE_BLOCK_SIZE );
+
+		if( metadata_cache->blocks_data[ block_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block: %d data.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+	}
+	/* Blocks are aligned to the block size unless the data would span
+	 * multiple blocks, in which case the block starts at the data offset
+	 */
+	block_offset = data_offset - ( data_offset % LIBVSGPT_METADATA_CACHE_BLOCK_SIZE );
+
+	if( ( data_offset + (off64_t) data_size ) > ( block_offset + LIBVSGPT_METADATA_CACHE_BLOCK_SIZE ) )
+	{
+		block_offset = data_offset;
+	}
+	block_size = LIBVSGPT_METADATA_CACHE_BLOCK_SIZE;
+
+	if( (size64_t) block_size > ( metadata_cache->volume_size - (size64_t) block_offset ) )
+	{
+		block_size = (size_t) ( metadata_cache->volume_size - (size64_t) block_offset );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading metadata block of size: %" PRIzd " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 block_size,
+		 block_offset,
+		 block_offset );
+	}
+#endif
+	metadata_cache->blocks_sizes[ block_index ] = 0;
+
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              metadata_cache->io_trace,
+	              file_io_handle,
+	              metadata_cache->blocks_data[ block_index ],
+	              block_size,
+	              block_offset,
+	              error );
+
+	if( read_count != (ssize_t) block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	metadata_cache->number_of_reads += 1;
+
+	metadata_cache->blocks_offsets[ block_index ]      = block_offset;
+	metadata_cache->blocks_sizes[ block_index ]        = block_size;
+	metadata_cache->blocks_access_times[ block_index ] = metadata_cache->access_time;
+
+	*data = &( metadata_cache->blocks_data[ block_index ][ data_offset - block_offset ] );
+
+	return( 1 );
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_METADATA_CACHE_H )
+#define _LIBVSGPT_METADATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_io_trace.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_metadata_cache libvsgpt_metadata_cache_t;
+
+struct libvsgpt_metadata_cache
+{
+	/* The volume size
+	 */
+	size64_t volume_size;
+
+	/* The blocks data
+	 */
+	uint8_t *blocks_data[ LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS ];
+
+	/* The blocks offsets
+	 */
+	off64_t blocks_offsets[ LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS ];
+
+	/* The blocks sizes, where 0 represents an unused block
+	 */
+	size_t blocks_sizes[ LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS ];
+
+	/* The blocks last access times, used to determine the least recently used block
+	 */
+	uint32_t blocks_access_times[ LIBVSGPT_METADATA_CACHE_NUMBER_OF_BLOCKS ];
+
+	/* The current access time
+	 */
+	uint32_t access_time;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+
+	/* The IO trace, which is not managed by the metadata cache
+	 */
+	libvsgpt_io_trace_t *io_trace;
+};
+
+int libvsgpt_metadata_cache_initialize(
+     libvsgpt_metadata_cache_t **metadata_cache,
+     size64_t volume_size,
+     libcerror_error_t **error );
+
+int libvsgpt_metadata_cache_free(
+     libvsgpt_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error );
+
+int libvsgpt_metadata_cache_get_data(
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_METADATA_CACHE_H ) */
+
@@ -0,0 +1,428 @@
+/*
+ * The offset index functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_offset_index.h"
+#include "libvsgpt_partition_values_array.h"
+
+/* Creates an offset index
+ * Make sure the value offset_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_offset_index_initialize(
+     libvsgpt_offset_index_t **offset_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_offset_index_initialize";
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offset index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*offset_index = memory_allocate_structure(
+	                 libvsgpt_offset_index_t );
+
+	if( *offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offset index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *offset_index,
+	     0,
+	     sizeof( libvsgpt_offset_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear offset index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *offset_index != NULL )
+	{
+		memory_free(
+		 *offset_index );
+
+		*offset_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an offset index
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_offset_index_free(
+     libvsgpt_offset_index_t **offset_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_offset_index_free";
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_index != NULL )
+	{
+		if( ( *offset_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *offset_index )->entries );
+		}
+		memory_free(
+		 *offset_index );
+
+		*offset_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears an offset index
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_offset_index_clear(
+     libvsgpt_offset_index_t *offset_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_offset_index_clear";
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_index->entries != NULL )
+	{
+		memory_free(
+		 offset_index->entries );
+
+		offset_index->entries = NULL;
+	}
+	offset_index->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Builds the offset index from the partition values in the partitions array
+ * Partitions with a size of 0 are not indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_offset_index_build(
+     libvsgpt_offset_index_t *offset_index,
+     libvsgpt_partition_values_array_t *partitions,
+     libcerror_error_t **error )
+{
+	libvsgpt_offset_index_entry_t index_entry;
+
+	static char *function      = "libvsgpt_offset_index_build";
+	off64_t maximum_end_offset = 0;
+	off64_t partition_offset   = 0;
+	size64_t partition_size    = 0;
+	int entry_index            = 0;
+	int number_of_entries      = 0;
+	int number_of_partitions   = 0;
+	int partition_index        = 0;
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_index->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offset index - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_values_array_get_number_of_values(
+	     partitions,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions from array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_partitions > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvsgpt_offset_index_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	offset_index->entries = (libvsgpt_offset_index_entry_t *) memory_allocate(
+	                                                           sizeof( libvsgpt_offset_index_entry_t ) * number_of_partitions );
+
+	if( offset_index->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		partition_offset = partitions->offsets[ partition_index ];
+		partition_size   = partitions->sizes[ partition_index ];
+
+		if( ( partition_offset < 0 )
+		 || ( partition_size > (size64_t) ( INT64_MAX - partition_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid partition values: %d - offset or size value out of bounds.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( partition_size == 0 )
+		{
+			continue;
+		}
+		index_entry.start_offset       = partition_offset;
+		index_entry.end_offset         = partition_offset + (off64_t) partition_size;
+		index_entry.maximum_end_offset = 0;
+		index_entry.partition_index    = partition_index;
+
+		/* Partition entries are commonly stored in ascending offset order
+		 * hence an insertion sort is used to keep the entries sorted
+		 */
+		entry_index = number_of_entries;
+
+		while( ( entry_index > 0 )
+		    && ( offset_index->entries[ entry_index - 1 ].start_offset > index_entry.start_offset ) )
+		{
+			offset_index->entries[ entry_index ] = offset_index->entries[ entry_index - 1 ];
+
+			entry_index--;
+		}
+		offset_index->entries[ entry_index ] = index_entry;
+
+		number_of_entries++;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( offset_index->entries[ entry_index ].end_offset > maximum_end_offset )
+		{
+			maximum_end_offset = offset_index->entries[ entry_index ].end_offset;
+		}
+		offset_index->entries[ entry_index ].maximum_end_offset = maximum_end_offset;
+	}
+	offset_index->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( offset_index->entries != NULL )
+	{
+		memory_free(
+		 offset_index->entries );
+
+		offset_index->entries = NULL;
+	}
+	offset_index->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the index of the partition that contains a specific offset
+ * If partitions overlap the partition with the lowest partition index is returned
+ * The relative offset is set to the offset relative to the start of the partition
+ * Returns 1 if successful, 0 if no such partition or -1 on error
+ */
+int libvsgpt_offset_index_get_partition_index_by_offset(
+     libvsgpt_offset_index_t *offset_index,
+     off64_t offset,
+     int *partition_index,
+     off64_t *relative_offset,
+     libcerror_error_t **error )
+{
+	libvsgpt_offset_index_entry_t *index_entry = NULL;
+	static char *function                      = "libvsgpt_offset_index_get_partition_index_by_offset";
+	int entry_index                            = 0;
+	int lower_bound                            = 0;
+	int result                                 = 0;
+	int upper_bound                            = 0;
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset_index->number_of_entries == 0 ) )
+	{
+		return( 0 );
+	}
+	/* Determine the number of entries with a start offset <= offset
+	 */
+	upper_bound = offset_index->number_of_entries;
+
+	while( lower_bound < upper_bound )
+	{
+		entry_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		if( offset_index->entries[ entry_index ].start_offset <= offset )
+		{
+			lower_bound = entry_index + 1;
+		}
+		else
+		{
+			upper_bound = entry_index;
+		}
+	}
+	/* Scan back over the candidates as long as one of them can still
+	 * contain the offset, which is bound by the maximum end offset
+	 */
+	for( entry_index = lower_bound - 1;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		index_entry = &( offset_index->entries[ entry_index ] );
+
+		if( index_entry->maximum_end_offset <= offset )
+		{
+			break;
+		}
+		if( offset < index_entry->end_offset )
+		{
+			if( ( result == 0 )
+			 || ( index_entry->partition_index < *partition_index ) )
+			{
+				*partition_index = index_entry->partition_index;
+				*relative_offset = offset - index_entry->start_offset;
+
+				result = 1;
+			}
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * The offset index functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_OFFSET_INDEX_H )
+#define _LIBVSGPT_OFFSET_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_partition_values_array.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_offset_index_entry libvsgpt_offset_index_entry_t;
+
+struct libvsgpt_offset_index_entry
+{
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The largest end offset of this and all preceding entries
+	 */
+	off64_t maximum_end_offset;
+
+	/* The partition index
+	 */
+	int partition_index;
+};
+
+typedef struct libvsgpt_offset_index libvsgpt_offset_index_t;
+
+struct libvsgpt_offset_index
+{
+	/* The entries sorted by start offset
+	 */
+	libvsgpt_offset_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libvsgpt_offset_index_initialize(
+     libvsgpt_offset_index_t **offset_index,
+     libcerror_error_t **error );
+
+int libvsgpt_offset_index_free(
+     libvsgpt_offset_index_t **offset_index,
+     libcerror_error_t **error );
+
+int libvsgpt_offset_index_clear(
+     libvsgpt_offset_index_t *offset_index,
+     libcerror_error_t **error );
+
+int libvsgpt_offset_index_build(
+     libvsgpt_offset_index_t *offset_index,
+     libvsgpt_partition_values_array_t *partitions,
+     libcerror_error_t **error );
+
+int libvsgpt_offset_index_get_partition_index_by_offset(
+     libvsgpt_offset_index_t *offset_index,
+     off64_t offset,
+     int *partition_index,
+     off64_t *relative_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_OFFSET_INDEX_H ) */
+
@@ -27,27 +27,30 @@
 #include "libvsgpt_io_handle.h"
 #include "libvsgpt_libbfio.h"
 #include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcnotify.h"
 #include "libvsgpt_libcthreads.h"
-#include "libvsgpt_libfcache.h"
-#include "libvsgpt_libfdata.h"
 #include "libvsgpt_partition.h"
-#include "libvsgpt_sector_data.h"
+#include "libvsgpt_sector_cache.h"
 #include "libvsgpt_types.h"
 #include "libvsgpt_unused.h"
 
 /* Creates a partition
  * Make sure the value partition is referencing, is set to NULL
+ * If volume data is provided the partition data is read directly from it
+ * The IO handle is optional and used to check if abort was signalled or the deadline has passed
  * Returns 1 if successful or -1 on error
  */
 int libvsgpt_partition_initialize(
      libvsgpt_partition_t **partition,
+     libvsgpt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *volume_data,
+     size_t volume_data_size,
      libvsgpt_partition_values_t *partition_values,
      libcerror_error_t **error )
 {
 	libvsgpt_internal_partition_t *internal_partition = NULL;
 	static char *function                             = "libvsgpt_partition_initialize";
-	int element_index                                 = 0;
 
 	if( partition == NULL )
 	{
@@ -82,6 +85,18 @@ int libvsgpt_partition_initialize(
 
 		return( -1 );
 	}
+	if( ( volume_data != NULL )
+	 && ( volume_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	internal_partition = memory_allocate_structure(
 	                      libvsgpt_internal_partition_t );
 
@@ -124,75 +139,84 @@ int libvsgpt_partition_initialize(
 
 		goto on_error;
 	}
-	if( libfdata_vector_initialize(
-	     &( internal_partition->sectors_vector ),
-	     512,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libvsgpt_sector_data_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	if( volume_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sectors vector.",
-		 function );
+		/* The partition data can be smaller than the partition size
+		 * if the buffer only contains the start of the volume
+		 */
+		if( ( partition_values->offset < 0 )
+		 || ( (size64_t) partition_values->offset >= (size64_t) volume_data_size ) )
+		{
+			internal_partition->data      = &( volume_data[ volume_data_size ] );
+			internal_partition->data_size = 0;
+		}
+		else
+		{
+			internal_partition->data      = &( volume_data[ partition_values->offset ] );
+			internal_partition->data_size = volume_data_size - (size_t) partition_values->offset;
 
-		goto on_error;
+			if( (size64_t) internal_partition->data_size > internal_partition->size )
+			{
+				internal_partition->data_size = (size_t) internal_partition->size;
+			}
+		}
 	}
-	if( libfdata_vector_append_segment(
-	     internal_partition->sectors_vector,
-	     &element_index,
-	     0,
-	     partition_values->offset,
-	     partition_values->size,
-	     0,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to sectors vector.",
-		 function );
+		if( libvsgpt_sector_cache_initialize(
+		     &( internal_partition->sector_cache ),
+		     partition_values->offset,
+		     internal_partition->size,
+		     512,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sector cache.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		internal_partition->uncached_read_minimum_size = LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS
+		                                               * LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES
+		                                               * internal_partition->sector_cache->sector_size;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_partition->sectors_cache ),
-	     LIBVSGPT_MAXIMUM_CACHE_ENTRIES_SECTORS,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_partition->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sectors cache.",
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_partition->read_write_lock ),
+	if( libcthreads_mutex_initialize(
+	     &( internal_partition->file_io_handle_mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
+		 "%s: unable to initialize file IO handle mutex.",
 		 function );
 
 		goto on_error;
 	}
 #endif
-	internal_partition->file_io_handle   = file_io_handle;
-	internal_partition->partition_values = partition_values;
+	/* The file IO handle of the volume is cloned on the first read
+	 * so that partitions that are not read do not open a file IO handle
+	 */
+	internal_partition->volume_file_io_handle = file_io_handle;
+	internal_partition->io_handle             = io_handle;
+	internal_partition->partition_values      = partition_values;
 
 	*partition = (libvsgpt_partition_t *) internal_partition;
 
@@ -201,6 +225,26 @@ int libvsgpt_partition_initialize(
 on_error:
 	if( internal_partition != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( internal_partition->file_io_handle_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_partition->file_io_handle_mutex ),
+			 NULL );
+		}
+		if( internal_partition->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_partition->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_partition->sector_cache != NULL )
+		{
+			libvsgpt_sector_cache_free(
+			 &( internal_partition->sector_cache ),
+			 NULL );
+		}
 		memory_free(
 		 internal_partition );
 	}
@@ -234,53 +278,287 @@ int libvsgpt_partition_free(
 		internal_partition = (libvsgpt_internal_partition_t *) *partition;
 		*partition         = NULL;
 
-		/* The file_io_handle and partition_values references are freed elsewhere
+		/* The partition_values reference is freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_partition->sectors_vector ),
+		if( internal_partition->file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     internal_partition->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( internal_partition->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_partition->sector_cache != NULL )
+		{
+			if( libvsgpt_sector_cache_free(
+			     &( internal_partition->sector_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sector cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_partition->read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sectors vector.",
+			 "%s: unable to free read/write lock.",
 			 function );
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( internal_partition->sectors_cache ),
+		if( libcthreads_mutex_free(
+		     &( internal_partition->file_io_handle_mutex ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sectors cache.",
+			 "%s: unable to free file IO handle mutex.",
 			 function );
 
 			result = -1;
 		}
+#endif
+		memory_free(
+		 internal_partition );
+	}
+	return( result );
+}
+
+/* Clones a file IO handle for reading partition data
+ * The clone is opened separately so that it does not share its offset and lock
+ * with the source file IO handle
+ * Returns 1 if successful, 0 if the file IO handle cannot be cloned or -1 on error
+ */
+int libvsgpt_partition_clone_file_io_handle(
+     libbfio_handle_t **destination_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *clone_error = NULL;
+	static char *function          = "libvsgpt_partition_clone_file_io_handle";
+	int result                     = 0;
+
+	if( destination_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Not every type of file IO handle can be cloned or opened a second time,
+	 * in which case the caller falls back to the source file IO handle
+	 */
+	if( libbfio_handle_clone(
+	     destination_file_io_handle,
+	     source_file_io_handle,
+	     &clone_error ) != 1 )
+	{
+		goto on_clone_error;
+	}
+	result = libbfio_handle_is_open(
+	          *destination_file_io_handle,
+	          &clone_error );
+
+	if( result == -1 )
+	{
+		goto on_clone_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     *destination_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     &clone_error ) != 1 )
+		{
+			goto on_clone_error;
+		}
+	}
+	return( 1 );
+
+on_clone_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to clone file IO handle.\n",
+		 function );
+	}
+#endif
+	libcerror_error_free(
+	 &clone_error );
+
+	if( *destination_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 destination_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves the file IO handle to read the partition data
+ * The file IO handle of the volume is cloned on the first call, so that reads
+ * from different partitions do not contend on the offset and lock of a shared
+ * file IO handle. If it cannot be cloned the file IO handle of the volume is used
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_partition_get_file_io_handle(
+     libvsgpt_internal_partition_t *internal_partition,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_partition_get_file_io_handle";
+	int result            = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-		if( libcthreads_read_write_lock_free(
-		     &( internal_partition->read_write_lock ),
-		     error ) != 1 )
+	if( libcthreads_mutex_grab(
+	     internal_partition->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_partition->file_io_handle == NULL )
+	 && ( internal_partition->volume_file_io_handle != NULL ) )
+	{
+		result = libvsgpt_partition_clone_file_io_handle(
+		          &( internal_partition->file_io_handle ),
+		          internal_partition->volume_file_io_handle,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free read/write lock.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-#endif
-		memory_free(
-		 internal_partition );
+		else if( result == 0 )
+		{
+			internal_partition->file_io_handle = internal_partition->volume_file_io_handle;
+		}
+		internal_partition->file_io_handle_created_in_library = (uint8_t) result;
 	}
-	return( result );
+	*file_io_handle = internal_partition->file_io_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_partition->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_partition->file_io_handle_mutex,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Retrieves the partition entry index
@@ -649,23 +927,28 @@ int libvsgpt_partition_get_volume_offset(
 	return( result );
 }
 
-/* Reads (partition) data at the current offset into a buffer using a Basic File IO (bfio) handle
- * This function is not multi-thread safe acquire write lock before call
+/* Reads (partition) data at a specific offset into a buffer using a Basic File IO (bfio) handle
+ * The data is read in pieces of LIBVSGPT_PARTITION_CHUNK_SIZE and is not stored in the sector cache,
+ * which is intended for large reads such as chunks that would otherwise evict the cached sectors
+ * The abort flag and the deadline are checked before every piece
+ * The current offset of the partition is not changed
+ * This function does not require the partition lock since it does not use the sector cache
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_uncached(
          libvsgpt_internal_partition_t *internal_partition,
          libbfio_handle_t *file_io_handle,
          void *buffer,
          size_t buffer_size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	libvsgpt_sector_data_t *sector_data = NULL;
-	static char *function               = "libvsgpt_internal_partition_read_buffer_from_file_io_handle";
-	off64_t current_offset              = 0;
-	off64_t element_data_offset         = 0;
-	size_t buffer_offset                = 0;
-	size_t read_size                    = 0;
+	static char *function = "libvsgpt_internal_partition_read_buffer_at_offset_uncached";
+	off64_t volume_offset = 0;
+	int64_t deadline      = 0;
+	ssize_t read_count    = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
 
 	if( internal_partition == NULL )
 	{
@@ -678,13 +961,13 @@ ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( internal_partition->current_offset < 0 )
+	if( internal_partition->partition_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid partition - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing partition values.",
 		 function );
 
 		return( -1 );
@@ -711,97 +994,116 @@ ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( (size64_t) internal_partition->current_offset >= internal_partition->size )
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_partition->size )
 	{
 		return( 0 );
 	}
-	if( (size64_t) buffer_size > ( internal_partition->size - internal_partition->current_offset ) )
+	if( (size64_t) buffer_size > ( internal_partition->size - offset ) )
 	{
-		buffer_size = (size_t) ( internal_partition->size - internal_partition->current_offset );
+		buffer_size = (size_t) ( internal_partition->size - offset );
 	}
 	if( buffer_size == 0 )
 	{
 		return( 0 );
 	}
-	current_offset = internal_partition->current_offset;
+	if( internal_partition->io_handle != NULL )
+	{
+		deadline = libvsgpt_io_handle_get_deadline(
+		            internal_partition->io_handle );
+	}
+	volume_offset = internal_partition->partition_values->offset + offset;
 
 	while( buffer_size > 0 )
 	{
-		if( libfdata_vector_get_element_value_at_offset(
-		     internal_partition->sectors_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) internal_partition->sectors_cache,
-		     current_offset,
-		     &element_data_offset,
-		     (intptr_t **) &sector_data,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 current_offset,
-			 current_offset );
-
-			return( -1 );
-		}
-		if( sector_data == NULL )
+		if( internal_partition->io_handle != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sector data.",
-			 function );
-
-			return( -1 );
+			if( libvsgpt_io_handle_check_abort(
+			     internal_partition->io_handle,
+			     deadline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: unable to continue read at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 volume_offset,
+				 volume_offset );
+
+				return( -1 );
+			}
 		}
-		read_size = sector_data->data_size - (size_t) element_data_offset;
+		read_size = buffer_size;
 
-		if( buffer_size < read_size )
+		if( read_size > LIBVSGPT_PARTITION_CHUNK_SIZE )
 		{
-			read_size = buffer_size;
+			read_size = LIBVSGPT_PARTITION_CHUNK_SIZE;
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( sector_data->data[ element_data_offset ] ),
-		     read_size ) == NULL )
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              read_size,
+		              volume_offset,
+		              error );
+
+		if( read_count == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 volume_offset,
+			 volume_offset );
 
 			return( -1 );
 		}
-		current_offset += read_size;
-		buffer_offset  += read_size;
-		buffer_size    -= read_size;
+		if( read_count == 0 )
+		{
+			break;
+		}
+		volume_offset += read_count;
+		buffer_offset += (size_t) read_count;
+		buffer_size   -= (size_t) read_count;
 	}
-	internal_partition->current_offset = current_offset;
-
 	return( (ssize_t) buffer_offset );
 }
 
-/* Reads (partition) data at the current offset into a buffer
+/* Reads (partition) data at a specific offset into a buffer using a Basic File IO (bfio) handle
+ * Large reads are read directly since they would otherwise evict the cached sectors
+ * The current offset of the partition is not changed
+ * This function does not require the partition lock since the sector cache locks its own shards
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libvsgpt_partition_read_buffer(
-         libvsgpt_partition_t *partition,
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+         libvsgpt_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
          void *buffer,
          size_t buffer_size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	libvsgpt_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsgpt_partition_read_buffer";
-	ssize_t read_count                                = 0;
+	static char *function  = "libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle";
+	off64_t current_offset = 0;
+	int64_t deadline       = 0;
+	ssize_t read_count     = 0;
+	size_t buffer_offset   = 0;
+	size_t read_size       = 0;
 
-	if( partition == NULL )
+	if( internal_partition == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -812,29 +1114,424 @@ ssize_t libvsgpt_partition_read_buffer(
 
 		return( -1 );
 	}
-	internal_partition = (libvsgpt_internal_partition_t *) partition;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_partition->read_write_lock,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_partition->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_partition->size - offset ) )
+	{
+		buffer_size = (size_t) ( internal_partition->size - offset );
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_partition->uncached_read_minimum_size > 0 )
+	 && ( buffer_size >= internal_partition->uncached_read_minimum_size ) )
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+		              internal_partition,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	current_offset = offset;
+
+	if( internal_partition->io_handle != NULL )
+	{
+		deadline = libvsgpt_io_handle_get_deadline(
+		            internal_partition->io_handle );
+	}
+	while( buffer_size > 0 )
+	{
+		if( internal_partition->io_handle != NULL )
+		{
+			if( libvsgpt_io_handle_check_abort(
+			     internal_partition->io_handle,
+			     deadline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: unable to continue read at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 current_offset,
+				 current_offset );
+
+				return( -1 );
+			}
+		}
+		read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+		              internal_partition->sector_cache,
+		              file_io_handle,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              buffer_size,
+		              current_offset,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 current_offset,
+			 current_offset );
+
+			return( -1 );
+		}
+		read_size = (size_t) read_count;
+
+		current_offset += read_size;
+		buffer_offset  += read_size;
+		buffer_size    -= read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads (partition) data at the current offset into a buffer using a Basic File IO (bfio) handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
+         libvsgpt_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_partition_read_buffer_from_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+	              internal_partition,
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              internal_partition->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_partition->current_offset,
+		 internal_partition->current_offset );
+
+		return( -1 );
+	}
+	internal_partition->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads (partition) data at a specific offset into a buffer directly from the volume data
+ * The current offset of the partition is not changed
+ * This function is multi-thread safe since the volume data is not modified
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+         libvsgpt_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_partition_read_buffer_at_offset_from_data";
+	size_t data_offset    = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= (size64_t) internal_partition->data_size )
+	{
+		return( 0 );
+	}
+	data_offset = (size_t) offset;
+
+	if( buffer_size > ( internal_partition->data_size - data_offset ) )
+	{
+		buffer_size = internal_partition->data_size - data_offset;
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( internal_partition->data[ data_offset ] ),
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Reads (partition) data at the current offset into a buffer directly from the volume data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_internal_partition_read_buffer_from_data(
+         libvsgpt_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_partition_read_buffer_from_data";
+	ssize_t read_count    = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+	              internal_partition,
+	              buffer,
+	              buffer_size,
+	              internal_partition->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_partition->current_offset,
+		 internal_partition->current_offset );
+
+		return( -1 );
+	}
+	internal_partition->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads (partition) data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_partition_read_buffer(
+         libvsgpt_partition_t *partition,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	static char *function                             = "libvsgpt_partition_read_buffer";
+	ssize_t read_count                                = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsgpt_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
 #endif
-	read_count = libvsgpt_internal_partition_read_buffer_from_file_io_handle(
-		      internal_partition,
-		      internal_partition->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
+	if( internal_partition->data != NULL )
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_from_data(
+			      internal_partition,
+			      buffer,
+			      buffer_size,
+			      error );
+	}
+	else if( libvsgpt_internal_partition_get_file_io_handle(
+	          internal_partition,
+	          &file_io_handle,
+	          error ) != 1 )
+	{
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_from_file_io_handle(
+			      internal_partition,
+			      file_io_handle,
+			      buffer,
+			      buffer_size,
+			      error );
+	}
 
 	if( read_count == -1 )
 	{
@@ -876,6 +1573,7 @@ ssize_t libvsgpt_partition_read_buffer_at_offset(
          libcerror_error_t **error )
 {
 	libvsgpt_internal_partition_t *internal_partition = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
 	static char *function                             = "libvsgpt_partition_read_buffer_at_offset";
 	ssize_t read_count                                = 0;
 
@@ -922,12 +1620,30 @@ ssize_t libvsgpt_partition_read_buffer_at_offset(
 
 		goto on_error;
 	}
-	read_count = libvsgpt_internal_partition_read_buffer_from_file_io_handle(
-		      internal_partition,
-		      internal_partition->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
+	if( internal_partition->data != NULL )
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_from_data(
+			      internal_partition,
+			      buffer,
+			      buffer_size,
+			      error );
+	}
+	else if( libvsgpt_internal_partition_get_file_io_handle(
+	          internal_partition,
+	          &file_io_handle,
+	          error ) != 1 )
+	{
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_from_file_io_handle(
+			      internal_partition,
+			      file_io_handle,
+			      buffer,
+			      buffer_size,
+			      error );
+	}
 
 	if( read_count == -1 )
 	{
@@ -1241,3 +1957,110 @@ int libvsgpt_partition_get_size(
 	return( 1 );
 }
 
+/* Retrieves the sector cache statistics
+ * The cache sector size is the size of the sectors the cache reads from the file IO handle
+ * and the number of sector reads is the number of sectors the cache has read so far,
+ * the number of deduplicated misses is the number of misses that waited for a read
+ * of the same sector by another thread instead of reading the sector themselves,
+ * all are 0 if the partition data is not read through a sector cache
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_get_cache_statistics(
+     libvsgpt_partition_t *partition,
+     size_t *cache_sector_size,
+     int *number_of_sector_reads,
+     int *number_of_deduplicated_misses,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_get_cache_statistics";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsgpt_internal_partition_t *) partition;
+
+	if( cache_sector_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache sector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sector_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sector reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_deduplicated_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of deduplicated misses.",
+		 function );
+
+		return( -1 );
+	}
+	/* The partition is not locked since the sector cache locks its own shards
+	 */
+	if( internal_partition->sector_cache == NULL )
+	{
+		*cache_sector_size             = 0;
+		*number_of_sector_reads        = 0;
+		*number_of_deduplicated_misses = 0;
+
+		return( 1 );
+	}
+	if( libvsgpt_sector_cache_get_number_of_reads(
+	     internal_partition->sector_cache,
+	     number_of_sector_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+	     internal_partition->sector_cache,
+	     number_of_deduplicated_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of deduplicated misses.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_sector_size = internal_partition->sector_cache->sector_size;
+
+	return( 1 );
+}
+
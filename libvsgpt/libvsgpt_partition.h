@@ -26,12 +26,12 @@
 #include <types.h>
 
 #include "libvsgpt_extern.h"
+#include "libvsgpt_io_handle.h"
 #include "libvsgpt_libbfio.h"
 #include "libvsgpt_libcerror.h"
 #include "libvsgpt_libcthreads.h"
-#include "libvsgpt_libfcache.h"
-#include "libvsgpt_libfdata.h"
 #include "libvsgpt_partition_values.h"
+#include "libvsgpt_sector_cache.h"
 #include "libvsgpt_types.h"
 
 #if defined( __cplusplus )
@@ -42,21 +42,42 @@ typedef struct libvsgpt_internal_partition libvsgpt_internal_partition_t;
 
 struct libvsgpt_internal_partition
 {
-	/* The file IO handle
+	/* The IO handle
+	 */
+	libvsgpt_io_handle_t *io_handle;
+
+	/* The file IO handle of the volume
+	 */
+	libbfio_handle_t *volume_file_io_handle;
+
+	/* The file IO handle, which is cloned from the file IO handle of the volume on the first read
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
 	/* The partition values
 	 */
 	libvsgpt_partition_values_t *partition_values;
 
-	/* The sectors vector
+	/* The partition data, when the volume was opened from a buffer
 	 */
-	libfdata_vector_t *sectors_vector;
+	const uint8_t *data;
 
-	/* The sectors cache
+	/* The partition data size
 	 */
-	libfcache_cache_t *sectors_cache;
+	size_t data_size;
+
+	/* The sector cache
+	 */
+	libvsgpt_sector_cache_t *sector_cache;
+
+	/* The minimum size of a read that is read directly instead of using the sector cache,
+	 * which is the size of the data held by the sector cache
+	 */
+	size_t uncached_read_minimum_size;
 
 	/* The current offset
 	 */
@@ -70,12 +91,19 @@ struct libvsgpt_internal_partition
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The file IO handle mutex
+	 */
+	libcthreads_mutex_t *file_io_handle_mutex;
 #endif
 };
 
 int libvsgpt_partition_initialize(
      libvsgpt_partition_t **partition,
+     libvsgpt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *volume_data,
+     size_t volume_data_size,
      libvsgpt_partition_values_t *partition_values,
      libcerror_error_t **error );
 
@@ -84,6 +112,16 @@ int libvsgpt_partition_free(
      libvsgpt_partition_t **partition,
      libcerror_error_t **error );
 
+int libvsgpt_partition_clone_file_io_handle(
+     libbfio_handle_t **destination_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_partition_get_file_io_handle(
+     libvsgpt_internal_partition_t *internal_partition,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
 LIBVSGPT_EXTERN \
 int libvsgpt_partition_get_entry_index(
      libvsgpt_partition_t *partition,
@@ -116,6 +154,22 @@ int libvsgpt_partition_get_volume_offset(
      off64_t *volume_offset,
      libcerror_error_t **error );
 
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+         libvsgpt_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+         libvsgpt_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
          libvsgpt_internal_partition_t *internal_partition,
          libbfio_handle_t *file_io_handle,
@@ -123,6 +177,19 @@ ssize_t libvsgpt_internal_partition_read_buffer_from_file_io_handle(
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+         libvsgpt_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libvsgpt_internal_partition_read_buffer_from_data(
+         libvsgpt_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 LIBVSGPT_EXTERN \
 ssize_t libvsgpt_partition_read_buffer(
          libvsgpt_partition_t *partition,
@@ -163,6 +230,14 @@ int libvsgpt_partition_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_partition_get_cache_statistics(
+     libvsgpt_partition_t *partition,
+     size_t *cache_sector_size,
+     int *number_of_sector_reads,
+     int *number_of_deduplicated_misses,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,835 @@
+/*
+ * The partition chunks functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_io_handle.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_partition.h"
+#include "libvsgpt_partition_chunks.h"
+#include "libvsgpt_types.h"
+
+/* Creates partition chunks
+ * Make sure the value partition_chunks is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_chunks_initialize(
+     libvsgpt_partition_chunks_t **partition_chunks,
+     libvsgpt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_partition_t **partitions,
+     int number_of_partitions,
+     size_t chunk_size,
+     int (*callback)(
+            int partition_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_chunks_initialize";
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partitions == NULL )
+	 && ( number_of_partitions != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of partitions value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX )
+	 || ( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_chunks = memory_allocate_structure(
+	                     libvsgpt_partition_chunks_t );
+
+	if( *partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *partition_chunks,
+	     0,
+	     sizeof( libvsgpt_partition_chunks_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition chunks.",
+		 function );
+
+		memory_free(
+		 *partition_chunks );
+
+		*partition_chunks = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *partition_chunks )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *partition_chunks )->io_handle            = io_handle;
+	( *partition_chunks )->file_io_handle       = file_io_handle;
+	( *partition_chunks )->partitions           = partitions;
+	( *partition_chunks )->number_of_partitions = number_of_partitions;
+	( *partition_chunks )->chunk_size           = chunk_size;
+	( *partition_chunks )->callback             = callback;
+	( *partition_chunks )->user_data            = user_data;
+	( *partition_chunks )->deadline             = libvsgpt_io_handle_get_deadline(
+	                                               io_handle );
+
+	return( 1 );
+
+on_error:
+	if( *partition_chunks != NULL )
+	{
+		memory_free(
+		 *partition_chunks );
+
+		*partition_chunks = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees partition chunks
+ * The partitions are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_chunks_free(
+     libvsgpt_partition_chunks_t **partition_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_chunks_free";
+	int result            = 1;
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_chunks != NULL )
+	{
+		if( ( *partition_chunks )->chunk_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *partition_chunks )->chunk_error ) );
+		}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *partition_chunks )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *partition_chunks );
+
+		*partition_chunks = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the next chunk to process
+ * Chunks are handed out one at a time, so that a thread that is done with its chunk
+ * continues with the next chunk, including chunks of the partition other threads are processing
+ * Returns 1 if successful, 0 if no more chunks are available or -1 on error
+ */
+int libvsgpt_partition_chunks_get_next_chunk(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     int *partition_index,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_chunks_get_next_chunk";
+	size64_t remaining_size                           = 0;
+	int result                                        = 0;
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     partition_chunks->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( partition_chunks->is_stopped == 0 )
+	    && ( partition_chunks->next_partition_index < partition_chunks->number_of_partitions ) )
+	{
+		internal_partition = (libvsgpt_internal_partition_t *) partition_chunks->partitions[ partition_chunks->next_partition_index ];
+
+		if( ( internal_partition != NULL )
+		 && ( (size64_t) partition_chunks->next_offset < internal_partition->size ) )
+		{
+			remaining_size = internal_partition->size - (size64_t) partition_chunks->next_offset;
+
+			*partition_index = partition_chunks->next_partition_index;
+			*offset          = partition_chunks->next_offset;
+			*size            = partition_chunks->chunk_size;
+
+			if( (size64_t) *size > remaining_size )
+			{
+				*size = (size_t) remaining_size;
+			}
+			partition_chunks->next_offset += (off64_t) *size;
+
+			result = 1;
+
+			break;
+		}
+		partition_chunks->next_partition_index += 1;
+		partition_chunks->next_offset           = 0;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     partition_chunks->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stops processing the chunks
+ * The chunk error of the first chunk that failed is retained, other chunk errors are freed
+ * The chunk error can be NULL to stop processing without an error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_chunks_stop(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     libcerror_error_t **chunk_error,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_chunks_stop";
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     partition_chunks->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	partition_chunks->is_stopped = 1;
+
+	if( ( chunk_error != NULL )
+	 && ( partition_chunks->chunk_error == NULL ) )
+	{
+		partition_chunks->chunk_error = *chunk_error;
+		*chunk_error                  = NULL;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     partition_chunks->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( chunk_error != NULL )
+	 && ( *chunk_error != NULL ) )
+	{
+		libcerror_error_free(
+		 chunk_error );
+	}
+	return( 1 );
+}
+
+/* Processes chunks until no more chunks are available
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_chunks_process_chunks(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_chunks_process_chunks";
+	size_t chunk_size                                 = 0;
+	ssize_t read_count                                = 0;
+	off64_t chunk_offset                              = 0;
+	int partition_index                               = 0;
+	int result                                        = 0;
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_chunks->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition chunks - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size < partition_chunks->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libvsgpt_io_handle_check_abort(
+		     partition_chunks->io_handle,
+		     partition_chunks->deadline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to continue processing chunks.",
+			 function );
+
+			return( -1 );
+		}
+		result = libvsgpt_partition_chunks_get_next_chunk(
+		          partition_chunks,
+		          &partition_index,
+		          &chunk_offset,
+		          &chunk_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next chunk.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_partition = (libvsgpt_internal_partition_t *) partition_chunks->partitions[ partition_index ];
+
+			/* The partition is not locked since the chunk is read without
+			 * changing the current offset of the partition
+			 */
+			if( internal_partition->data != NULL )
+			{
+				read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+				              internal_partition,
+				              buffer,
+				              chunk_size,
+				              chunk_offset,
+				              error );
+			}
+			else
+			{
+				/* The chunk is read directly using the file IO handle of the thread
+				 * since it would otherwise evict the sectors cached by the partition
+				 */
+				read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+				              internal_partition,
+				              file_io_handle,
+				              buffer,
+				              chunk_size,
+				              chunk_offset,
+				              error );
+			}
+			if( read_count != (ssize_t) chunk_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk of partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 partition_index,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+			if( partition_chunks->callback(
+			     partition_index,
+			     chunk_offset,
+			     buffer,
+			     chunk_size,
+			     partition_chunks->user_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback failed for chunk of partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 partition_index,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+}
+
+/* Processes chunks in a separate thread
+ * Callback function for the partition chunks threads
+ * An error is retained in the partition chunks and stops the other threads
+ * Returns 1
+ */
+int libvsgpt_partition_chunks_process_thread(
+     libvsgpt_partition_chunks_t *partition_chunks )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *buffer                  = NULL;
+	static char *function            = "libvsgpt_partition_chunks_process_thread";
+	int result                       = 0;
+
+	if( partition_chunks == NULL )
+	{
+		return( 1 );
+	}
+	if( partition_chunks->file_io_handle != NULL )
+	{
+		/* Every thread reads using its own clone of the file IO handle so that
+		 * reads from different threads do not contend on a shared file IO handle
+		 */
+		result = libvsgpt_partition_clone_file_io_handle(
+		          &file_io_handle,
+		          partition_chunks->file_io_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle.",
+			 function );
+		}
+		else if( result == 0 )
+		{
+			file_io_handle = partition_chunks->file_io_handle;
+		}
+	}
+	if( error == NULL )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * partition_chunks->chunk_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+		}
+		else
+		{
+			libvsgpt_partition_chunks_process_chunks(
+			 partition_chunks,
+			 file_io_handle,
+			 buffer,
+			 partition_chunks->chunk_size,
+			 &error );
+
+			memory_free(
+			 buffer );
+		}
+	}
+	if( result == 1 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		if( libvsgpt_partition_chunks_stop(
+		     partition_chunks,
+		     &error,
+		     NULL ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( 1 );
+}
+
+/* Processes the chunks of all partitions
+ * The callback can be called concurrently from multiple threads and
+ * the chunks are not passed to the callback in a specific order
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_chunks_process(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS ];
+
+	int thread_index      = 0;
+#endif
+
+	static char *function = "libvsgpt_partition_chunks_process";
+	int result            = 1;
+
+	if( partition_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS )
+	{
+		number_of_threads = LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS;
+	}
+	if( number_of_threads > 1 )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			threads[ thread_index ] = NULL;
+
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libvsgpt_partition_chunks_process_thread,
+			     (void *) partition_chunks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				/* Stop the threads that were already created
+				 */
+				libvsgpt_partition_chunks_stop(
+				 partition_chunks,
+				 NULL,
+				 NULL );
+
+				number_of_threads = thread_index;
+				result            = -1;
+
+				break;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+	{
+		libvsgpt_partition_chunks_process_thread(
+		 partition_chunks );
+	}
+	if( partition_chunks->chunk_error != NULL )
+	{
+		/* Pass the error of the chunk that failed on to the caller,
+		 * so that the caller can determine why processing stopped
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = partition_chunks->chunk_error;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &( partition_chunks->chunk_error ) );
+		}
+		partition_chunks->chunk_error = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process chunks.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
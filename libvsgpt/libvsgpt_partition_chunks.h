@@ -0,0 +1,156 @@
+/*
+ * The partition chunks functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_PARTITION_CHUNKS_H )
+#define _LIBVSGPT_PARTITION_CHUNKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_io_handle.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_partition_chunks libvsgpt_partition_chunks_t;
+
+struct libvsgpt_partition_chunks
+{
+	/* The IO handle
+	 */
+	libvsgpt_io_handle_t *io_handle;
+
+	/* The file IO handle of the volume
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The partitions
+	 */
+	libvsgpt_partition_t **partitions;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The callback function
+	 */
+	int (*callback)(
+	       int partition_index,
+	       off64_t offset,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *user_data,
+	       libcerror_error_t **error );
+
+	/* The callback user data
+	 */
+	void *user_data;
+
+	/* The deadline in microseconds, where 0 represents no deadline
+	 */
+	int64_t deadline;
+
+	/* The index of the partition of the next chunk
+	 */
+	int next_partition_index;
+
+	/* The offset of the next chunk relative to the start of the partition
+	 */
+	off64_t next_offset;
+
+	/* Value to indicate processing has stopped
+	 */
+	uint8_t is_stopped;
+
+	/* The error of the first chunk that failed
+	 */
+	libcerror_error_t *chunk_error;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libvsgpt_partition_chunks_initialize(
+     libvsgpt_partition_chunks_t **partition_chunks,
+     libvsgpt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_partition_t **partitions,
+     int number_of_partitions,
+     size_t chunk_size,
+     int (*callback)(
+            int partition_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_chunks_free(
+     libvsgpt_partition_chunks_t **partition_chunks,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_chunks_get_next_chunk(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     int *partition_index,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_chunks_stop(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     libcerror_error_t **chunk_error,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_chunks_process_chunks(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_chunks_process_thread(
+     libvsgpt_partition_chunks_t *partition_chunks );
+
+int libvsgpt_partition_chunks_process(
+     libvsgpt_partition_chunks_t *partition_chunks,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_PARTITION_CHUNKS_H ) */
+
@@ -0,0 +1,1609 @@
+/*
+ * The partition comparison functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_io_handle.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_partition.h"
+#include "libvsgpt_partition_comparison.h"
+#include "libvsgpt_partition_values.h"
+#include "libvsgpt_types.h"
+
+const uint8_t libvsgpt_partition_comparison_empty_identifier[ 16 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Creates a partition comparison
+ * Make sure the value partition_comparison is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_initialize(
+     libvsgpt_partition_comparison_t **partition_comparison,
+     libvsgpt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_partition_t **partitions,
+     int number_of_partitions,
+     libbfio_handle_t *compare_file_io_handle,
+     libvsgpt_partition_t **compare_partitions,
+     int number_of_compare_partitions,
+     size_t chunk_size,
+     size_t block_size,
+     int (*callback)(
+            int partition_index,
+            int compare_partition_index,
+            off64_t offset,
+            size64_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_comparison_initialize";
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_comparison != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition comparison value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partitions == NULL )
+	 && ( number_of_partitions != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_partitions < 0 )
+	 || ( (size_t) number_of_partitions > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_partitions == NULL )
+	 && ( number_of_compare_partitions != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_compare_partitions < 0 )
+	 || ( (size_t) number_of_compare_partitions > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of compare partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX )
+	 || ( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_comparison = memory_allocate_structure(
+	                         libvsgpt_partition_comparison_t );
+
+	if( *partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition comparison.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *partition_comparison,
+	     0,
+	     sizeof( libvsgpt_partition_comparison_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition comparison.",
+		 function );
+
+		memory_free(
+		 *partition_comparison );
+
+		*partition_comparison = NULL;
+
+		return( -1 );
+	}
+	if( number_of_partitions > 0 )
+	{
+		( *partition_comparison )->compare_partition_indexes = (int *) memory_allocate(
+		                                                        sizeof( int ) * number_of_partitions );
+
+		if( ( *partition_comparison )->compare_partition_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compare partition indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_compare_partitions > 0 )
+	{
+		( *partition_comparison )->compare_partition_is_matched = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * number_of_compare_partitions );
+
+		if( ( *partition_comparison )->compare_partition_is_matched == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compare partition is matched values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *partition_comparison )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *partition_comparison )->io_handle                    = io_handle;
+	( *partition_comparison )->file_io_handle               = file_io_handle;
+	( *partition_comparison )->partitions                   = partitions;
+	( *partition_comparison )->number_of_partitions         = number_of_partitions;
+	( *partition_comparison )->compare_file_io_handle       = compare_file_io_handle;
+	( *partition_comparison )->compare_partitions           = compare_partitions;
+	( *partition_comparison )->number_of_compare_partitions = number_of_compare_partitions;
+	( *partition_comparison )->chunk_size                   = chunk_size;
+	( *partition_comparison )->block_size                   = block_size;
+	( *partition_comparison )->callback                     = callback;
+	( *partition_comparison )->user_data                    = user_data;
+	( *partition_comparison )->deadline                     = libvsgpt_io_handle_get_deadline(
+	                                                           io_handle );
+
+	if( libvsgpt_partition_comparison_match_partitions(
+	     *partition_comparison,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match partitions.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *partition_comparison != NULL )
+	{
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( ( *partition_comparison )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *partition_comparison )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *partition_comparison )->compare_partition_is_matched != NULL )
+		{
+			memory_free(
+			 ( *partition_comparison )->compare_partition_is_matched );
+		}
+		if( ( *partition_comparison )->compare_partition_indexes != NULL )
+		{
+			memory_free(
+			 ( *partition_comparison )->compare_partition_indexes );
+		}
+		memory_free(
+		 *partition_comparison );
+
+		*partition_comparison = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a partition comparison
+ * The partitions are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_free(
+     libvsgpt_partition_comparison_t **partition_comparison,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_comparison_free";
+	int result            = 1;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_comparison != NULL )
+	{
+		if( ( *partition_comparison )->chunk_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *partition_comparison )->chunk_error ) );
+		}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *partition_comparison )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *partition_comparison )->compare_partition_is_matched != NULL )
+		{
+			memory_free(
+			 ( *partition_comparison )->compare_partition_is_matched );
+		}
+		if( ( *partition_comparison )->compare_partition_indexes != NULL )
+		{
+			memory_free(
+			 ( *partition_comparison )->compare_partition_indexes );
+		}
+		memory_free(
+		 *partition_comparison );
+
+		*partition_comparison = NULL;
+	}
+	return( result );
+}
+
+/* Matches the partitions with the partitions of the compare volume
+ * Partitions are matched by identifier, partitions without an identifier,
+ * such as MBR partitions, are matched by entry index
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_match_partitions(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *compare_partition  = NULL;
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_comparison_match_partitions";
+	int compare_partition_index                       = 0;
+	int has_identifier                                = 0;
+	int partition_index                               = 0;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	for( compare_partition_index = 0;
+	     compare_partition_index < partition_comparison->number_of_compare_partitions;
+	     compare_partition_index++ )
+	{
+		partition_comparison->compare_partition_is_matched[ compare_partition_index ] = 0;
+	}
+	for( partition_index = 0;
+	     partition_index < partition_comparison->number_of_partitions;
+	     partition_index++ )
+	{
+		partition_comparison->compare_partition_indexes[ partition_index ] = -1;
+
+		internal_partition = (libvsgpt_internal_partition_t *) partition_comparison->partitions[ partition_index ];
+
+		if( ( internal_partition == NULL )
+		 || ( internal_partition->partition_values == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing partition: %d.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+		has_identifier = memory_compare(
+		                  internal_partition->partition_values->identifier,
+		                  libvsgpt_partition_comparison_empty_identifier,
+		                  16 );
+
+		for( compare_partition_index = 0;
+		     compare_partition_index < partition_comparison->number_of_compare_partitions;
+		     compare_partition_index++ )
+		{
+			if( partition_comparison->compare_partition_is_matched[ compare_partition_index ] != 0 )
+			{
+				continue;
+			}
+			compare_partition = (libvsgpt_internal_partition_t *) partition_comparison->compare_partitions[ compare_partition_index ];
+
+			if( ( compare_partition == NULL )
+			 || ( compare_partition->partition_values == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing compare partition: %d.",
+				 function,
+				 compare_partition_index );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     internal_partition->partition_values->identifier,
+			     compare_partition->partition_values->identifier,
+			     16 ) != 0 )
+			{
+				continue;
+			}
+			if( ( has_identifier == 0 )
+			 && ( internal_partition->partition_values->entry_index != compare_partition->partition_values->entry_index ) )
+			{
+				continue;
+			}
+			partition_comparison->compare_partition_indexes[ partition_index ]            = compare_partition_index;
+			partition_comparison->compare_partition_is_matched[ compare_partition_index ] = 1;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Reports a range of differing data to the callback
+ * The callback is not called concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_report_range(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_comparison_report_range";
+	int result            = 1;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_comparison->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition comparison - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( partition_comparison->callback(
+	     partition_index,
+	     compare_partition_index,
+	     offset,
+	     size,
+	     partition_comparison->user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback failed for range of partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 partition_index,
+		 offset,
+		 offset );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reports the data that has no counterpart in the other volume
+ * This is the data of partitions without a matching partition and
+ * the data beyond the end of the smaller partition of a matching pair
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_report_unmatched_data(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *compare_partition  = NULL;
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_comparison_report_unmatched_data";
+	int compare_partition_index                       = 0;
+	int partition_index                               = 0;
+	int result                                        = 1;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_index = 0;
+	     partition_index < partition_comparison->number_of_partitions;
+	     partition_index++ )
+	{
+		internal_partition      = (libvsgpt_internal_partition_t *) partition_comparison->partitions[ partition_index ];
+		compare_partition_index = partition_comparison->compare_partition_indexes[ partition_index ];
+
+		if( compare_partition_index == -1 )
+		{
+			if( internal_partition->size > 0 )
+			{
+				result = libvsgpt_partition_comparison_report_range(
+				          partition_comparison,
+				          partition_index,
+				          -1,
+				          0,
+				          internal_partition->size,
+				          error );
+			}
+		}
+		else
+		{
+			compare_partition = (libvsgpt_internal_partition_t *) partition_comparison->compare_partitions[ compare_partition_index ];
+
+			if( internal_partition->size > compare_partition->size )
+			{
+				result = libvsgpt_partition_comparison_report_range(
+				          partition_comparison,
+				          partition_index,
+				          compare_partition_index,
+				          (off64_t) compare_partition->size,
+				          internal_partition->size - compare_partition->size,
+				          error );
+			}
+			else if( internal_partition->size < compare_partition->size )
+			{
+				result = libvsgpt_partition_comparison_report_range(
+				          partition_comparison,
+				          partition_index,
+				          compare_partition_index,
+				          (off64_t) internal_partition->size,
+				          compare_partition->size - internal_partition->size,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report unmatched data of partition: %d.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+	}
+	for( compare_partition_index = 0;
+	     compare_partition_index < partition_comparison->number_of_compare_partitions;
+	     compare_partition_index++ )
+	{
+		if( partition_comparison->compare_partition_is_matched[ compare_partition_index ] != 0 )
+		{
+			continue;
+		}
+		compare_partition = (libvsgpt_internal_partition_t *) partition_comparison->compare_partitions[ compare_partition_index ];
+
+		if( compare_partition->size == 0 )
+		{
+			continue;
+		}
+		if( libvsgpt_partition_comparison_report_range(
+		     partition_comparison,
+		     -1,
+		     compare_partition_index,
+		     0,
+		     compare_partition->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report unmatched data of compare partition: %d.",
+			 function,
+			 compare_partition_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the next chunk to compare
+ * A chunk covers the same offset of a pair of matching partitions and
+ * is limited to the size of the smaller partition of the pair
+ * Returns 1 if successful, 0 if no more chunks are available or -1 on error
+ */
+int libvsgpt_partition_comparison_get_next_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int *partition_index,
+     int *compare_partition_index,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *compare_partition  = NULL;
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_comparison_get_next_chunk";
+	size64_t compared_size                            = 0;
+	size64_t remaining_size                           = 0;
+	int matching_partition_index                      = 0;
+	int result                                        = 0;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare partition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( partition_comparison->is_stopped == 0 )
+	    && ( partition_comparison->next_partition_index < partition_comparison->number_of_partitions ) )
+	{
+		matching_partition_index = partition_comparison->compare_partition_indexes[ partition_comparison->next_partition_index ];
+
+		if( matching_partition_index != -1 )
+		{
+			internal_partition = (libvsgpt_internal_partition_t *) partition_comparison->partitions[ partition_comparison->next_partition_index ];
+			compare_partition  = (libvsgpt_internal_partition_t *) partition_comparison->compare_partitions[ matching_partition_index ];
+
+			compared_size = internal_partition->size;
+
+			if( compared_size > compare_partition->size )
+			{
+				compared_size = compare_partition->size;
+			}
+			if( (size64_t) partition_comparison->next_offset < compared_size )
+			{
+				remaining_size = compared_size - (size64_t) partition_comparison->next_offset;
+
+				*partition_index         = partition_comparison->next_partition_index;
+				*compare_partition_index = matching_partition_index;
+				*offset                  = partition_comparison->next_offset;
+				*size                    = partition_comparison->chunk_size;
+
+				if( (size64_t) *size > remaining_size )
+				{
+					*size = (size_t) remaining_size;
+				}
+				partition_comparison->next_offset += (off64_t) *size;
+
+				result = 1;
+
+				break;
+			}
+		}
+		partition_comparison->next_partition_index += 1;
+		partition_comparison->next_offset           = 0;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stops comparing the chunks
+ * The chunk error of the first chunk that failed is retained, other chunk errors are freed
+ * The chunk error can be NULL to stop processing without an error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_stop(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **chunk_error,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_comparison_stop";
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	partition_comparison->is_stopped = 1;
+
+	if( ( chunk_error != NULL )
+	 && ( partition_comparison->chunk_error == NULL ) )
+	{
+		partition_comparison->chunk_error = *chunk_error;
+		*chunk_error                      = NULL;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     partition_comparison->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( chunk_error != NULL )
+	 && ( *chunk_error != NULL ) )
+	{
+		libcerror_error_free(
+		 chunk_error );
+	}
+	return( 1 );
+}
+
+/* Compares the data of a chunk with the data of the compare chunk
+ * The data is compared per block, so that only the blocks that differ are scanned for
+ * the first and last differing byte. Differing bytes that are separated by less than
+ * a block of equal data are reported as a single range
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_compare_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int partition_index,
+     int compare_partition_index,
+     off64_t chunk_offset,
+     const uint8_t *data,
+     const uint8_t *compare_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_comparison_compare_chunk";
+	size_t block_offset   = 0;
+	size_t block_size     = 0;
+	size_t byte_index     = 0;
+	size_t range_end      = 0;
+	size_t range_start    = 0;
+	uint8_t in_range      = 0;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_comparison->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition comparison - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid chunk offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Most chunks are expected to be equal, in which case a single comparison of
+	 * the entire chunk suffices
+	 */
+	if( memory_compare(
+	     data,
+	     compare_data,
+	     data_size ) == 0 )
+	{
+		return( 1 );
+	}
+	while( block_offset < data_size )
+	{
+		block_size = partition_comparison->block_size;
+
+		if( block_size > ( data_size - block_offset ) )
+		{
+			block_size = data_size - block_offset;
+		}
+		if( memory_compare(
+		     &( data[ block_offset ] ),
+		     &( compare_data[ block_offset ] ),
+		     block_size ) != 0 )
+		{
+			if( in_range == 0 )
+			{
+				for( byte_index = block_offset;
+				     byte_index < block_offset + block_size;
+				     byte_index++ )
+				{
+					if( data[ byte_index ] != compare_data[ byte_index ] )
+					{
+						break;
+					}
+				}
+				range_start = byte_index;
+				in_range    = 1;
+			}
+			for( byte_index = block_offset + block_size;
+			     byte_index > block_offset;
+			     byte_index-- )
+			{
+				if( data[ byte_index - 1 ] != compare_data[ byte_index - 1 ] )
+				{
+					break;
+				}
+			}
+			range_end = byte_index;
+		}
+		else if( in_range != 0 )
+		{
+			if( libvsgpt_partition_comparison_report_range(
+			     partition_comparison,
+			     partition_index,
+			     compare_partition_index,
+			     chunk_offset + (off64_t) range_start,
+			     (size64_t) ( range_end - range_start ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to report range.",
+				 function );
+
+				return( -1 );
+			}
+			in_range = 0;
+		}
+		block_offset += block_size;
+	}
+	if( in_range != 0 )
+	{
+		if( libvsgpt_partition_comparison_report_range(
+		     partition_comparison,
+		     partition_index,
+		     compare_partition_index,
+		     chunk_offset + (off64_t) range_start,
+		     (size64_t) ( range_end - range_start ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the data of a chunk of a partition
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_partition_comparison_read_chunk(
+         libvsgpt_partition_t *partition,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t chunk_size,
+         off64_t chunk_offset,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsgpt_partition_comparison_read_chunk";
+	ssize_t read_count                                = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsgpt_internal_partition_t *) partition;
+
+	/* The partition is not locked since the chunk is read without
+	 * changing the current offset of the partition
+	 */
+	if( internal_partition->data != NULL )
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+		              internal_partition,
+		              buffer,
+		              chunk_size,
+		              chunk_offset,
+		              error );
+	}
+	else
+	{
+		/* The chunk is read directly using the file IO handle of the thread
+		 * since it would otherwise evict the sectors cached by the partition
+		 */
+		read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+		              internal_partition,
+		              file_io_handle,
+		              buffer,
+		              chunk_size,
+		              chunk_offset,
+		              error );
+	}
+	return( read_count );
+}
+
+/* Compares chunks until no more chunks are available
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_process_chunks(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *compare_file_io_handle,
+     uint8_t *buffer,
+     uint8_t *compare_buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libvsgpt_partition_comparison_process_chunks";
+	size_t chunk_size           = 0;
+	ssize_t read_count          = 0;
+	off64_t chunk_offset        = 0;
+	int compare_partition_index = 0;
+	int partition_index         = 0;
+	int result                  = 0;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size < partition_comparison->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libvsgpt_io_handle_check_abort(
+		     partition_comparison->io_handle,
+		     partition_comparison->deadline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to continue comparing chunks.",
+			 function );
+
+			return( -1 );
+		}
+		result = libvsgpt_partition_comparison_get_next_chunk(
+		          partition_comparison,
+		          &partition_index,
+		          &compare_partition_index,
+		          &chunk_offset,
+		          &chunk_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next chunk.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			read_count = libvsgpt_partition_comparison_read_chunk(
+			              partition_comparison->partitions[ partition_index ],
+			              file_io_handle,
+			              buffer,
+			              chunk_size,
+			              chunk_offset,
+			              error );
+
+			if( read_count != (ssize_t) chunk_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk of partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 partition_index,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+			read_count = libvsgpt_partition_comparison_read_chunk(
+			              partition_comparison->compare_partitions[ compare_partition_index ],
+			              compare_file_io_handle,
+			              compare_buffer,
+			              chunk_size,
+			              chunk_offset,
+			              error );
+
+			if( read_count != (ssize_t) chunk_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk of compare partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 compare_partition_index,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+			if( libvsgpt_partition_comparison_compare_chunk(
+			     partition_comparison,
+			     partition_index,
+			     compare_partition_index,
+			     chunk_offset,
+			     buffer,
+			     compare_buffer,
+			     chunk_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare chunk of partition: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 partition_index,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+}
+
+/* Compares chunks in a separate thread
+ * Callback function for the partition comparison threads
+ * An error is retained in the partition comparison and stops the other threads
+ * Returns 1
+ */
+int libvsgpt_partition_comparison_process_thread(
+     libvsgpt_partition_comparison_t *partition_comparison )
+{
+	libbfio_handle_t *compare_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	uint8_t *buffer                          = NULL;
+	uint8_t *compare_buffer                  = NULL;
+	static char *function                    = "libvsgpt_partition_comparison_process_thread";
+	int compare_result                       = 0;
+	int result                               = 0;
+
+	if( partition_comparison == NULL )
+	{
+		return( 1 );
+	}
+	/* Every thread reads using its own clones of the file IO handles so that
+	 * reads from different threads do not contend on shared file IO handles
+	 */
+	if( partition_comparison->file_io_handle != NULL )
+	{
+		result = libvsgpt_partition_clone_file_io_handle(
+		          &file_io_handle,
+		          partition_comparison->file_io_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle.",
+			 function );
+		}
+		else if( result == 0 )
+		{
+			file_io_handle = partition_comparison->file_io_handle;
+		}
+	}
+	if( ( error == NULL )
+	 && ( partition_comparison->compare_file_io_handle != NULL ) )
+	{
+		compare_result = libvsgpt_partition_clone_file_io_handle(
+		                  &compare_file_io_handle,
+		                  partition_comparison->compare_file_io_handle,
+		                  &error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone compare file IO handle.",
+			 function );
+		}
+		else if( compare_result == 0 )
+		{
+			compare_file_io_handle = partition_comparison->compare_file_io_handle;
+		}
+	}
+	if( error == NULL )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * partition_comparison->chunk_size );
+
+		compare_buffer = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * partition_comparison->chunk_size );
+
+		if( ( buffer == NULL )
+		 || ( compare_buffer == NULL ) )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffers.",
+			 function );
+		}
+		else
+		{
+			libvsgpt_partition_comparison_process_chunks(
+			 partition_comparison,
+			 file_io_handle,
+			 compare_file_io_handle,
+			 buffer,
+			 compare_buffer,
+			 partition_comparison->chunk_size,
+			 &error );
+		}
+		if( compare_buffer != NULL )
+		{
+			memory_free(
+			 compare_buffer );
+		}
+		if( buffer != NULL )
+		{
+			memory_free(
+			 buffer );
+		}
+	}
+	if( compare_result == 1 )
+	{
+		libbfio_handle_close(
+		 compare_file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &compare_file_io_handle,
+		 NULL );
+	}
+	if( result == 1 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		if( libvsgpt_partition_comparison_stop(
+		     partition_comparison,
+		     &error,
+		     NULL ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares the data of the matching partitions
+ * The data that has no counterpart in the other volume is reported first,
+ * the ranges of differing data of the matching partitions are reported as
+ * the chunks are compared and are not reported in a specific order
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_comparison_process(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS ];
+
+	int thread_index      = 0;
+#endif
+
+	static char *function = "libvsgpt_partition_comparison_process";
+	int result            = 1;
+
+	if( partition_comparison == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition comparison.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_comparison_report_unmatched_data(
+	     partition_comparison,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to report unmatched data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS )
+	{
+		number_of_threads = LIBVSGPT_MAXIMUM_NUMBER_OF_PARTITION_CHUNKS_THREADS;
+	}
+	if( number_of_threads > 1 )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			threads[ thread_index ] = NULL;
+
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libvsgpt_partition_comparison_process_thread,
+			     (void *) partition_comparison,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				/* Stop the threads that were already created
+				 */
+				libvsgpt_partition_comparison_stop(
+				 partition_comparison,
+				 NULL,
+				 NULL );
+
+				number_of_threads = thread_index;
+				result            = -1;
+
+				break;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+	{
+		libvsgpt_partition_comparison_process_thread(
+		 partition_comparison );
+	}
+	if( partition_comparison->chunk_error != NULL )
+	{
+		/* Pass the error of the chunk that failed on to the caller,
+		 * so that the caller can determine why comparing stopped
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = partition_comparison->chunk_error;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &( partition_comparison->chunk_error ) );
+		}
+		partition_comparison->chunk_error = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare chunks.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
@@ -0,0 +1,221 @@
+/*
+ * The partition comparison functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_PARTITION_COMPARISON_H )
+#define _LIBVSGPT_PARTITION_COMPARISON_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_io_handle.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_partition_comparison libvsgpt_partition_comparison_t;
+
+struct libvsgpt_partition_comparison
+{
+	/* The IO handle
+	 */
+	libvsgpt_io_handle_t *io_handle;
+
+	/* The file IO handle of the volume
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The partitions
+	 */
+	libvsgpt_partition_t **partitions;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The file IO handle of the compare volume
+	 */
+	libbfio_handle_t *compare_file_io_handle;
+
+	/* The partitions of the compare volume
+	 */
+	libvsgpt_partition_t **compare_partitions;
+
+	/* The number of partitions of the compare volume
+	 */
+	int number_of_compare_partitions;
+
+	/* The index of the matching compare partition per partition, where -1 represents no match
+	 */
+	int *compare_partition_indexes;
+
+	/* Value per compare partition to indicate it matches a partition
+	 */
+	uint8_t *compare_partition_is_matched;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The callback function
+	 */
+	int (*callback)(
+	       int partition_index,
+	       int compare_partition_index,
+	       off64_t offset,
+	       size64_t size,
+	       void *user_data,
+	       libcerror_error_t **error );
+
+	/* The callback user data
+	 */
+	void *user_data;
+
+	/* The deadline in microseconds, where 0 represents no deadline
+	 */
+	int64_t deadline;
+
+	/* The index of the partition of the next chunk
+	 */
+	int next_partition_index;
+
+	/* The offset of the next chunk relative to the start of the partition
+	 */
+	off64_t next_offset;
+
+	/* Value to indicate processing has stopped
+	 */
+	uint8_t is_stopped;
+
+	/* The error of the first chunk that failed
+	 */
+	libcerror_error_t *chunk_error;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libvsgpt_partition_comparison_initialize(
+     libvsgpt_partition_comparison_t **partition_comparison,
+     libvsgpt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_partition_t **partitions,
+     int number_of_partitions,
+     libbfio_handle_t *compare_file_io_handle,
+     libvsgpt_partition_t **compare_partitions,
+     int number_of_compare_partitions,
+     size_t chunk_size,
+     size_t block_size,
+     int (*callback)(
+            int partition_index,
+            int compare_partition_index,
+            off64_t offset,
+            size64_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_free(
+     libvsgpt_partition_comparison_t **partition_comparison,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_match_partitions(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_report_range(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_report_unmatched_data(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_get_next_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int *partition_index,
+     int *compare_partition_index,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_stop(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libcerror_error_t **chunk_error,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_compare_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int partition_index,
+     int compare_partition_index,
+     off64_t chunk_offset,
+     const uint8_t *data,
+     const uint8_t *compare_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+ssize_t libvsgpt_partition_comparison_read_chunk(
+         libvsgpt_partition_t *partition,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t chunk_size,
+         off64_t chunk_offset,
+         libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_process_chunks(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *compare_file_io_handle,
+     uint8_t *buffer,
+     uint8_t *compare_buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_comparison_process_thread(
+     libvsgpt_partition_comparison_t *partition_comparison );
+
+int libvsgpt_partition_comparison_process(
+     libvsgpt_partition_comparison_t *partition_comparison,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_PARTITION_COMPARISON_H ) */
+
@@ -0,0 +1,737 @@
+/*
+ * The partition cursor functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_partition.h"
+#include "libvsgpt_partition_cursor.h"
+#include "libvsgpt_types.h"
+
+/* Creates a partition cursor
+ * Make sure the value partition_cursor is referencing, is set to NULL
+ * The partition cursor has its own current offset and file IO handle but shares the data
+ * and sectors cache of the partition, the partition must remain available while the cursor is used
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_cursor_initialize(
+     libvsgpt_partition_cursor_t **partition_cursor,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_initialize";
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition_cursor = memory_allocate_structure(
+	                             libvsgpt_internal_partition_cursor_t );
+
+	if( internal_partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_partition_cursor,
+	     0,
+	     sizeof( libvsgpt_internal_partition_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition cursor.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_partition_cursor->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_partition_cursor->internal_partition = (libvsgpt_internal_partition_t *) partition;
+
+	*partition_cursor = (libvsgpt_partition_cursor_t *) internal_partition_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_partition_cursor != NULL )
+	{
+		memory_free(
+		 internal_partition_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a partition cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_cursor_free(
+     libvsgpt_partition_cursor_t **partition_cursor,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_free";
+	int result                                                      = 1;
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_cursor != NULL )
+	{
+		internal_partition_cursor = (libvsgpt_internal_partition_cursor_t *) *partition_cursor;
+		*partition_cursor         = NULL;
+
+		/* The internal_partition reference is freed elsewhere
+		 */
+		if( internal_partition_cursor->file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     internal_partition_cursor->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( internal_partition_cursor->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_partition_cursor->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_partition_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves the file IO handle to read the partition data
+ * The file IO handle of the volume is cloned on the first call, so that reads
+ * from different cursors of the same partition do not contend on the offset and
+ * lock of a shared file IO handle. If it cannot be cloned the file IO handle of
+ * the partition is used
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_partition_cursor_get_file_io_handle(
+     libvsgpt_internal_partition_cursor_t *internal_partition_cursor,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_partition_cursor_get_file_io_handle";
+	int result            = 0;
+
+	if( internal_partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition_cursor->internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition cursor - missing partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_partition_cursor->file_io_handle == NULL )
+	 && ( internal_partition_cursor->internal_partition->volume_file_io_handle != NULL ) )
+	{
+		result = libvsgpt_partition_clone_file_io_handle(
+		          &( internal_partition_cursor->file_io_handle ),
+		          internal_partition_cursor->internal_partition->volume_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libvsgpt_internal_partition_get_file_io_handle(
+			     internal_partition_cursor->internal_partition,
+			     &( internal_partition_cursor->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_partition_cursor->file_io_handle_created_in_library = (uint8_t) result;
+	}
+	*file_io_handle = internal_partition_cursor->file_io_handle;
+
+	return( 1 );
+}
+
+/* Reads (partition) data at a specific offset into a buffer
+ * The current offset of the partition cursor is not changed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_internal_partition_cursor_read_buffer_at_offset(
+         libvsgpt_internal_partition_cursor_t *internal_partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_t *internal_partition = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	static char *function                             = "libvsgpt_internal_partition_cursor_read_buffer_at_offset";
+	ssize_t read_count                                = 0;
+
+	if( internal_partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition_cursor->internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition cursor - missing partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = internal_partition_cursor->internal_partition;
+
+	/* The partition is not locked since the volume data is not modified,
+	 * the sector cache locks its own shards and the cursor reads using its
+	 * own clone of the file IO handle
+	 */
+	if( internal_partition->data != NULL )
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_data(
+		              internal_partition,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else if( libvsgpt_internal_partition_cursor_get_file_io_handle(
+	          internal_partition_cursor,
+	          &file_io_handle,
+	          error ) != 1 )
+	{
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+		              internal_partition,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from partition at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads (partition) data at the current offset of the partition cursor into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_partition_cursor_read_buffer(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_read_buffer";
+	ssize_t read_count                                              = 0;
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition_cursor = (libvsgpt_internal_partition_cursor_t *) partition_cursor;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libvsgpt_internal_partition_cursor_read_buffer_at_offset(
+	              internal_partition_cursor,
+	              buffer,
+	              buffer_size,
+	              internal_partition_cursor->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_partition_cursor->current_offset += (off64_t) read_count;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads (partition) data at a specific offset
+ * The current offset of the partition cursor is set to the end of the data read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_partition_cursor_read_buffer_at_offset(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_read_buffer_at_offset";
+	ssize_t read_count                                              = 0;
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition_cursor = (libvsgpt_internal_partition_cursor_t *) partition_cursor;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libvsgpt_internal_partition_cursor_read_buffer_at_offset(
+	              internal_partition_cursor,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_partition_cursor->current_offset = offset + (off64_t) read_count;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Seeks a certain offset of the (partition) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libvsgpt_partition_cursor_seek_offset(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_seek_offset";
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition_cursor = (libvsgpt_internal_partition_cursor_t *) partition_cursor;
+
+	if( internal_partition_cursor->internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition cursor - missing partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The partition size is not changed after the partition was created
+	 */
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_partition_cursor->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_partition_cursor->internal_partition->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		offset = -1;
+	}
+	else
+	{
+		internal_partition_cursor->current_offset = offset;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the partition cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_cursor_get_offset(
+     libvsgpt_partition_cursor_t *partition_cursor,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_partition_cursor_t *internal_partition_cursor = NULL;
+	static char *function                                           = "libvsgpt_partition_cursor_get_offset";
+
+	if( partition_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition_cursor = (libvsgpt_internal_partition_cursor_t *) partition_cursor;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_partition_cursor->current_offset;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_partition_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * The partition cursor functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBVSGPT_PARTITION_CURSOR_H )
+#define _LIBVSGPT_PARTITION_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_extern.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_partition.h"
+#include "libvsgpt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_internal_partition_cursor libvsgpt_internal_partition_cursor_t;
+
+struct libvsgpt_internal_partition_cursor
+{
+	/* The partition
+	 */
+	libvsgpt_internal_partition_t *internal_partition;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The file IO handle, cloned on the first read
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBVSGPT_EXTERN \
+int libvsgpt_partition_cursor_initialize(
+     libvsgpt_partition_cursor_t **partition_cursor,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_partition_cursor_free(
+     libvsgpt_partition_cursor_t **partition_cursor,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_partition_cursor_get_file_io_handle(
+     libvsgpt_internal_partition_cursor_t *internal_partition_cursor,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libvsgpt_internal_partition_cursor_read_buffer_at_offset(
+         libvsgpt_internal_partition_cursor_t *internal_partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+ssize_t libvsgpt_partition_cursor_read_buffer(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+ssize_t libvsgpt_partition_cursor_read_buffer_at_offset(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+off64_t libvsgpt_partition_cursor_seek_offset(
+         libvsgpt_partition_cursor_t *partition_cursor,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_partition_cursor_get_offset(
+     libvsgpt_partition_cursor_t *partition_cursor,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_PARTITION_CURSOR_H ) */
+
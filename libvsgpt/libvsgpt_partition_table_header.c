@@ -137,6 +137,49 @@ int libvsgpt_partition_table_header_free(
 	return( 1 );
 }
 
+/* Checks if data contains a partition table header signature
+ * Returns 1 if the signature matches, 0 if not or -1 on error
+ */
+int libvsgpt_partition_table_header_check_signature(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_table_header_check_signature";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (vsgpt_partition_table_header_t *) data )->signature,
+	     "EFI PART",
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Reads a partition table header
  * Returns 1 if successful, 0 if signature does not match or -1 on error
  */
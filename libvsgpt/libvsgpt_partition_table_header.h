@@ -85,6 +85,11 @@ int libvsgpt_partition_table_header_free(
      libvsgpt_partition_table_header_t **partition_table_header,
      libcerror_error_t **error );
 
+int libvsgpt_partition_table_header_check_signature(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libvsgpt_partition_table_header_read_data(
      libvsgpt_partition_table_header_t *partition_table_header,
      const uint8_t *data,
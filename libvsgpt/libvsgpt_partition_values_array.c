@@ -0,0 +1,544 @@
+/*
+ * The partition values array functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_partition_values.h"
+#include "libvsgpt_partition_values_array.h"
+
+/* The size of the data of a single partition values array element
+ */
+#define LIBVSGPT_PARTITION_VALUES_ARRAY_ELEMENT_SIZE \
+	( sizeof( libvsgpt_partition_values_t ) + sizeof( off64_t ) + sizeof( size64_t ) + sizeof( uint32_t ) )
+
+/* Creates a partition values array
+ * Make sure the value partition_values_array is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_initialize(
+     libvsgpt_partition_values_array_t **partition_values_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_initialize";
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_values_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition values array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_values_array = memory_allocate_structure(
+	                           libvsgpt_partition_values_array_t );
+
+	if( *partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition values array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *partition_values_array,
+	     0,
+	     sizeof( libvsgpt_partition_values_array_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition values array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *partition_values_array != NULL )
+	{
+		memory_free(
+		 *partition_values_array );
+
+		*partition_values_array = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a partition values array
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_free(
+     libvsgpt_partition_values_array_t **partition_values_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_free";
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_values_array != NULL )
+	{
+		if( ( *partition_values_array )->data != NULL )
+		{
+			memory_free(
+			 ( *partition_values_array )->data );
+		}
+		memory_free(
+		 *partition_values_array );
+
+		*partition_values_array = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a partition values array and frees its data
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_empty(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_empty";
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values_array->data != NULL )
+	{
+		memory_free(
+		 partition_values_array->data );
+	}
+	partition_values_array->data                     = NULL;
+	partition_values_array->values                   = NULL;
+	partition_values_array->offsets                  = NULL;
+	partition_values_array->sizes                    = NULL;
+	partition_values_array->entry_indexes            = NULL;
+	partition_values_array->number_of_values         = 0;
+	partition_values_array->maximum_number_of_values = 0;
+
+	return( 1 );
+}
+
+/* Resizes a partition values array
+ * The values, offsets, sizes and entry indexes are stored in a single allocation
+ * Note that resizing invalidates previously retrieved partition values
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_resize(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_values_t *values = NULL;
+	uint32_t *entry_indexes             = NULL;
+	uint8_t *data                       = NULL;
+	size64_t *sizes                     = NULL;
+	off64_t *offsets                    = NULL;
+	static char *function               = "libvsgpt_partition_values_array_resize";
+	size_t data_size                    = 0;
+	int number_of_values                = 0;
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values <= 0 )
+	 || ( (size_t) maximum_number_of_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBVSGPT_PARTITION_VALUES_ARRAY_ELEMENT_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_values == partition_values_array->maximum_number_of_values )
+	{
+		return( 1 );
+	}
+	number_of_values = partition_values_array->number_of_values;
+
+	if( number_of_values > maximum_number_of_values )
+	{
+		number_of_values = maximum_number_of_values;
+	}
+	data_size = (size_t) maximum_number_of_values * LIBVSGPT_PARTITION_VALUES_ARRAY_ELEMENT_SIZE;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	values        = (libvsgpt_partition_values_t *) data;
+	offsets       = (off64_t *) &( values[ maximum_number_of_values ] );
+	sizes         = (size64_t *) &( offsets[ maximum_number_of_values ] );
+	entry_indexes = (uint32_t *) &( sizes[ maximum_number_of_values ] );
+
+	if( number_of_values > 0 )
+	{
+		if( ( memory_copy(
+		       values,
+		       partition_values_array->values,
+		       sizeof( libvsgpt_partition_values_t ) * number_of_values ) == NULL )
+		 || ( memory_copy(
+		       offsets,
+		       partition_values_array->offsets,
+		       sizeof( off64_t ) * number_of_values ) == NULL )
+		 || ( memory_copy(
+		       sizes,
+		       partition_values_array->sizes,
+		       sizeof( size64_t ) * number_of_values ) == NULL )
+		 || ( memory_copy(
+		       entry_indexes,
+		       partition_values_array->entry_indexes,
+		       sizeof( uint32_t ) * number_of_values ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			memory_free(
+			 data );
+
+			return( -1 );
+		}
+	}
+	if( partition_values_array->data != NULL )
+	{
+		memory_free(
+		 partition_values_array->data );
+	}
+	partition_values_array->data                     = data;
+	partition_values_array->values                   = values;
+	partition_values_array->offsets                  = offsets;
+	partition_values_array->sizes                    = sizes;
+	partition_values_array->entry_indexes            = entry_indexes;
+	partition_values_array->number_of_values         = number_of_values;
+	partition_values_array->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+}
+
+/* Appends a copy of partition values to the partition values array
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_append_values(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     const libvsgpt_partition_values_t *partition_values,
+     int *values_index,
+     libcerror_error_t **error )
+{
+	static char *function        = "libvsgpt_partition_values_array_append_values";
+	int maximum_number_of_values = 0;
+	int safe_values_index        = 0;
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values index.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values_array->number_of_values >= partition_values_array->maximum_number_of_values )
+	{
+		if( partition_values_array->maximum_number_of_values == 0 )
+		{
+			maximum_number_of_values = 16;
+		}
+		else if( partition_values_array->maximum_number_of_values > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid partition values array - maximum number of values value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			maximum_number_of_values = partition_values_array->maximum_number_of_values * 2;
+		}
+		if( libvsgpt_partition_values_array_resize(
+		     partition_values_array,
+		     maximum_number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize partition values array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_values_index = partition_values_array->number_of_values;
+
+	if( memory_copy(
+	     &( partition_values_array->values[ safe_values_index ] ),
+	     partition_values,
+	     sizeof( libvsgpt_partition_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy partition values.",
+		 function );
+
+		return( -1 );
+	}
+	partition_values_array->offsets[ safe_values_index ]       = partition_values->offset;
+	partition_values_array->sizes[ safe_values_index ]         = partition_values->size;
+	partition_values_array->entry_indexes[ safe_values_index ] = partition_values->entry_index;
+
+	partition_values_array->number_of_values += 1;
+
+	*values_index = safe_values_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_get_number_of_values(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_get_number_of_values";
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = partition_values_array->number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves specific partition values
+ * The partition values are owned by the array and remain valid until it is resized or emptied
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_partition_values_array_get_values_by_index(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int values_index,
+     libvsgpt_partition_values_t **partition_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_get_values_by_index";
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( values_index < 0 )
+	 || ( values_index >= partition_values_array->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid values index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_values = &( partition_values_array->values[ values_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the partition values with the corresponding (partition) entry index
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libvsgpt_partition_values_array_get_index_by_entry_index(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     uint32_t entry_index,
+     int *values_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_partition_values_array_get_index_by_entry_index";
+	int safe_values_index = 0;
+
+	if( partition_values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values index.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_values_index = 0;
+	     safe_values_index < partition_values_array->number_of_values;
+	     safe_values_index++ )
+	{
+		if( partition_values_array->entry_indexes[ safe_values_index ] == entry_index )
+		{
+			*values_index = safe_values_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * The partition values array functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSGPT_PARTITION_VALUES_ARRAY_H )
+#define _LIBVSGPT_PARTITION_VALUES_ARRAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_partition_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_partition_values_array libvsgpt_partition_values_array_t;
+
+struct libvsgpt_partition_values_array
+{
+	/* The data, which contains the values, offsets, sizes and entry indexes
+	 */
+	uint8_t *data;
+
+	/* The partition values
+	 */
+	libvsgpt_partition_values_t *values;
+
+	/* The partition offsets
+	 */
+	off64_t *offsets;
+
+	/* The partition sizes
+	 */
+	size64_t *sizes;
+
+	/* The partition entry indexes
+	 */
+	uint32_t *entry_indexes;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The maximum number of values
+	 */
+	int maximum_number_of_values;
+};
+
+int libvsgpt_partition_values_array_initialize(
+     libvsgpt_partition_values_array_t **partition_values_array,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_free(
+     libvsgpt_partition_values_array_t **partition_values_array,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_empty(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_resize(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_append_values(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     const libvsgpt_partition_values_t *partition_values,
+     int *values_index,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_get_number_of_values(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_get_values_by_index(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     int values_index,
+     libvsgpt_partition_values_t **partition_values,
+     libcerror_error_t **error );
+
+int libvsgpt_partition_values_array_get_index_by_entry_index(
+     libvsgpt_partition_values_array_t *partition_values_array,
+     uint32_t entry_index,
+     int *values_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_PARTITION_VALUES_ARRAY_H ) */
+
@@ -0,0 +1,1024 @@
+/*
+ * The sector cache functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_sector_cache.h"
+#include "libvsgpt_sector_data.h"
+
+/* Creates a sector cache
+ * Make sure the value sector_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_sector_cache_initialize(
+     libvsgpt_sector_cache_t **sector_cache,
+     off64_t data_offset,
+     size64_t data_size,
+     size_t sector_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_sector_cache_initialize";
+	int entry_index       = 0;
+	int shard_index       = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size == 0 )
+	 || ( sector_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_cache = memory_allocate_structure(
+	                 libvsgpt_sector_cache_t );
+
+	if( *sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_cache,
+	     0,
+	     sizeof( libvsgpt_sector_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector cache.",
+		 function );
+
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		for( entry_index = 0;
+		     entry_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES;
+		     entry_index++ )
+		{
+			( *sector_cache )->shards[ shard_index ].entries_offsets[ entry_index ] = -1;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+			( *sector_cache )->shards[ shard_index ].in_flight_offsets[ entry_index ] = -1;
+#endif
+		}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_initialize(
+		     &( ( *sector_cache )->shards[ shard_index ].read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize read/write lock of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( ( *sector_cache )->shards[ shard_index ].in_flight_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize in flight mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *sector_cache )->shards[ shard_index ].in_flight_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize in flight condition of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	( *sector_cache )->data_offset = data_offset;
+	( *sector_cache )->data_size   = data_size;
+	( *sector_cache )->sector_size = sector_size;
+
+	return( 1 );
+
+on_error:
+	if( *sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 sector_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a sector cache
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_sector_cache_free(
+     libvsgpt_sector_cache_t **sector_cache,
+     libcerror_error_t **error )
+{
+	libvsgpt_sector_cache_shard_t *shard = NULL;
+	static char *function                = "libvsgpt_sector_cache_free";
+	int entry_index                      = 0;
+	int result                           = 1;
+	int shard_index                      = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		for( shard_index = 0;
+		     shard_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			shard = &( ( *sector_cache )->shards[ shard_index ] );
+
+			for( entry_index = 0;
+			     entry_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES;
+			     entry_index++ )
+			{
+				if( shard->entries[ entry_index ] != NULL )
+				{
+					if( libvsgpt_sector_data_free(
+					     &( shard->entries[ entry_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free sector data: %d of shard: %d.",
+						 function,
+						 entry_index,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+			}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_free(
+			     &( shard->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_free(
+			     &( shard->in_flight_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free in flight mutex of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+			if( libcthreads_condition_free(
+			     &( shard->in_flight_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free in flight condition of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#endif
+		}
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+	}
+	return( result );
+}
+
+/* Copies data of a cached sector of a shard into a buffer
+ * Returns 1 if successful, 0 if the sector is not cached or -1 on error
+ */
+int libvsgpt_sector_cache_copy_from_shard(
+     libvsgpt_sector_cache_shard_t *shard,
+     int entry_index,
+     off64_t sector_offset,
+     size_t sector_data_offset,
+     uint8_t *buffer,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_sector_cache_copy_from_shard";
+	int result            = 0;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shard->entries_offsets[ entry_index ] == sector_offset )
+	{
+		if( memory_copy(
+		     buffer,
+		     &( ( shard->entries[ entry_index ] )->data[ sector_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+/* Marks the read of an entry of a shard as no longer in flight and wakes the waiting threads
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_sector_cache_clear_in_flight(
+     libvsgpt_sector_cache_shard_t *shard,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_sector_cache_clear_in_flight";
+	int result            = 1;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     shard->in_flight_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab in flight mutex.",
+		 function );
+
+		return( -1 );
+	}
+	shard->in_flight_offsets[ entry_index ] = -1;
+
+	if( libcthreads_condition_broadcast(
+	     shard->in_flight_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast in flight condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     shard->in_flight_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release in flight mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
+/* Reads data at a specific offset relative to the start of the data into a buffer
+ * At most the remainder of the sector that contains the offset is read
+ * The shard of the sector is only locked for reading when the sector is cached,
+ * so readers of cached sectors do not block each other
+ * When multiple threads miss on the same sector only one of them reads the sector,
+ * the others wait for the result
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsgpt_sector_cache_read_buffer_at_offset(
+         libvsgpt_sector_cache_t *sector_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsgpt_sector_cache_shard_t *shard         = NULL;
+	libvsgpt_sector_data_t *previous_sector_data = NULL;
+	libvsgpt_sector_data_t *sector_data          = NULL;
+	static char *function                        = "libvsgpt_sector_cache_read_buffer_at_offset";
+	off64_t sector_offset                        = 0;
+	uint64_t sector_index                        = 0;
+	size_t read_size                             = 0;
+	size_t sector_data_offset                    = 0;
+	int entry_index                              = 0;
+	int result                                   = 0;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	int is_deduplicated                          = 0;
+	int is_in_flight                             = 0;
+#endif
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->sector_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) offset >= sector_cache->data_size )
+	 || ( buffer_size == 0 ) )
+	{
+		return( 0 );
+	}
+	sector_index       = (uint64_t) offset / sector_cache->sector_size;
+	sector_offset      = (off64_t) ( sector_index * sector_cache->sector_size );
+	sector_data_offset = (size_t) ( offset - sector_offset );
+	read_size          = sector_cache->sector_size - sector_data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( (size64_t) read_size > ( sector_cache->data_size - offset ) )
+	{
+		read_size = (size_t) ( sector_cache->data_size - offset );
+	}
+	/* Consecutive sectors are distributed over the shards
+	 */
+	shard       = &( sector_cache->shards[ sector_index % LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS ] );
+	entry_index = (int) ( ( sector_index / LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS ) % LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES );
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	while( is_in_flight == 0 )
+	{
+#endif
+		result = libvsgpt_sector_cache_copy_from_shard(
+		          shard,
+		          entry_index,
+		          sector_offset,
+		          sector_data_offset,
+		          buffer,
+		          read_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy cached sector data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( (ssize_t) read_size );
+		}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->in_flight_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab in flight mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( shard->in_flight_offsets[ entry_index ] == -1 )
+		{
+			/* Another thread could have read the sector before the mutex was grabbed
+			 */
+			result = libvsgpt_sector_cache_copy_from_shard(
+			          shard,
+			          entry_index,
+			          sector_offset,
+			          sector_data_offset,
+			          buffer,
+			          read_size,
+			          error );
+
+			if( result == 0 )
+			{
+				shard->in_flight_offsets[ entry_index ] = sector_offset;
+
+				is_in_flight = 1;
+			}
+		}
+		else
+		{
+			/* The entry is being read by another thread, wait for the result
+			 * instead of reading the same sector again
+			 */
+			if( ( shard->in_flight_offsets[ entry_index ] == sector_offset )
+			 && ( is_deduplicated == 0 ) )
+			{
+				shard->number_of_deduplicated_misses += 1;
+
+				is_deduplicated = 1;
+			}
+			result = libcthreads_condition_wait(
+			          shard->in_flight_condition,
+			          shard->in_flight_mutex,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for in flight condition.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				result = 0;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     shard->in_flight_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release in flight mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( (ssize_t) read_size );
+		}
+	}
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
+	/* The sector is read without holding the lock of the shard
+	 * so that readers of other sectors in the shard are not blocked
+	 */
+	if( libvsgpt_sector_data_initialize(
+	     &sector_data,
+	     sector_cache->sector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_sector_data_read_file_io_handle(
+	     sector_data,
+	     file_io_handle,
+	     sector_cache->data_offset + sector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sector_cache->data_offset + sector_offset,
+		 sector_cache->data_offset + sector_offset );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( sector_data->data[ sector_data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The previous sector data of the entry is freed after the lock is released
+	 */
+	previous_sector_data = shard->entries[ entry_index ];
+
+	shard->entries[ entry_index ]         = sector_data;
+	shard->entries_offsets[ entry_index ] = sector_offset;
+	shard->number_of_reads               += 1;
+
+	sector_data = NULL;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( previous_sector_data != NULL )
+	{
+		if( libvsgpt_sector_data_free(
+		     &previous_sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	is_in_flight = 0;
+
+	if( libvsgpt_sector_cache_clear_in_flight(
+	     shard,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear in flight entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) read_size );
+
+on_error:
+	if( previous_sector_data != NULL )
+	{
+		libvsgpt_sector_data_free(
+		 &previous_sector_data,
+		 NULL );
+	}
+	if( sector_data != NULL )
+	{
+		libvsgpt_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( is_in_flight != 0 )
+	{
+		libvsgpt_sector_cache_clear_in_flight(
+		 shard,
+		 entry_index,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of sectors read from the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_sector_cache_get_number_of_reads(
+     libvsgpt_sector_cache_t *sector_cache,
+     int *number_of_reads,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_sector_cache_get_number_of_reads";
+	int shard_index       = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_reads = 0;
+
+	for( shard_index = 0;
+	     shard_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_read(
+		     sector_cache->shards[ shard_index ].read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		*number_of_reads += sector_cache->shards[ shard_index ].number_of_reads;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     sector_cache->shards[ shard_index ].read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of misses that waited for a read of the same sector by another thread
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+     libvsgpt_sector_cache_t *sector_cache,
+     int *number_of_deduplicated_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_sector_cache_get_number_of_deduplicated_misses";
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	int shard_index       = 0;
+#endif
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_deduplicated_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of deduplicated misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_deduplicated_misses = 0;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	for( shard_index = 0;
+	     shard_index < LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libcthreads_mutex_grab(
+		     sector_cache->shards[ shard_index ].in_flight_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab in flight mutex.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_deduplicated_misses += sector_cache->shards[ shard_index ].number_of_deduplicated_misses;
+
+		if( libcthreads_mutex_release(
+		     sector_cache->shards[ shard_index ].in_flight_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release in flight mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,151 @@
+/*
+ * The sector cache functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBVSGPT_SECTOR_CACHE_H )
+#define _LIBVSGPT_SECTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsgpt_definitions.h"
+#include "libvsgpt_libbfio.h"
+#include "libvsgpt_libcerror.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_sector_data.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsgpt_sector_cache_shard libvsgpt_sector_cache_shard_t;
+
+struct libvsgpt_sector_cache_shard
+{
+	/* The entries sector data
+	 */
+	libvsgpt_sector_data_t *entries[ LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES ];
+
+	/* The entries offsets relative to the start of the data, where -1 represents an unused entry
+	 */
+	off64_t entries_offsets[ LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES ];
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The offsets of the sectors that are being read per entry, where -1 represents no read in flight
+	 */
+	off64_t in_flight_offsets[ LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES ];
+
+	/* The number of misses that waited for a read in flight instead of reading the sector
+	 */
+	int number_of_deduplicated_misses;
+
+	/* The in flight mutex
+	 */
+	libcthreads_mutex_t *in_flight_mutex;
+
+	/* The in flight condition
+	 */
+	libcthreads_condition_t *in_flight_condition;
+#endif
+};
+
+typedef struct libvsgpt_sector_cache libvsgpt_sector_cache_t;
+
+struct libvsgpt_sector_cache
+{
+	/* The data offset
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The sector size
+	 */
+	size_t sector_size;
+
+	/* The shards
+	 */
+	libvsgpt_sector_cache_shard_t shards[ LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS ];
+};
+
+int libvsgpt_sector_cache_initialize(
+     libvsgpt_sector_cache_t **sector_cache,
+     off64_t data_offset,
+     size64_t data_size,
+     size_t sector_size,
+     libcerror_error_t **error );
+
+int libvsgpt_sector_cache_free(
+     libvsgpt_sector_cache_t **sector_cache,
+     libcerror_error_t **error );
+
+int libvsgpt_sector_cache_copy_from_shard(
+     libvsgpt_sector_cache_shard_t *shard,
+     int entry_index,
+     off64_t sector_offset,
+     size_t sector_data_offset,
+     uint8_t *buffer,
+     size_t read_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+int libvsgpt_sector_cache_clear_in_flight(
+     libvsgpt_sector_cache_shard_t *shard,
+     int entry_index,
+     libcerror_error_t **error );
+
+#endif
+
+ssize_t libvsgpt_sector_cache_read_buffer_at_offset(
+         libvsgpt_sector_cache_t *sector_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libvsgpt_sector_cache_get_number_of_reads(
+     libvsgpt_sector_cache_t *sector_cache,
+     int *number_of_reads,
+     libcerror_error_t **error );
+
+int libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+     libvsgpt_sector_cache_t *sector_cache,
+     int *number_of_deduplicated_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSGPT_SECTOR_CACHE_H ) */
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
@@ -30,7 +31,10 @@
 #include "libvsgpt_libbfio.h"
 #include "libvsgpt_libcerror.h"
 #include "libvsgpt_libclocale.h"
+#include "libvsgpt_libcthreads.h"
+#include "libvsgpt_partition_table_header.h"
 #include "libvsgpt_support.h"
+#include "libvsgpt_unused.h"
 
 #if !defined( HAVE_LOCAL_LIBVSGPT )
 
@@ -341,10 +345,10 @@ int libvsgpt_check_volume_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	uint8_t signature[ 8 ];
+	uint8_t signature_data[ 4096 + 8 - 512 ];
 
 	static char *function      = "libvsgpt_check_volume_signature_file_io_handle";
-	off64_t file_offset        = 512;
+	size_t data_offset         = 0;
 	ssize_t read_count         = 0;
 	int file_io_handle_is_open = 0;
 	int result                 = 0;
@@ -392,42 +396,51 @@ int libvsgpt_check_volume_signature_file_io_handle(
 			goto on_error;
 		}
 	}
-	while( file_offset <= 4096 )
+	/* Read the signature candidates of all supported sector sizes at once
+	 * these are stored at offsets: 512, 1024, 2048 and 4096
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+		      file_io_handle,
+		      signature_data,
+		      sizeof( signature_data ),
+		      512,
+		      error );
+
+	if( read_count == -1 )
 	{
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      signature,
-			      8,
-			      file_offset,
-			      error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature data at offset: 512 (0x00000200).",
+		 function );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     ( data_offset + 8 ) <= (size_t) read_count;
+	     data_offset = ( data_offset * 2 ) + 512 )
+	{
+		result = libvsgpt_partition_table_header_check_signature(
+		          &( signature_data[ data_offset ] ),
+		          (size_t) read_count - data_offset,
+		          error );
 
-		if( read_count == -1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check partition table header signature.",
+			 function );
 
 			goto on_error;
 		}
-		else if( read_count != 8 )
+		else if( result != 0 )
 		{
 			break;
 		}
-		if( memory_compare(
-		     "EFI PART",
-		     signature,
-		     8 ) == 0 )
-		{
-			result = 1;
-
-			break;
-		}
-		file_offset *= 2;
 	}
 	if( file_io_handle_is_open == 0 )
 	{
@@ -457,3 +470,369 @@ on_error:
 	return( -1 );
 }
 
+/* Checks the signature of a signature check value
+ * Callback function for the signature check thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_signature_check_value_check(
+     libvsgpt_signature_check_value_t *signature_check_value,
+     void *arguments LIBVSGPT_ATTRIBUTE_UNUSED )
+{
+	LIBVSGPT_UNREFERENCED_PARAMETER( arguments )
+
+	if( signature_check_value == NULL )
+	{
+		return( -1 );
+	}
+	/* An error of an individual volume is reported in its result
+	 * and does not affect the other volumes
+	 */
+	if( signature_check_value->file_io_handle != NULL )
+	{
+		signature_check_value->result = libvsgpt_check_volume_signature_file_io_handle(
+		                                 signature_check_value->file_io_handle,
+		                                 NULL );
+	}
+	else
+	{
+		signature_check_value->result = libvsgpt_check_volume_signature(
+		                                 signature_check_value->filename,
+		                                 NULL );
+	}
+	return( 1 );
+}
+
+/* Checks the signatures of multiple signature check values
+ * The signatures are checked concurrently if multi-threading support is available
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_signature_check_values_check(
+     libvsgpt_signature_check_value_t *signature_check_values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int number_of_threads                  = 0;
+#endif
+
+	static char *function                  = "libvsgpt_signature_check_values_check";
+	int value_index                        = 0;
+
+	if( signature_check_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature check values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of values value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	number_of_threads = number_of_values;
+
+	if( number_of_threads > LIBVSGPT_MAXIMUM_NUMBER_OF_SIGNATURE_CHECK_THREADS )
+	{
+		number_of_threads = LIBVSGPT_MAXIMUM_NUMBER_OF_SIGNATURE_CHECK_THREADS;
+	}
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_threads * 2,
+		     (int (*)(intptr_t *, void *)) &libvsgpt_signature_check_value_check,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( signature_check_values[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push value: %d onto thread pool queue.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		libvsgpt_signature_check_value_check(
+		 &( signature_check_values[ value_index ] ),
+		 NULL );
+	}
+	return( 1 );
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Determines if volumes contain a GUID Partition Table (GPT) signature
+ * The result of each volume is stored in results: 1 if true, 0 if not or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_check_volume_signatures(
+     const char **filenames,
+     int number_of_filenames,
+     int *results,
+     libcerror_error_t **error )
+{
+	libvsgpt_signature_check_value_t *signature_check_values = NULL;
+	static char *function                                    = "libvsgpt_check_volume_signatures";
+	int filename_index                                       = 0;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvsgpt_signature_check_value_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	signature_check_values = (libvsgpt_signature_check_value_t *) memory_allocate(
+	                                                               sizeof( libvsgpt_signature_check_value_t ) * number_of_filenames );
+
+	if( signature_check_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signature check values.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		signature_check_values[ filename_index ].filename       = filenames[ filename_index ];
+		signature_check_values[ filename_index ].file_io_handle = NULL;
+		signature_check_values[ filename_index ].result         = -1;
+	}
+	if( libvsgpt_signature_check_values_check(
+	     signature_check_values,
+	     number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check signatures.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		results[ filename_index ] = signature_check_values[ filename_index ].result;
+	}
+	memory_free(
+	 signature_check_values );
+
+	return( 1 );
+
+on_error:
+	if( signature_check_values != NULL )
+	{
+		memory_free(
+		 signature_check_values );
+	}
+	return( -1 );
+}
+
+/* Determines if volumes contain a GUID Partition Table (GPT) signature using Basic File IO (bfio) handles
+ * Every file IO handle must be a separate handle, since the handles can be used concurrently
+ * The result of each volume is stored in results: 1 if true, 0 if not or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_check_volume_signatures_file_io_handles(
+     libbfio_handle_t **file_io_handles,
+     int number_of_file_io_handles,
+     int *results,
+     libcerror_error_t **error )
+{
+	libvsgpt_signature_check_value_t *signature_check_values = NULL;
+	static char *function                                    = "libvsgpt_check_volume_signatures_file_io_handles";
+	int file_io_handle_index                                 = 0;
+
+	if( file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_file_io_handles <= 0 )
+	 || ( (size_t) number_of_file_io_handles > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvsgpt_signature_check_value_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	signature_check_values = (libvsgpt_signature_check_value_t *) memory_allocate(
+	                                                               sizeof( libvsgpt_signature_check_value_t ) * number_of_file_io_handles );
+
+	if( signature_check_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signature check values.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		signature_check_values[ file_io_handle_index ].filename       = NULL;
+		signature_check_values[ file_io_handle_index ].file_io_handle = file_io_handles[ file_io_handle_index ];
+		signature_check_values[ file_io_handle_index ].result         = -1;
+	}
+	if( libvsgpt_signature_check_values_check(
+	     signature_check_values,
+	     number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check signatures.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		results[ file_io_handle_index ] = signature_check_values[ file_io_handle_index ].result;
+	}
+	memory_free(
+	 signature_check_values );
+
+	return( 1 );
+
+on_error:
+	if( signature_check_values != NULL )
+	{
+		memory_free(
+		 signature_check_values );
+	}
+	return( -1 );
+}
+
@@ -33,6 +33,23 @@
 extern "C" {
 #endif
 
+typedef struct libvsgpt_signature_check_value libvsgpt_signature_check_value_t;
+
+struct libvsgpt_signature_check_value
+{
+	/* The filename
+	 */
+	const char *filename;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The result
+	 */
+	int result;
+};
+
 #if !defined( HAVE_LOCAL_LIBVSGPT )
 
 LIBVSGPT_EXTERN \
@@ -82,6 +99,29 @@ int libvsgpt_check_volume_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libvsgpt_signature_check_value_check(
+     libvsgpt_signature_check_value_t *signature_check_value,
+     void *arguments );
+
+int libvsgpt_signature_check_values_check(
+     libvsgpt_signature_check_value_t *signature_check_values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_check_volume_signatures(
+     const char **filenames,
+     int number_of_filenames,
+     int *results,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_check_volume_signatures_file_io_handles(
+     libbfio_handle_t **file_io_handles,
+     int number_of_file_io_handles,
+     int *results,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
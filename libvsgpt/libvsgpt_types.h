@@ -35,10 +35,12 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libvsgpt_partition {}	libvsgpt_partition_t;
+typedef struct libvsgpt_partition_cursor {}	libvsgpt_partition_cursor_t;
 typedef struct libvsgpt_volume {}	libvsgpt_volume_t;
 
 #else
 typedef intptr_t libvsgpt_partition_t;
+typedef intptr_t libvsgpt_partition_cursor_t;
 typedef intptr_t libvsgpt_volume_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -26,22 +27,31 @@
 #include <wide_string.h>
 
 #include "libvsgpt_boot_record.h"
+#include "libvsgpt_checksum.h"
 #include "libvsgpt_debug.h"
 #include "libvsgpt_definitions.h"
 #include "libvsgpt_volume.h"
 #include "libvsgpt_io_handle.h"
+#include "libvsgpt_io_trace.h"
 #include "libvsgpt_libbfio.h"
 #include "libvsgpt_libcerror.h"
 #include "libvsgpt_libcnotify.h"
 #include "libvsgpt_libcthreads.h"
 #include "libvsgpt_mbr_partition_entry.h"
+#include "libvsgpt_metadata_cache.h"
+#include "libvsgpt_offset_index.h"
 #include "libvsgpt_partition.h"
+#include "libvsgpt_partition_chunks.h"
+#include "libvsgpt_partition_comparison.h"
 #include "libvsgpt_partition_entry.h"
 #include "libvsgpt_partition_table_header.h"
 #include "libvsgpt_partition_values.h"
+#include "libvsgpt_partition_values_array.h"
 #include "libvsgpt_section_values.h"
 #include "libvsgpt_types.h"
 
+#include "vsgpt_volume_layout.h"
+
 /* Creates a volume
  * Make sure the value volume is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -119,9 +129,21 @@ int libvsgpt_volume_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
+	if( libvsgpt_io_trace_initialize(
+	     &( internal_volume->io_trace ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_values_array_initialize(
 	     &( internal_volume->partitions ),
-	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -133,6 +155,19 @@ int libvsgpt_volume_initialize(
 
 		goto on_error;
 	}
+	if( libvsgpt_offset_index_initialize(
+	     &( internal_volume->offset_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset index.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_volume->read_write_lock ),
@@ -155,6 +190,24 @@ int libvsgpt_volume_initialize(
 on_error:
 	if( internal_volume != NULL )
 	{
+		if( internal_volume->offset_index != NULL )
+		{
+			libvsgpt_offset_index_free(
+			 &( internal_volume->offset_index ),
+			 NULL );
+		}
+		if( internal_volume->partitions != NULL )
+		{
+			libvsgpt_partition_values_array_free(
+			 &( internal_volume->partitions ),
+			 NULL );
+		}
+		if( internal_volume->io_trace != NULL )
+		{
+			libvsgpt_io_trace_free(
+			 &( internal_volume->io_trace ),
+			 NULL );
+		}
 		if( internal_volume->io_handle != NULL )
 		{
 			libvsgpt_io_handle_free(
@@ -226,9 +279,8 @@ int libvsgpt_volume_free(
 			result = -1;
 		}
 #endif
-		if( libcdata_array_free(
+		if( libvsgpt_partition_values_array_free(
 		     &( internal_volume->partitions ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libvsgpt_partition_values_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -240,6 +292,19 @@ int libvsgpt_volume_free(
 
 			result = -1;
 		}
+		if( libvsgpt_offset_index_free(
+		     &( internal_volume->offset_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset index.",
+			 function );
+
+			result = -1;
+		}
 		if( libvsgpt_io_handle_free(
 		     &( internal_volume->io_handle ),
 		     error ) != 1 )
@@ -253,6 +318,19 @@ int libvsgpt_volume_free(
 
 			result = -1;
 		}
+		if( libvsgpt_io_trace_free(
+		     &( internal_volume->io_trace ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO trace.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -298,6 +376,229 @@ int libvsgpt_volume_signal_abort(
 	return( 1 );
 }
 
+/* Sets the trace callback
+ * The trace callback is called for every read and at the end of every phase when opening the volume
+ * A trace callback of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_set_trace_callback(
+     libvsgpt_volume_t *volume,
+     void (*trace_callback)(
+            int event_type,
+            int phase,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_set_trace_callback";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsgpt_io_trace_set_callback(
+	     internal_volume->io_trace,
+	     trace_callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callback.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the timeout
+ * The timeout is in milliseconds and applies to every open and read operation separately
+ * An operation that exceeds the timeout fails with the LIBVSGPT_RUNTIME_ERROR_TIMED_OUT error
+ * A timeout of 0 disables the timeout
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_set_timeout(
+     libvsgpt_volume_t *volume,
+     uint32_t timeout,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_set_timeout";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->io_handle->timeout = (int64_t) timeout * 1000;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the recovery mode
+ * In recovery mode the partition table is read from the backup at the end of the volume
+ * when the partition table header is corrupt, without probing the corrupt header further
+ * A recovery mode of 0 disables the recovery mode
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_set_recovery_mode(
+     libvsgpt_volume_t *volume,
+     uint8_t recovery_mode,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_set_recovery_mode";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( recovery_mode != 0 )
+	{
+		internal_volume->recovery_mode = 1;
+	}
+	else
+	{
+		internal_volume->recovery_mode = 0;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Opens a volume
  * Returns 1 if successful or -1 on error
  */
@@ -807,16 +1108,21 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Opens a volume from a buffer
+ * The buffer must remain valid until the volume is closed
+ * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_close(
+int libvsgpt_volume_open_buffer(
      libvsgpt_volume_t *volume,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
 	libvsgpt_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsgpt_volume_close";
-	int result                                  = 0;
+	static char *function                       = "libvsgpt_volume_open_buffer";
+	int volume_is_open                          = 0;
 
 	if( volume == NULL )
 	{
@@ -831,129 +1137,119 @@ int libvsgpt_volume_close(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBVSGPT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBVSGPT_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libvsgpt_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBVSGPT_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			result = -1;
-		}
-		internal_volume->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
+	/* The file IO handle is only used to read the volume metadata
+	 * partition data is read directly from the buffer
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
 
-			result = -1;
-		}
-		internal_volume->file_io_handle_created_in_library = 0;
+		goto on_error;
 	}
-	internal_volume->file_io_handle = NULL;
-
-	if( libvsgpt_io_handle_clear(
-	     internal_volume->io_handle,
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) buffer,
+	     buffer_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear the IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libvsgpt_partition_table_header_free(
-	     &( internal_volume->partition_table_header ),
+	if( libvsgpt_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free partition table header.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume from buffer.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_volume->partitions,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsgpt_partition_values_free,
+	volume_is_open = 1;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty the partitions array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->buffer                            = buffer;
+	internal_volume->buffer_size                       = buffer_size;
+
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -969,858 +1265,834 @@ int libvsgpt_volume_close(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	/* The volume references the file IO handle until it is closed
+	 */
+	if( volume_is_open != 0 )
+	{
+		if( libvsgpt_volume_close(
+		     volume,
+		     NULL ) != 0 )
+		{
+			file_io_handle = NULL;
+		}
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a volume for reading
- * Returns 1 if successful or -1 on error
+/* Opens a volume using a file IO handle and a volume layout
+ * The volume layout is created by libvsgpt_volume_export_layout
+ * Returns 1 if successful, 0 if the volume layout does not match the volume or -1 on error
  */
-int libvsgpt_internal_volume_open_read(
-     libvsgpt_internal_volume_t *internal_volume,
+int libvsgpt_volume_open_with_layout(
+     libvsgpt_volume_t *volume,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *layout_data,
+     size_t layout_data_size,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libvsgpt_boot_record_t *master_boot_record = NULL;
-	static char *function                      = "libvsgpt_internal_volume_open_read";
-	off64_t file_offset                        = 0;
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_open_with_layout";
+	uint8_t file_io_handle_opened_in_library    = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_handle_is_open                  = 0;
+	int result                                  = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_volume->size ),
-	     error ) != 1 )
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size from file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libvsgpt_internal_volume_read_partition_table_headers(
-	     internal_volume,
-	     file_io_handle,
-	     error ) != 1 )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition table header and backup.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_volume->partition_table_header == NULL )
+	if( ( ( access_flags & LIBVSGPT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBVSGPT_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing partition table header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading GUID Partition Table (GPT) entries.\n",
-		 function );
+		return( -1 );
 	}
-#endif
-	file_offset = internal_volume->partition_table_header->partition_entries_start_block_number * internal_volume->io_handle->bytes_per_sector;
-
-	if( libvsgpt_internal_volume_read_partition_entries(
-	     internal_volume,
-	     file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	if( ( access_flags & LIBVSGPT_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( access_flags & LIBVSGPT_ACCESS_FLAG_READ ) != 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading Master Boot Record (MBR).\n",
-		 function );
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
-#endif
-	if( libvsgpt_boot_record_initialize(
-	     &master_boot_record,
-	     error ) != 1 )
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create master boot record.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
 		 function );
 
 		goto on_error;
 	}
-	if( libvsgpt_boot_record_read_file_io_handle(
-	     master_boot_record,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	result = libvsgpt_internal_volume_open_read_with_layout(
+	          internal_volume,
+	          file_io_handle,
+	          layout_data,
+	          layout_data_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read master boot record.",
+		 "%s: unable to read from file IO handle using layout.",
 		 function );
 
 		goto on_error;
 	}
-	if( libvsgpt_internal_volume_read_mbr_partition_entries(
-	     internal_volume,
-	     file_io_handle,
-	     0,
-	     master_boot_record,
-	     1,
-	     0,
-	     0,
+	else if( result == 0 )
+	{
+		if( file_io_handle_opened_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 0 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition entries.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libvsgpt_boot_record_free(
-	     &master_boot_record,
+#endif
+	internal_volume->file_io_handle                   = file_io_handle;
+	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free master boot record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+#endif
 	return( 1 );
 
 on_error:
-	if( master_boot_record != NULL )
-	{
-		libvsgpt_boot_record_free(
-		 &master_boot_record,
-		 NULL );
-	}
-	if( internal_volume->partition_table_header != NULL )
+	if( file_io_handle_opened_in_library != 0 )
 	{
-		libvsgpt_partition_table_header_free(
-		 &( internal_volume->partition_table_header ),
-		 NULL );
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
 	}
 	return( -1 );
 }
 
-/* Reads the partition table header and the backup
- * Returns 1 if successful or -1 on error
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
  */
-int libvsgpt_internal_volume_read_partition_table_headers(
-     libvsgpt_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
+int libvsgpt_volume_close(
+     libvsgpt_volume_t *volume,
      libcerror_error_t **error )
 {
-	libvsgpt_partition_table_header_t *backup_partition_table_header = NULL;
-	libvsgpt_partition_table_header_t *partition_table_header        = NULL;
-	static char *function                                            = "libvsgpt_internal_volume_read_partition_table_headers";
-	off64_t file_offset                                              = 0;
-	int result                                                       = 0;
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_close";
+	int result                                  = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->partition_table_header != NULL )
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - partition table header already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading GUID Partition Table (GPT) header.\n",
-		 function );
-	}
-#endif
-	if( libvsgpt_partition_table_header_initialize(
-	     &partition_table_header,
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create partition table header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->io_handle->bytes_per_sector = 512;
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
+		{
+			if( libvsgpt_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
 
-	result = libvsgpt_partition_table_header_read_file_io_handle(
-	          partition_table_header,
-	          file_io_handle,
-	          (off64_t) internal_volume->io_handle->bytes_per_sector,
-	          error );
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
 
-	while( ( result == 0 )
-	    && ( internal_volume->io_handle->bytes_per_sector < 4096 ) )
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
 	{
-		internal_volume->io_handle->bytes_per_sector *= 2;
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
 
-		result = libvsgpt_partition_table_header_read_file_io_handle(
-		          partition_table_header,
-		          file_io_handle,
-		          (off64_t) internal_volume->io_handle->bytes_per_sector,
-		          error );
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
 	}
-	if( result != 1 )
+	internal_volume->file_io_handle = NULL;
+	internal_volume->buffer         = NULL;
+	internal_volume->buffer_size    = 0;
+	internal_volume->fingerprint    = 0;
+	internal_volume->is_corrupt     = 0;
+
+	if( libvsgpt_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition table header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear the IO handle.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libvsgpt_partition_table_header_free(
+	     &( internal_volume->partition_table_header ),
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: bytes per sector\t: %" PRIzd ".\n",
-		 function,
-		 internal_volume->io_handle->bytes_per_sector );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition table header.",
+		 function );
 
-		libcnotify_printf(
-		 "\n" );
+		result = -1;
 	}
-#endif
-	if( partition_table_header->partition_header_block_number != 1 )
+	if( libvsgpt_partition_values_array_empty(
+	     internal_volume->partitions,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: unsupported partition table header block number: %" PRIu64 ".",
-		 function,
-		 partition_table_header->partition_header_block_number );
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty the partitions array.",
+		 function );
 
-		goto on_error;
+		result = -1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libvsgpt_offset_index_clear(
+	     internal_volume->offset_index,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: reading backup GUID Partition Table (GPT) header.\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear offset index.",
 		 function );
+
+		result = -1;
 	}
-#endif
-	if( libvsgpt_partition_table_header_initialize(
-	     &backup_partition_table_header,
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create backup partition table header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result      = 0;
-	file_offset = partition_table_header->backup_partition_header_block_number * internal_volume->io_handle->bytes_per_sector;
+#endif
+	return( result );
+}
 
-	if( file_offset > 0 )
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_open_read(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsgpt_boot_record_t *master_boot_record = NULL;
+	libvsgpt_metadata_cache_t *metadata_cache  = NULL;
+	const uint8_t *boot_record_data            = NULL;
+	const uint8_t *partition_table_header_data = NULL;
+	static char *function                      = "libvsgpt_internal_volume_open_read";
+	off64_t file_offset                        = 0;
+	int result                                 = 0;
+
+	if( internal_volume == NULL )
 	{
-		result = libvsgpt_partition_table_header_read_file_io_handle(
-		          backup_partition_table_header,
-		          file_io_handle,
-		          file_offset,
-		          error );
-	}
-	if( ( result == 0 )
-	 || ( file_offset == 0 ) )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: invalid backup partition header block number fallback to last block.\n",
-			 function );
-		}
-#endif
-		file_offset = internal_volume->size - internal_volume->io_handle->bytes_per_sector;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
 
-		result = libvsgpt_partition_table_header_read_file_io_handle(
-		          backup_partition_table_header,
-		          file_io_handle,
-		          file_offset,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	internal_volume->deadline = libvsgpt_io_handle_get_deadline(
+	                             internal_volume->io_handle );
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_volume->size ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read backup partition table header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( partition_table_header->is_corrupt != 0 )
-	 && ( backup_partition_table_header->is_corrupt != 0 ) )
+	/* The metadata cache is shared by the readers of the partition table headers
+	 * and boot records, so that sectors are read only once while probing
+	 */
+	if( libvsgpt_metadata_cache_initialize(
+	     &metadata_cache,
+	     internal_volume->size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
-		 "%s: partition table header and backup are both corrupt.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( partition_table_header->is_corrupt != 0 )
-	 || ( backup_partition_table_header->is_corrupt != 0 ) )
-	{
-		internal_volume->is_corrupt = 1;
-	}
-	else
+	metadata_cache->io_trace = internal_volume->io_trace;
+
+	if( internal_volume->recovery_mode != 0 )
 	{
-		if( partition_table_header->partition_header_block_number != backup_partition_table_header->backup_partition_header_block_number )
+		result = libvsgpt_internal_volume_recover_partition_table(
+		          internal_volume,
+		          file_io_handle,
+		          metadata_cache,
+		          error );
+
+		if( result == -1 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of partition table header block number.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover partition table.",
+			 function );
+
+			goto on_error;
 		}
-		if( partition_table_header->backup_partition_header_block_number != backup_partition_table_header->partition_header_block_number )
+	}
+	/* The partition table was not read from the backup in recovery mode
+	 */
+	if( result == 0 )
+	{
+		if( libvsgpt_internal_volume_read_partition_table_headers(
+		     internal_volume,
+		     file_io_handle,
+		     metadata_cache,
+		     error ) != 1 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of backup partition table header block number.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition table header and backup.",
+			 function );
+
+			goto on_error;
 		}
-		if( partition_table_header->partition_area_start_block_number != backup_partition_table_header->partition_area_start_block_number )
+		if( internal_volume->partition_table_header == NULL )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of partition area start block number.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid volume - missing partition table header.",
+			 function );
+
+			goto on_error;
 		}
-		if( partition_table_header->partition_area_end_block_number != backup_partition_table_header->partition_area_end_block_number )
-		{
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of partition area end block number.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
-		}
-		if( memory_compare(
-		     partition_table_header->disk_identifier,
-		     backup_partition_table_header->disk_identifier,
-		     16 ) != 0 )
+		if( libcnotify_verbose != 0 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of disk identifier.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcnotify_printf(
+			 "%s: reading GUID Partition Table (GPT) entries.\n",
+			 function );
 		}
-		/* The partition entries start block number will be different
-		 */
-		if( partition_table_header->number_of_partition_entries != backup_partition_table_header->number_of_partition_entries )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of number of partition entries.\n",
-				 function );
-			}
 #endif
-			internal_volume->is_corrupt = 1;
-		}
-		if( partition_table_header->partition_entry_data_size != backup_partition_table_header->partition_entry_data_size )
+		file_offset = internal_volume->partition_table_header->partition_entries_start_block_number * internal_volume->io_handle->bytes_per_sector;
+
+		if( libvsgpt_io_handle_check_abort(
+		     internal_volume->io_handle,
+		     internal_volume->deadline,
+		     error ) != 1 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of partition entry data size.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to continue open.",
+			 function );
+
+			goto on_error;
 		}
-		if( partition_table_header->partition_entries_data_checksum != backup_partition_table_header->partition_entries_data_checksum )
+		if( libvsgpt_io_trace_start_phase(
+		     internal_volume->io_trace,
+		     LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES,
+		     error ) != 1 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch of partition entries data checksum.\n",
-				 function );
-			}
-#endif
-			internal_volume->is_corrupt = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start IO trace phase.",
+			 function );
+
+			goto on_error;
 		}
-	}
-	if( partition_table_header->is_corrupt != 0 )
-	{
-		if( libvsgpt_partition_table_header_free(
-		     &partition_table_header,
+		if( libvsgpt_internal_volume_read_partition_entries(
+		     internal_volume,
+		     file_io_handle,
+		     file_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free partition table header.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition entries.",
 			 function );
 
 			goto on_error;
 		}
-		internal_volume->partition_table_header = backup_partition_table_header;
-	}
-	else
-	{
-		if( libvsgpt_partition_table_header_free(
-		     &backup_partition_table_header,
+		if( libvsgpt_io_trace_end_phase(
+		     internal_volume->io_trace,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free backup partition table header.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to end IO trace phase.",
 			 function );
 
 			goto on_error;
 		}
-		internal_volume->partition_table_header = partition_table_header;
-	}
-	return( 1 );
-
-on_error:
-	if( backup_partition_table_header != NULL )
-	{
-		libvsgpt_partition_table_header_free(
-		 &backup_partition_table_header,
-		 NULL );
 	}
-	if( partition_table_header != NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libvsgpt_partition_table_header_free(
-		 &partition_table_header,
-		 NULL );
+		libcnotify_printf(
+		 "%s: reading Master Boot Record (MBR).\n",
+		 function );
 	}
-	return( -1 );
-}
-
-/* Reads partition entries
- * Returns 1 if successful or -1 on error
- */
-int libvsgpt_internal_volume_read_partition_entries(
-     libvsgpt_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     libcerror_error_t **error )
-{
-	uint8_t *empty_partition_type[ 16 ]           = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	libvsgpt_partition_entry_t *partition_entry   = NULL;
-	libvsgpt_partition_values_t *partition_values = NULL;
-	uint8_t *partition_entries_data               = NULL;
-	static char *function                         = "libvsgpt_internal_volume_read_partition_entries";
-	size_t data_offset                            = 0;
-	size_t partition_entries_data_size            = 0;
-	ssize_t read_count                            = 0;
-	uint32_t maximum_number_of_partition_entries  = 0;
-	uint32_t partition_entry_index                = 0;
-	int entry_index                               = 0;
-
-	if( internal_volume == NULL )
+#endif
+	if( libvsgpt_io_handle_check_abort(
+	     internal_volume->io_handle,
+	     internal_volume->deadline,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to continue open.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->partition_table_header == NULL )
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_BOOT_RECORDS,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing partition table header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if ( SIZEOF_SIZE_T <= 4 )
-	if( ( internal_volume->partition_table_header->partition_entry_data_size < 128 )
-	 || ( internal_volume->partition_table_header->partition_entry_data_size > (size_t) SSIZE_MAX ) )
-#else
-	if( internal_volume->partition_table_header->partition_entry_data_size < 128 )
-#endif
+	if( libvsgpt_boot_record_initialize(
+	     &master_boot_record,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume - invalid partition table table header - partition entry data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create master boot record.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	maximum_number_of_partition_entries = ( 32 * internal_volume->io_handle->bytes_per_sector ) / internal_volume->partition_table_header->partition_entry_data_size;
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          0,
+	          512,
+	          &boot_record_data,
+	          error );
 
-	if( internal_volume->partition_table_header->number_of_partition_entries > maximum_number_of_partition_entries )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume - invalid partition table table header - number of partition entries value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read master boot record data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	partition_entries_data_size = (size_t) internal_volume->partition_table_header->partition_entry_data_size * (size_t) internal_volume->partition_table_header->number_of_partition_entries;
-
-	if( partition_entries_data_size > (size_t) SSIZE_MAX )
+	if( libvsgpt_boot_record_read_data(
+	     master_boot_record,
+	     boot_record_data,
+	     512,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid partition entries data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read master boot record.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	partition_entries_data = (uint8_t *) memory_allocate(
-	                                      sizeof( uint8_t ) * partition_entries_data_size );
+	if( libvsgpt_internal_volume_read_mbr_partition_entries(
+	     internal_volume,
+	     file_io_handle,
+	     metadata_cache,
+	     master_boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition entries.",
+		 function );
 
-	if( partition_entries_data == NULL )
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create partition entries data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libvsgpt_boot_record_free(
+	     &master_boot_record,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: reading partition entries at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-		 function,
-		 file_offset,
-		 file_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free master boot record.",
+		 function );
+
+		goto on_error;
 	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              partition_entries_data,
-	              partition_entries_data_size,
-	              file_offset,
-	              error );
+	/* The fingerprint is calculated from the partition table header sector
+	 * in the metadata cache, since it was already read while probing
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          (off64_t) internal_volume->io_handle->bytes_per_sector,
+	          internal_volume->io_handle->bytes_per_sector,
+	          &partition_table_header_data,
+	          error );
 
-	if( read_count != (ssize_t) partition_entries_data_size )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 "%s: unable to read partition table header sector data.",
+		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libvsgpt_checksum_calculate_crc32(
+	     &( internal_volume->fingerprint ),
+	     partition_table_header_data,
+	     internal_volume->io_handle->bytes_per_sector,
+	     0,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: partition entries data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate fingerprint.",
 		 function );
-		libcnotify_print_data(
-		 partition_entries_data,
-		 partition_entries_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		goto on_error;
 	}
-#endif
-	if( libvsgpt_partition_entry_initialize(
-	     &partition_entry,
+	if( libvsgpt_metadata_cache_free(
+	     &metadata_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create partition entry.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata cache.",
 		 function );
 
 		goto on_error;
 	}
-	for( partition_entry_index = 0;
-	     partition_entry_index < internal_volume->partition_table_header->number_of_partition_entries;
-	     partition_entry_index++ )
+	if( libvsgpt_offset_index_build(
+	     internal_volume->offset_index,
+	     internal_volume->partitions,
+	     error ) != 1 )
 	{
-		if( libvsgpt_partition_entry_read_data(
-		     partition_entry,
-		     &( partition_entries_data[ data_offset ] ),
-		     internal_volume->partition_table_header->partition_entry_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read partition entry data.",
-			 function );
-
-			goto on_error;
-		}
-		data_offset += internal_volume->partition_table_header->partition_entry_data_size;
-
-		/* Ignore empty partition entries
-		 */
-		if( memory_compare(
-		     partition_entry->type_identifier,
-		     empty_partition_type,
-		     16 ) == 0 )
-		{
-			continue;
-		}
-		if( libvsgpt_partition_values_initialize(
-		     &partition_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create partition values.",
-			 function );
-
-			goto on_error;
-		}
-/* TODO refactor to libvsgtp_partition_values_copy_from_partition_entry */
-		if( memory_copy(
-		     partition_values->type_identifier,
-		     partition_entry->type_identifier,
-		     16 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to copy type identifier.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     partition_values->identifier,
-		     partition_entry->identifier,
-		     16 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to copy identifier.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( partition_entry->start_block_number < internal_volume->partition_table_header->partition_area_start_block_number )
-		 || ( partition_entry->start_block_number >= (uint64_t) ( internal_volume->size / internal_volume->io_handle->bytes_per_sector ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid partition entry - start block number value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( partition_entry->end_block_number < partition_entry->start_block_number )
-		 || ( partition_entry->end_block_number > (uint64_t) ( internal_volume->size / internal_volume->io_handle->bytes_per_sector ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid partition entry - end block number value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		partition_values->entry_index = partition_entry_index;
-		partition_values->offset      = (off64_t) ( partition_entry->start_block_number * internal_volume->io_handle->bytes_per_sector );
-		partition_values->size        = (size64_t) ( ( partition_entry->end_block_number - partition_entry->start_block_number + 1 ) * internal_volume->io_handle->bytes_per_sector );
-
-		if( libcdata_array_append_entry(
-		     internal_volume->partitions,
-		     &entry_index,
-		     (intptr_t *) partition_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append partition to array.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build partitions offset index.",
+		 function );
 
-			goto on_error;
-		}
-		partition_values = NULL;
+		goto on_error;
 	}
-	if( libvsgpt_partition_entry_free(
-	     &partition_entry,
+	if( libvsgpt_io_handle_check_abort(
+	     internal_volume->io_handle,
+	     internal_volume->deadline,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free partition entry.",
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to continue open.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 partition_entries_data );
+	internal_volume->deadline = 0;
 
 	return( 1 );
 
 on_error:
-	if( partition_values != NULL )
+	if( master_boot_record != NULL )
 	{
-		libvsgpt_partition_values_free(
-		 &partition_values,
+		libvsgpt_boot_record_free(
+		 &master_boot_record,
 		 NULL );
 	}
-	if( partition_entry != NULL )
+	if( metadata_cache != NULL )
 	{
-		libvsgpt_partition_entry_free(
-		 &partition_entry,
+		libvsgpt_metadata_cache_free(
+		 &metadata_cache,
 		 NULL );
 	}
-	if( partition_entries_data != NULL )
+	if( internal_volume->partition_table_header != NULL )
 	{
-		memory_free(
-		 partition_entries_data );
+		libvsgpt_partition_table_header_free(
+		 &( internal_volume->partition_table_header ),
+		 NULL );
 	}
+	internal_volume->deadline = 0;
+
 	return( -1 );
 }
 
-/* Reads partition entries in a master boot record or extended partition record
+/* Calculates the fingerprint of the volume
+ * The fingerprint is a CRC-32 of the partition table header sector
  * Returns 1 if successful or -1 on error
  */
-int libvsgpt_internal_volume_read_mbr_partition_entries(
+int libvsgpt_internal_volume_calculate_fingerprint(
      libvsgpt_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     libvsgpt_boot_record_t *boot_record,
-     uint8_t is_master_boot_record,
-     off64_t first_extended_boot_record_offset,
-     int recursion_depth,
+     uint32_t *fingerprint,
      libcerror_error_t **error )
 {
-	libvsgpt_boot_record_t *extended_partition_record = NULL;
-	libvsgpt_mbr_partition_entry_t *partition_entry   = NULL;
-	libvsgpt_partition_values_t *partition_values     = NULL;
-	static char *function                             = "libvsgpt_internal_volume_read_mbr_partition_entries";
-	off64_t extended_partition_record_offset          = 0;
-	int partition_entry_index                         = 0;
-	int result                                        = 0;
+	uint8_t sector_data[ 4096 ];
+
+	static char *function = "libvsgpt_internal_volume_calculate_fingerprint";
+	size_t bytes_per_sector = 0;
+	ssize_t read_count    = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -1833,266 +2105,3491 @@ int libvsgpt_internal_volume_read_mbr_partition_entries(
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBVSGPT_MAXIMUM_RECURSION_DEPTH ) )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	for( partition_entry_index = 0;
-	     partition_entry_index < 4;
-	     partition_entry_index++ )
+	bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
+
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > sizeof( sector_data ) ) )
 	{
-		if( libvsgpt_boot_record_get_partition_entry_by_index(
-		     boot_record,
-		     partition_entry_index,
-		     &partition_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve partition entry: %d.",
-			 function,
-			 partition_entry_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid internal volume - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
 
-			goto on_error;
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              internal_volume->io_trace,
+	              file_io_handle,
+	              sector_data,
+	              bytes_per_sector,
+	              (off64_t) bytes_per_sector,
+	              error );
+
+	if( read_count != (ssize_t) bytes_per_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition table header sector at offset: %" PRIzd " (0x%08" PRIzx ").",
+		 function,
+		 bytes_per_sector,
+		 bytes_per_sector );
+
+		return( -1 );
+	}
+	if( libvsgpt_checksum_calculate_crc32(
+	     fingerprint,
+	     sector_data,
+	     bytes_per_sector,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a volume for reading using a volume layout
+ * Only the fingerprint of the volume is read to verify the volume layout
+ * Returns 1 if successful, 0 if the volume layout does not match the volume or -1 on error
+ */
+int libvsgpt_internal_volume_open_read_with_layout(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *layout_data,
+     size_t layout_data_size,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_values_t partition_values;
+
+	vsgpt_volume_layout_header_t *layout_header      = NULL;
+	vsgpt_volume_layout_partition_t *layout_partition = NULL;
+	static char *function                             = "libvsgpt_internal_volume_open_read_with_layout";
+	size64_t volume_size                              = 0;
+	size64_t stored_volume_size                       = 0;
+	size_t data_offset                                = 0;
+	uint32_t bytes_per_sector                         = 0;
+	uint32_t calculated_checksum                      = 0;
+	uint32_t fingerprint                              = 0;
+	uint32_t flags                                    = 0;
+	uint32_t format_version                           = 0;
+	uint32_t header_data_size                         = 0;
+	uint32_t number_of_partitions                     = 0;
+	uint32_t partition_index                          = 0;
+	uint32_t stored_checksum                          = 0;
+	uint32_t stored_fingerprint                       = 0;
+	uint64_t number_of_blocks                         = 0;
+	uint64_t number_of_volume_blocks                  = 0;
+	uint64_t start_block_number                       = 0;
+	int result                                        = -1;
+	int values_index                                  = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->partition_table_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - partition table header already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( layout_data_size < ( sizeof( vsgpt_volume_layout_header_t ) + sizeof( vsgpt_volume_layout_footer_t ) ) )
+	 || ( layout_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid layout data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	layout_header = (vsgpt_volume_layout_header_t *) layout_data;
+
+	if( memory_compare(
+	     layout_header->signature,
+	     "vsgptlay",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->header_data_size,
+	 header_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->number_of_partitions,
+	 number_of_partitions );
+
+	if( format_version != LIBVSGPT_VOLUME_LAYOUT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( header_data_size != (uint32_t) sizeof( vsgpt_volume_layout_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout header data size: %" PRIu32 ".",
+		 function,
+		 header_data_size );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_partitions != ( ( layout_data_size - sizeof( vsgpt_volume_layout_header_t ) - sizeof( vsgpt_volume_layout_footer_t ) ) / sizeof( vsgpt_volume_layout_partition_t ) )
+	 || ( ( ( layout_data_size - sizeof( vsgpt_volume_layout_header_t ) - sizeof( vsgpt_volume_layout_footer_t ) ) % sizeof( vsgpt_volume_layout_partition_t ) ) != 0 )
+	 || ( number_of_partitions > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( layout_data[ layout_data_size - sizeof( vsgpt_volume_layout_footer_t ) ] ),
+	 stored_checksum );
+
+	if( libvsgpt_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     layout_data,
+	     layout_data_size - sizeof( vsgpt_volume_layout_footer_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in layout checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->bytes_per_sector,
+	 bytes_per_sector );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->flags,
+	 flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->volume_size,
+	 stored_volume_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->fingerprint,
+	 stored_fingerprint );
+
+	if( ( bytes_per_sector != 512 )
+	 && ( bytes_per_sector != 1024 )
+	 && ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout bytes per sector: %" PRIu32 ".",
+		 function,
+		 bytes_per_sector );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size != stored_volume_size )
+	{
+		return( 0 );
+	}
+	internal_volume->io_handle->bytes_per_sector = (size_t) bytes_per_sector;
+
+	number_of_volume_blocks = (uint64_t) ( volume_size / bytes_per_sector );
+
+	if( libvsgpt_internal_volume_calculate_fingerprint(
+	     internal_volume,
+	     file_io_handle,
+	     &fingerprint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( fingerprint != stored_fingerprint )
+	{
+		internal_volume->io_handle->bytes_per_sector = 512;
+
+		return( 0 );
+	}
+	if( libvsgpt_partition_table_header_initialize(
+	     &( internal_volume->partition_table_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->header_block_number,
+	 internal_volume->partition_table_header->partition_header_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->backup_header_block_number,
+	 internal_volume->partition_table_header->backup_partition_header_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->area_start_block_number,
+	 internal_volume->partition_table_header->partition_area_start_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->area_end_block_number,
+	 internal_volume->partition_table_header->partition_area_end_block_number );
+
+	if( memory_copy(
+	     internal_volume->partition_table_header->disk_identifier,
+	     layout_header->disk_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy disk identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 layout_header->entries_start_block_number,
+	 internal_volume->partition_table_header->partition_entries_start_block_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->number_of_entries,
+	 internal_volume->partition_table_header->number_of_partition_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->entry_data_size,
+	 internal_volume->partition_table_header->partition_entry_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 layout_header->entries_data_checksum,
+	 internal_volume->partition_table_header->partition_entries_data_checksum );
+
+	if( ( flags & LIBVSGPT_VOLUME_LAYOUT_FLAG_HEADER_IS_CORRUPT ) != 0 )
+	{
+		internal_volume->partition_table_header->is_corrupt = 1;
+	}
+	if( number_of_partitions > 0 )
+	{
+		if( libvsgpt_partition_values_array_resize(
+		     internal_volume->partitions,
+		     (int) number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize partitions array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = sizeof( vsgpt_volume_layout_header_t );
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		layout_partition = (vsgpt_volume_layout_partition_t *) &( layout_data[ data_offset ] );
+
+		if( memory_set(
+		     &partition_values,
+		     0,
+		     sizeof( libvsgpt_partition_values_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partition values.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 layout_partition->entry_index,
+		 partition_values.entry_index );
+
+		partition_values.type = layout_partition->type;
+
+		if( memory_copy(
+		     partition_values.type_identifier,
+		     layout_partition->type_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy type identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     partition_values.identifier,
+		     layout_partition->identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 layout_partition->offset,
+		 partition_values.offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 layout_partition->size,
+		 partition_values.size );
+
+		/* Apply the same bounds as the partition entries to the stored offset and size
+		 */
+		if( ( partition_values.offset < 0 )
+		 || ( ( (size64_t) partition_values.offset % bytes_per_sector ) != 0 )
+		 || ( partition_values.size == 0 )
+		 || ( ( partition_values.size % bytes_per_sector ) != 0 ) )
+		{
+			goto on_invalid_layout;
+		}
+		start_block_number = (uint64_t) partition_values.offset / bytes_per_sector;
+		number_of_blocks   = (uint64_t) partition_values.size / bytes_per_sector;
+
+		if( ( start_block_number < internal_volume->partition_table_header->partition_area_start_block_number )
+		 || ( start_block_number >= number_of_volume_blocks ) )
+		{
+			goto on_invalid_layout;
+		}
+		/* The end block number is start block number + number of blocks - 1
+		 */
+		if( ( number_of_blocks - 1 ) > ( number_of_volume_blocks - start_block_number ) )
+		{
+			goto on_invalid_layout;
+		}
+		if( libvsgpt_partition_values_array_append_values(
+		     internal_volume->partitions,
+		     &partition_values,
+		     &values_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition to array.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += sizeof( vsgpt_volume_layout_partition_t );
+	}
+	if( libvsgpt_offset_index_build(
+	     internal_volume->offset_index,
+	     internal_volume->partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build partitions offset index.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->size        = volume_size;
+	internal_volume->fingerprint = fingerprint;
+
+	if( ( flags & LIBVSGPT_VOLUME_LAYOUT_FLAG_IS_CORRUPT ) != 0 )
+	{
+		internal_volume->is_corrupt = 1;
+	}
+	return( 1 );
+
+on_invalid_layout:
+	result = 0;
+
+on_error:
+	if( internal_volume->partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &( internal_volume->partition_table_header ),
+		 NULL );
+	}
+	libvsgpt_partition_values_array_empty(
+	 internal_volume->partitions,
+	 NULL );
+
+	internal_volume->io_handle->bytes_per_sector = 512;
+
+	return( result );
+}
+
+/* Reads a partition table header from the metadata cache
+ * The signature is checked before the header is read, so that a probe miss is cheap
+ * Returns 1 if successful, 0 if no partition table header was found at the offset or -1 on error
+ */
+int libvsgpt_internal_volume_read_partition_table_header(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_partition_table_header_t *partition_table_header,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *header_data = NULL;
+	static char *function      = "libvsgpt_internal_volume_read_partition_table_header";
+	int result                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          file_offset,
+	          512,
+	          &header_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition table header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libvsgpt_partition_table_header_check_signature(
+		          header_data,
+		          512,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check partition table header signature.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libvsgpt_partition_table_header_read_data(
+	          partition_table_header,
+	          header_data,
+	          512,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition table header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the partition table header and the backup
+ * The sector size is probed using the data in the metadata cache
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_read_partition_table_headers(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_table_header_t *backup_partition_table_header = NULL;
+	libvsgpt_partition_table_header_t *partition_table_header        = NULL;
+	static char *function                                            = "libvsgpt_internal_volume_read_partition_table_headers";
+	off64_t file_offset                                              = 0;
+	int result                                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->partition_table_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - partition table header already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading GUID Partition Table (GPT) header.\n",
+		 function );
+	}
+#endif
+	if( libvsgpt_partition_table_header_initialize(
+	     &partition_table_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_PARTITION_TABLE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->io_handle->bytes_per_sector = 512;
+
+	result = libvsgpt_internal_volume_read_partition_table_header(
+	         internal_volume,
+	         file_io_handle,
+	         metadata_cache,
+	         partition_table_header,
+	         (off64_t) internal_volume->io_handle->bytes_per_sector,
+	         error );
+
+	while( ( result == 0 )
+	    && ( internal_volume->io_handle->bytes_per_sector < 4096 ) )
+	{
+		internal_volume->io_handle->bytes_per_sector *= 2;
+
+		result = libvsgpt_internal_volume_read_partition_table_header(
+		         internal_volume,
+		         file_io_handle,
+		         metadata_cache,
+		         partition_table_header,
+		         (off64_t) internal_volume->io_handle->bytes_per_sector,
+		         error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bytes per sector\t: %" PRIzd ".\n",
+		 function,
+		 internal_volume->io_handle->bytes_per_sector );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( partition_table_header->partition_header_block_number != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported partition table header block number: %" PRIu64 ".",
+		 function,
+		 partition_table_header->partition_header_block_number );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading backup GUID Partition Table (GPT) header.\n",
+		 function );
+	}
+#endif
+	if( libvsgpt_partition_table_header_initialize(
+	     &backup_partition_table_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create backup partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_BACKUP_PARTITION_TABLE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	result      = 0;
+	file_offset = partition_table_header->backup_partition_header_block_number * internal_volume->io_handle->bytes_per_sector;
+
+	if( file_offset > 0 )
+	{
+		result = libvsgpt_internal_volume_read_partition_table_header(
+		         internal_volume,
+		         file_io_handle,
+		         metadata_cache,
+		         backup_partition_table_header,
+		         file_offset,
+		         error );
+	}
+	if( ( result == 0 )
+	 || ( file_offset == 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: invalid backup partition header block number fallback to last block.\n",
+			 function );
+		}
+#endif
+		file_offset = internal_volume->size - internal_volume->io_handle->bytes_per_sector;
+
+		result = libvsgpt_internal_volume_read_partition_table_header(
+		         internal_volume,
+		         file_io_handle,
+		         metadata_cache,
+		         backup_partition_table_header,
+		         file_offset,
+		         error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read backup partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( partition_table_header->is_corrupt != 0 )
+	 && ( backup_partition_table_header->is_corrupt != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: partition table header and backup are both corrupt.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( partition_table_header->is_corrupt != 0 )
+	 || ( backup_partition_table_header->is_corrupt != 0 ) )
+	{
+		internal_volume->is_corrupt = 1;
+	}
+	else
+	{
+		if( partition_table_header->partition_header_block_number != backup_partition_table_header->backup_partition_header_block_number )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of partition table header block number.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( partition_table_header->backup_partition_header_block_number != backup_partition_table_header->partition_header_block_number )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of backup partition table header block number.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( partition_table_header->partition_area_start_block_number != backup_partition_table_header->partition_area_start_block_number )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of partition area start block number.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( partition_table_header->partition_area_end_block_number != backup_partition_table_header->partition_area_end_block_number )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of partition area end block number.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( memory_compare(
+		     partition_table_header->disk_identifier,
+		     backup_partition_table_header->disk_identifier,
+		     16 ) != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of disk identifier.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		/* The partition entries start block number will be different
+		 */
+		if( partition_table_header->number_of_partition_entries != backup_partition_table_header->number_of_partition_entries )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of number of partition entries.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( partition_table_header->partition_entry_data_size != backup_partition_table_header->partition_entry_data_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of partition entry data size.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+		if( partition_table_header->partition_entries_data_checksum != backup_partition_table_header->partition_entries_data_checksum )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch of partition entries data checksum.\n",
+				 function );
+			}
+#endif
+			internal_volume->is_corrupt = 1;
+		}
+	}
+	if( partition_table_header->is_corrupt != 0 )
+	{
+		if( libvsgpt_partition_table_header_free(
+		     &partition_table_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition table header.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->partition_table_header = backup_partition_table_header;
+	}
+	else
+	{
+		if( libvsgpt_partition_table_header_free(
+		     &backup_partition_table_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free backup partition table header.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->partition_table_header = partition_table_header;
+	}
+	return( 1 );
+
+on_error:
+	if( backup_partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &backup_partition_table_header,
+		 NULL );
+	}
+	if( partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &partition_table_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Recovers the partition table from the backup when the partition table header is corrupt
+ * The partition table header is probed using the data in the metadata cache
+ * Returns 1 if the partition table was read from the backup, 0 if the partition table header is not corrupt or -1 on error
+ */
+int libvsgpt_internal_volume_recover_partition_table(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *probe_error                            = NULL;
+	libvsgpt_partition_table_header_t *partition_table_header = NULL;
+	const uint8_t *header_data                                = NULL;
+	static char *function                                     = "libvsgpt_internal_volume_recover_partition_table";
+	size_t bytes_per_sector                                   = 0;
+	int result                                                = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_PARTITION_TABLE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	for( bytes_per_sector = 512;
+	     bytes_per_sector <= 4096;
+	     bytes_per_sector *= 2 )
+	{
+		result = libvsgpt_metadata_cache_get_data(
+		          metadata_cache,
+		          file_io_handle,
+		          (off64_t) bytes_per_sector,
+		          512,
+		          &header_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition table header data at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 bytes_per_sector,
+			 bytes_per_sector );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = libvsgpt_partition_table_header_check_signature(
+			          header_data,
+			          512,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to check partition table header signature.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		if( libvsgpt_partition_table_header_initialize(
+		     &partition_table_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition table header.",
+			 function );
+
+			goto on_error;
+		}
+		/* A partition table header that cannot be read is handled as corrupt
+		 * its read error is kept out of the error chain of the caller
+		 */
+		result = libvsgpt_partition_table_header_read_data(
+		          partition_table_header,
+		          header_data,
+		          512,
+		          &probe_error );
+
+		if( result == -1 )
+		{
+			libcerror_error_free(
+			 &probe_error );
+
+			result = 0;
+		}
+		else if( ( partition_table_header->is_corrupt != 0 )
+		      || ( partition_table_header->partition_header_block_number != 1 ) )
+		{
+			result = 0;
+		}
+		if( libvsgpt_partition_table_header_free(
+		     &partition_table_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition table header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: partition table header is corrupt reading backup GUID Partition Table (GPT).\n",
+		 function );
+	}
+#endif
+	result = libvsgpt_internal_volume_read_backup_partition_table(
+	          internal_volume,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read backup partition table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: partition table header is corrupt and missing valid backup.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->is_corrupt = 1;
+
+	return( 1 );
+
+on_error:
+	if( partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &partition_table_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the backup partition table header and partition entries
+ * The backup partition table header and the partition entries that precede it
+ * are read from the end of the volume at once
+ * Returns 1 if successful, 0 if no valid backup partition table header was found or -1 on error
+ */
+int libvsgpt_internal_volume_read_backup_partition_table(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *probe_error                                   = NULL;
+	libvsgpt_partition_table_header_t *backup_partition_table_header = NULL;
+	uint8_t *backup_data                                             = NULL;
+	static char *function                                            = "libvsgpt_internal_volume_read_backup_partition_table";
+	size64_t partition_entries_data_size                             = 0;
+	size_t backup_data_size                                          = 0;
+	size_t bytes_per_sector                                          = 0;
+	ssize_t read_count                                               = 0;
+	off64_t file_offset                                              = 0;
+	off64_t header_offset                                            = 0;
+	off64_t partition_entries_offset                                 = 0;
+	uint64_t last_block_number                                       = 0;
+	uint32_t partition_entry_index                                   = 0;
+	int result                                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->partition_table_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - partition table header already set.",
+		 function );
+
+		return( -1 );
+	}
+	backup_data_size = LIBVSGPT_BACKUP_PARTITION_TABLE_DATA_SIZE;
+
+	if( (size64_t) backup_data_size > internal_volume->size )
+	{
+		backup_data_size = (size_t) internal_volume->size;
+	}
+	if( backup_data_size < 1024 )
+	{
+		return( 0 );
+	}
+	file_offset = (off64_t) ( internal_volume->size - backup_data_size );
+
+	if( libvsgpt_io_handle_check_abort(
+	     internal_volume->io_handle,
+	     internal_volume->deadline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to continue reading backup partition table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_BACKUP_PARTITION_TABLE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	backup_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * backup_data_size );
+
+	if( backup_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create backup data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading backup partition table at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              internal_volume->io_trace,
+	              file_io_handle,
+	              backup_data,
+	              backup_data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) backup_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read backup partition table data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_table_header_initialize(
+	     &backup_partition_table_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create backup partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The backup partition table header is stored in the last block of the volume
+	 * and the sector size is the one for which the header refers to that block
+	 */
+	for( bytes_per_sector = 512;
+	     bytes_per_sector <= 4096;
+	     bytes_per_sector *= 2 )
+	{
+		last_block_number = (uint64_t) ( internal_volume->size / bytes_per_sector ) - 1;
+		header_offset     = (off64_t) ( last_block_number * bytes_per_sector );
+
+		if( header_offset < file_offset )
+		{
+			break;
+		}
+		result = libvsgpt_partition_table_header_check_signature(
+		          &( backup_data[ header_offset - file_offset ] ),
+		          512,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check backup partition table header signature.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			backup_partition_table_header->is_corrupt = 0;
+
+			/* A backup partition table header that cannot be read is handled as corrupt
+			 */
+			result = libvsgpt_partition_table_header_read_data(
+			          backup_partition_table_header,
+			          &( backup_data[ header_offset - file_offset ] ),
+			          512,
+			          &probe_error );
+
+			if( result == -1 )
+			{
+				libcerror_error_free(
+				 &probe_error );
+
+				result = 0;
+			}
+			else if( ( backup_partition_table_header->is_corrupt != 0 )
+			      || ( backup_partition_table_header->partition_header_block_number != last_block_number ) )
+			{
+				result = 0;
+			}
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		if( libvsgpt_partition_table_header_free(
+		     &backup_partition_table_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free backup partition table header.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 backup_data );
+
+		return( 0 );
+	}
+	internal_volume->io_handle->bytes_per_sector = bytes_per_sector;
+	internal_volume->partition_table_header      = backup_partition_table_header;
+	backup_partition_table_header                = NULL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bytes per sector\t: %" PRIzd ".\n",
+		 function,
+		 internal_volume->io_handle->bytes_per_sector );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( internal_volume->partition_table_header->partition_entries_start_block_number >= last_block_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid backup partition table header - partition entries start block number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	partition_entries_offset    = (off64_t) ( internal_volume->partition_table_header->partition_entries_start_block_number * bytes_per_sector );
+	partition_entries_data_size = (size64_t) internal_volume->partition_table_header->partition_entry_data_size * internal_volume->partition_table_header->number_of_partition_entries;
+
+	if( libvsgpt_io_trace_start_phase(
+	     internal_volume->io_trace,
+	     LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	/* The backup partition entries normally precede the backup partition table header
+	 * and were read together with it, otherwise they are read separately
+	 */
+	if( ( internal_volume->partition_table_header->partition_entry_data_size >= 128 )
+	 && ( internal_volume->partition_table_header->partition_entry_data_size <= LIBVSGPT_MAXIMUM_PARTITION_ENTRIES_CHUNK_SIZE )
+	 && ( partition_entries_data_size > 0 )
+	 && ( partition_entries_offset >= file_offset )
+	 && ( partition_entries_data_size <= (size64_t) ( internal_volume->size - partition_entries_offset ) ) )
+	{
+		result = libvsgpt_internal_volume_read_partition_entries_data(
+		          internal_volume,
+		          &( backup_data[ partition_entries_offset - file_offset ] ),
+		          (size_t) partition_entries_data_size,
+		          &partition_entry_index,
+		          error );
+	}
+	else
+	{
+		result = libvsgpt_internal_volume_read_partition_entries(
+		          internal_volume,
+		          file_io_handle,
+		          partition_entries_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_io_trace_end_phase(
+	     internal_volume->io_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end IO trace phase.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 backup_data );
+
+	return( 1 );
+
+on_error:
+	if( internal_volume->partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &( internal_volume->partition_table_header ),
+		 NULL );
+	}
+	if( backup_partition_table_header != NULL )
+	{
+		libvsgpt_partition_table_header_free(
+		 &backup_partition_table_header,
+		 NULL );
+	}
+	if( backup_data != NULL )
+	{
+		memory_free(
+		 backup_data );
+	}
+	return( -1 );
+}
+
+/* Reads partition entries
+ * The partition entries are read in chunks to bound memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_read_partition_entries(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *partition_entries_data      = NULL;
+	static char *function                = "libvsgpt_internal_volume_read_partition_entries";
+	size64_t partition_entries_data_size = 0;
+	size_t chunk_data_size               = 0;
+	size_t partition_entry_data_size     = 0;
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	uint32_t number_of_partition_entries = 0;
+	uint32_t partition_entry_index       = 0;
+	int maximum_number_of_values         = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->partition_table_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing partition table header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_volume->partition_table_header->partition_entry_data_size < 128 )
+	 || ( internal_volume->partition_table_header->partition_entry_data_size > LIBVSGPT_MAXIMUM_PARTITION_ENTRIES_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - invalid partition table table header - partition entry data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	partition_entry_data_size   = (size_t) internal_volume->partition_table_header->partition_entry_data_size;
+	number_of_partition_entries = internal_volume->partition_table_header->number_of_partition_entries;
+
+	if( number_of_partition_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* The partition entries are bound by the volume size instead of a fixed number of sectors
+	 */
+	partition_entries_data_size = (size64_t) partition_entry_data_size * (size64_t) number_of_partition_entries;
+
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= internal_volume->size )
+	 || ( partition_entries_data_size > ( internal_volume->size - (size64_t) file_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - invalid partition table table header - number of partition entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reserve the partition values for a typical partition entries array up front
+	 */
+	maximum_number_of_values = 128;
+
+	if( number_of_partition_entries < (uint32_t) maximum_number_of_values )
+	{
+		maximum_number_of_values = (int) number_of_partition_entries;
+	}
+	if( internal_volume->partitions->maximum_number_of_values < maximum_number_of_values )
+	{
+		if( libvsgpt_partition_values_array_resize(
+		     internal_volume->partitions,
+		     maximum_number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize partitions array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	chunk_data_size = ( LIBVSGPT_MAXIMUM_PARTITION_ENTRIES_CHUNK_SIZE / partition_entry_data_size ) * partition_entry_data_size;
+
+	if( (size64_t) chunk_data_size > partition_entries_data_size )
+	{
+		chunk_data_size = (size_t) partition_entries_data_size;
+	}
+	partition_entries_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * chunk_data_size );
+
+	if( partition_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition entries data.",
+		 function );
+
+		goto on_error;
+	}
+	while( partition_entries_data_size > 0 )
+	{
+		if( libvsgpt_io_handle_check_abort(
+		     internal_volume->io_handle,
+		     internal_volume->deadline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to continue reading partition entries at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		read_size = chunk_data_size;
+
+		if( (size64_t) read_size > partition_entries_data_size )
+		{
+			read_size = (size_t) partition_entries_data_size;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading partition entries at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		read_count = libvsgpt_io_trace_read_buffer_at_offset(
+		              internal_volume->io_trace,
+		              file_io_handle,
+		              partition_entries_data,
+		              read_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset                 += (off64_t) read_size;
+		partition_entries_data_size -= read_size;
+
+		if( libvsgpt_internal_volume_read_partition_entries_data(
+		     internal_volume,
+		     partition_entries_data,
+		     read_size,
+		     &partition_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition entries data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 partition_entries_data );
+
+	return( 1 );
+
+on_error:
+	if( partition_entries_data != NULL )
+	{
+		memory_free(
+		 partition_entries_data );
+	}
+	return( -1 );
+}
+
+/* Reads partition entries from data
+ * The data size must be a multiple of the partition entry data size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_read_partition_entries_data(
+     libvsgpt_internal_volume_t *internal_volume,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *partition_entry_index,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_values_t partition_values;
+
+	uint8_t empty_partition_type[ 16 ]          = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	libvsgpt_partition_entry_t *partition_entry = NULL;
+	static char *function                       = "libvsgpt_internal_volume_read_partition_entries_data";
+	size_t data_offset                          = 0;
+	size_t partition_entry_data_size            = 0;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->partition_table_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing partition table header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition entry index.",
+		 function );
+
+		return( -1 );
+	}
+	partition_entry_data_size = (size_t) internal_volume->partition_table_header->partition_entry_data_size;
+
+	if( ( partition_entry_data_size < 128 )
+	 || ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % partition_entry_data_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Skip chunks that only contain unused partition entries
+	 */
+	if( data[ 0 ] == 0 )
+	{
+		result = libvsgpt_partition_entry_check_for_empty_block(
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if partition entries data is empty.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*partition_entry_index += (uint32_t) ( data_size / partition_entry_data_size );
+
+			return( 1 );
+		}
+	}
+	if( libvsgpt_partition_entry_initialize(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset += partition_entry_data_size )
+	{
+		/* Ignore empty partition entries
+		 */
+		if( memory_compare(
+		     &( data[ data_offset ] ),
+		     empty_partition_type,
+		     16 ) == 0 )
+		{
+			*partition_entry_index += 1;
+
+			continue;
+		}
+		if( libvsgpt_partition_entry_read_data(
+		     partition_entry,
+		     &( data[ data_offset ] ),
+		     partition_entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition entry data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     &partition_values,
+		     0,
+		     sizeof( libvsgpt_partition_values_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partition values.",
+			 function );
+
+			goto on_error;
+		}
+/* TODO refactor to libvsgtp_partition_values_copy_from_partition_entry */
+		if( memory_copy(
+		     partition_values.type_identifier,
+		     partition_entry->type_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to copy type identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     partition_values.identifier,
+		     partition_entry->identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to copy identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( partition_entry->start_block_number < internal_volume->partition_table_header->partition_area_start_block_number )
+		 || ( partition_entry->start_block_number >= (uint64_t) ( internal_volume->size / internal_volume->io_handle->bytes_per_sector ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid partition entry - start block number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( partition_entry->end_block_number < partition_entry->start_block_number )
+		 || ( partition_entry->end_block_number > (uint64_t) ( internal_volume->size / internal_volume->io_handle->bytes_per_sector ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid partition entry - end block number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		partition_values.entry_index = *partition_entry_index;
+		partition_values.offset      = (off64_t) ( partition_entry->start_block_number * internal_volume->io_handle->bytes_per_sector );
+		partition_values.size        = (size64_t) ( ( partition_entry->end_block_number - partition_entry->start_block_number + 1 ) * internal_volume->io_handle->bytes_per_sector );
+
+		if( libvsgpt_partition_values_array_append_values(
+		     internal_volume->partitions,
+		     &partition_values,
+		     &entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition to array.",
+			 function );
+
+			goto on_error;
+		}
+		*partition_entry_index += 1;
+	}	if( libvsgpt_partition_entry_free(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( partition_entry != NULL )
+	{
+		libvsgpt_partition_entry_free(
+		 &partition_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an extended partition record from the metadata cache
+ * Returns 1 if successful, 0 if no extended partition record was found at the offset or -1 on error
+ */
+int libvsgpt_internal_volume_read_extended_partition_record(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_boot_record_t *extended_partition_record,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data = NULL;
+	static char *function      = "libvsgpt_internal_volume_read_extended_partition_record";
+	int result                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset <= 0 )
+	{
+		return( 0 );
+	}
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          file_offset,
+	          512,
+	          &record_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extended partition record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libvsgpt_boot_record_check_signature(
+		          record_data,
+		          512,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check extended partition record signature.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libvsgpt_boot_record_read_data(
+	     extended_partition_record,
+	     record_data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extended partition record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads partition entries in a master boot record and its chain of extended partition records
+ * The chain is traversed iteratively, the extended partition records are read from
+ * the metadata cache and the offsets of visited records are kept to detect loops
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_read_mbr_partition_entries(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_boot_record_t *master_boot_record,
+     libcerror_error_t **error )
+{
+	off64_t visited_offsets[ LIBVSGPT_EXTENDED_PARTITION_RECORDS_VISITED_CACHE_SIZE ];
+
+	libvsgpt_boot_record_t *boot_record               = NULL;
+	libvsgpt_boot_record_t *extended_partition_record = NULL;
+	libvsgpt_mbr_partition_entry_t *extended_entry    = NULL;
+	libvsgpt_mbr_partition_entry_t *partition_entry   = NULL;
+	static char *function                             = "libvsgpt_internal_volume_read_mbr_partition_entries";
+	off64_t extended_partition_record_offset          = 0;
+	off64_t file_offset                               = 0;
+	off64_t first_extended_boot_record_offset         = 0;
+	uint32_t visited_index                            = 0;
+	int number_of_extended_partition_records          = 0;
+	int partition_entry_index                         = 0;
+	int result                                        = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( master_boot_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid master boot record.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     visited_offsets,
+	     0,
+	     sizeof( off64_t ) * LIBVSGPT_EXTENDED_PARTITION_RECORDS_VISITED_CACHE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visited offsets.",
+		 function );
+
+		return( -1 );
+	}
+	boot_record = master_boot_record;
+
+	while( boot_record != NULL )
+	{
+		if( libvsgpt_io_handle_check_abort(
+		     internal_volume->io_handle,
+		     internal_volume->deadline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to continue reading extended partition records.",
+			 function );
+
+			goto on_error;
+		}
+		extended_entry = NULL;
+
+		for( partition_entry_index = 0;
+		     partition_entry_index < 4;
+		     partition_entry_index++ )
+		{
+			if( libvsgpt_boot_record_get_partition_entry_by_index(
+			     boot_record,
+			     partition_entry_index,
+			     &partition_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition entry: %d.",
+				 function,
+				 partition_entry_index );
+
+				goto on_error;
+			}
+			if( partition_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing partition entry: %d.",
+				 function,
+				 partition_entry_index );
+
+				goto on_error;
+			}
+			/* Ignore empty partition entries
+			 */
+			if( partition_entry->type == 0 )
+			{
+				continue;
+			}
+			if( ( partition_entry->type == 0x05 )
+			 || ( ( boot_record == master_boot_record )
+			  &&  ( partition_entry->type == 0x0f ) ) )
+			{
+				if( extended_entry != NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: more than 1 extended partition entry per table is not supported.",
+					 function );
+
+					goto on_error;
+				}
+				extended_entry = partition_entry;
+			}
+/* TODO do bytes per sector check for known volume types and GPT */
+		}
+		if( extended_entry == NULL )
+		{
+			break;
+		}
+		if( number_of_extended_partition_records >= LIBVSGPT_MAXIMUM_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of extended partition records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( extended_partition_record == NULL )
+		{
+			if( libvsgpt_boot_record_initialize(
+			     &extended_partition_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create extended partition record.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) extended_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 extended_partition_record_offset,
+			 extended_partition_record_offset );
+		}
+#endif
+		/* Note that the partition entries of the current boot record are no longer
+		 * accessed when the extended partition record is read
+		 */
+		result = libvsgpt_internal_volume_read_extended_partition_record(
+		          internal_volume,
+		          file_io_handle,
+		          metadata_cache,
+		          extended_partition_record,
+		          extended_partition_record_offset,
+		          error );
+
+		/* Linux fdisk supports sector sizes of: 512, 1024, 2048, 4096
+		 */
+		while( ( result == 0 )
+		    && ( boot_record == master_boot_record )
+		    && ( internal_volume->io_handle->bytes_per_sector <= 4096 ) )
+		{
+			internal_volume->io_handle->bytes_per_sector *= 2;
+
+			extended_partition_record_offset = (off64_t) extended_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 extended_partition_record_offset,
+				 extended_partition_record_offset );
+			}
+#endif
+			result = libvsgpt_internal_volume_read_extended_partition_record(
+			          internal_volume,
+			          file_io_handle,
+			          metadata_cache,
+			          extended_partition_record,
+			          extended_partition_record_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extended partition record.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( extended_partition_record_offset == 0 )
+		 || ( extended_partition_record_offset == file_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unsupported extended partition record offset.",
+			 function );
+
+			goto on_error;
+		}
+		/* The visited offsets are stored in an open addressing hash table,
+		 * where 0 marks an unused slot
+		 */
+		visited_index = (uint32_t) ( ( (uint64_t) extended_partition_record_offset >> 9 ) * 0x9e3779b1UL );
+
+		for( ;; )
+		{
+			visited_index &= LIBVSGPT_EXTENDED_PARTITION_RECORDS_VISITED_CACHE_SIZE - 1;
+
+			if( visited_offsets[ visited_index ] == 0 )
+			{
+				visited_offsets[ visited_index ] = extended_partition_record_offset;
+
+				break;
+			}
+			if( visited_offsets[ visited_index ] == extended_partition_record_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported extended partition record offset: %" PRIi64 " - loop detected.",
+				 function,
+				 extended_partition_record_offset );
+
+				goto on_error;
+			}
+			visited_index++;
+		}
+		if( boot_record == master_boot_record )
+		{
+			first_extended_boot_record_offset = extended_partition_record_offset;
+		}
+		file_offset = extended_partition_record_offset;
+		boot_record = extended_partition_record;
+
+		number_of_extended_partition_records++;
+	}
+	if( extended_partition_record != NULL )
+	{
+		if( libvsgpt_boot_record_free(
+		     &extended_partition_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extended partition record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( extended_partition_record != NULL )
+	{
+		libvsgpt_boot_record_free(
+		 &extended_partition_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the volume is corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libvsgpt_volume_is_corrupted(
+     libvsgpt_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_is_corrupted";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->is_corrupt != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_get_bytes_per_sector(
+     libvsgpt_volume_t *volume,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_get_bytes_per_sector";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the disk identifier
+ * The identifier is a GUID stored in little-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_get_disk_identifier(
+     libvsgpt_volume_t *volume,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_get_disk_identifier";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( internal_volume->partition_table_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing partition table header.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsgpt_partition_table_header_get_disk_identifier(
+	     internal_volume->partition_table_header,
+	     guid_data,
+	     guid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve disk identifier.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_get_number_of_partitions(
+     libvsgpt_volume_t *volume,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_get_number_of_partitions";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsgpt_partition_values_array_get_number_of_values(
+	     internal_volume->partitions,
+	     number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions from array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific partition
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_get_partition_by_index(
+     libvsgpt_volume_t *volume,
+     int partition_index,
+     libvsgpt_partition_t **partition,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume   = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsgpt_volume_get_partition_by_index";
+	int result                                    = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsgpt_partition_values_array_get_values_by_index(
+	     internal_volume->partitions,
+	     partition_index,
+	     &partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition values: %d from array.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	else
+	{
+		if( libvsgpt_partition_initialize(
+		     partition,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->buffer,
+		     internal_volume->buffer_size,
+		     partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition: %d.",
+			 function,
+			 partition_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the partition values with the corresponding (partition) entry index
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libvsgpt_internal_volume_get_partition_values_by_identifier(
+     libvsgpt_internal_volume_t *internal_volume,
+     uint32_t entry_index,
+     libvsgpt_partition_values_t **partition_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_volume_get_partition_values_by_identifier";
+	int partition_index   = 0;
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvsgpt_partition_values_array_get_index_by_entry_index(
+	          internal_volume->partitions,
+	          entry_index,
+	          &partition_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition index for entry index: %" PRIu32 ".",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libvsgpt_partition_values_array_get_values_by_index(
+		     internal_volume->partitions,
+		     partition_index,
+		     partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition values: %d from array.",
+			 function,
+			 partition_index );
+
+			return( -1 );
 		}
-		if( partition_entry == NULL )
+	}
+	return( result );
+}
+
+/* Determines if the volume contains a partition with the corresponding (partition) entry index
+ * Returns 1 if the volume contains such a partition, 0 if not or -1 on error
+ */
+int libvsgpt_volume_has_partition_with_identifier(
+     libvsgpt_volume_t *volume,
+     uint32_t entry_index,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume   = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsgpt_volume_has_partition_with_identifier";
+	int result                                    = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libvsgpt_internal_volume_get_partition_values_by_identifier(
+	          internal_volume,
+	          entry_index,
+	          &partition_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the partition with the corresponding (partition) entry index
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libvsgpt_volume_get_partition_by_identifier(
+     libvsgpt_volume_t *volume,
+     uint32_t entry_index,
+     libvsgpt_partition_t **partition,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume   = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsgpt_volume_get_partition_by_identifier";
+	int result                                    = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libvsgpt_internal_volume_get_partition_values_by_identifier(
+	          internal_volume,
+	          entry_index,
+	          &partition_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition values.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libvsgpt_partition_initialize(
+		     partition,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->buffer,
+		     internal_volume->buffer_size,
+		     partition_values,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing partition entry: %" PRIu8 ".",
-			 function,
-			 partition_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition.",
+			 function );
 
-			goto on_error;
-		}
-		/* Ignore empty partition entries
-		 */
-		if( partition_entry->type == 0 )
-		{
-			continue;
+			result = -1;
 		}
-		if( ( partition_entry->type == 0x05 )
-		 || ( ( is_master_boot_record != 0 )
-		  &&  ( partition_entry->type == 0x0f ) ) )
-		{
-			if( extended_partition_record != NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: more than 1 extended partition entry per table is not supported.",
-				 function );
-
-				goto on_error;
-			}
-			extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-				 function,
-				 extended_partition_record_offset,
-				 extended_partition_record_offset );
-			}
+		result = -1;
+	}
 #endif
-			if( libvsgpt_boot_record_initialize(
-			     &extended_partition_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extended partition record.",
-				 function );
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	return( result );
 
-				goto on_error;
-			}
-			result = libvsgpt_boot_record_read_file_io_handle(
-				  extended_partition_record,
-				  file_io_handle,
-				  extended_partition_record_offset,
-				  error );
+on_error:
+	if( *partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 partition,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			/* Linux fdisk supports sector sizes of: 512, 1024, 2048, 4096
-			 */
-			while( ( result != 1 )
-			    && ( is_master_boot_record != 0 )
-			    && ( internal_volume->io_handle->bytes_per_sector <= 4096 ) )
-			{
-				libcerror_error_free(
-				 error );
+/* Retrieves the index of the partition that contains a specific volume offset
+ * The partition offset is set to the offset relative to the start of the partition
+ * Returns 1 if successful, 0 if no such partition or -1 on error
+ */
+int libvsgpt_volume_get_partition_index_by_volume_offset(
+     libvsgpt_volume_t *volume,
+     off64_t volume_offset,
+     int *partition_index,
+     off64_t *partition_offset,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_get_partition_index_by_volume_offset";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-				internal_volume->io_handle->bytes_per_sector *= 2;
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-				extended_partition_record_offset = (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector;
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-					 function,
-					 extended_partition_record_offset,
-					 extended_partition_record_offset );
-				}
+		return( -1 );
+	}
 #endif
-				result = libvsgpt_boot_record_read_file_io_handle(
-					  extended_partition_record,
-					  file_io_handle,
-					  extended_partition_record_offset,
-					  error );
-			}
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read extended partition record.",
-				 function );
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          internal_volume->offset_index,
+	          volume_offset,
+	          partition_index,
+	          partition_offset,
+	          error );
 
-				goto on_error;
-			}
-		}
-		else
-		{
-/* TODO do bytes per sector check for known volume types and GPT */
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition index for volume offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 volume_offset,
+		 volume_offset );
 
-#ifdef TODO
-			if( libvsgpt_partition_values_initialize(
-			     &partition_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create partition values.",
-				 function );
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-				goto on_error;
-			}
-			partition_values->type = partition_entry->type;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-			partition_values->offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
-			partition_values->size   = partition_entry->number_of_sectors * internal_volume->io_handle->bytes_per_sector;
+/* Retrieves the partition that contains a specific volume offset
+ * The partition offset is set to the offset relative to the start of the partition
+ * Returns 1 if successful, 0 if no such partition or -1 on error
+ */
+int libvsgpt_volume_get_partition_by_volume_offset(
+     libvsgpt_volume_t *volume,
+     off64_t volume_offset,
+     libvsgpt_partition_t **partition,
+     off64_t *partition_offset,
+     libcerror_error_t **error )
+{
+	libvsgpt_internal_volume_t *internal_volume   = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsgpt_volume_get_partition_by_volume_offset";
+	int partition_index                           = 0;
+	int result                                    = 0;
 
-/* TODO offset and size sanity check */
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-			if( libcdata_array_append_entry(
-			     internal_volume->partitions,
-			     &entry_index,
-			     (intptr_t *) partition_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append partition to array.",
-				 function );
+		return( -1 );
+	}
+	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-				goto on_error;
-			}
-			partition_values = NULL;
-#endif /* TODO */
-		}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
 	}
-	if( extended_partition_record != NULL )
+	if( *partition != NULL )
 	{
-		if( ( extended_partition_record_offset == 0 )
-		 || ( extended_partition_record_offset == file_offset ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported extended partition record offset.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition value already set.",
+		 function );
 
-			goto on_error;
-		}
-		if( is_master_boot_record != 0 )
-		{
-			first_extended_boot_record_offset = extended_partition_record_offset;
-		}
-		if( libvsgpt_internal_volume_read_mbr_partition_entries(
-		     internal_volume,
-		     file_io_handle,
-		     extended_partition_record_offset,
-		     extended_partition_record,
-		     0,
-		     first_extended_boot_record_offset,
-		     recursion_depth + 1,
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          internal_volume->offset_index,
+	          volume_offset,
+	          &partition_index,
+	          partition_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition index for volume offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 volume_offset,
+		 volume_offset );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libvsgpt_partition_values_array_get_values_by_index(
+		     internal_volume->partitions,
+		     partition_index,
+		     &partition_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read partition entries.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition values: %d from array.",
+			 function,
+			 partition_index );
 
-			goto on_error;
+			result = -1;
 		}
-		if( libvsgpt_boot_record_free(
-		     &extended_partition_record,
-		     error ) != 1 )
+		else if( libvsgpt_partition_initialize(
+		          partition,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          internal_volume->buffer,
+		          internal_volume->buffer_size,
+		          partition_values,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free extended partition record.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition: %d.",
+			 function,
+			 partition_index );
 
-			goto on_error;
+			result = -1;
 		}
 	}
-	return( 1 );
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-on_error:
-	if( partition_values != NULL )
+		result = -1;
+	}
+#endif
+	if( result == -1 )
 	{
-		libvsgpt_partition_values_free(
-		 &partition_values,
-		 NULL );
+		goto on_error;
 	}
-	if( extended_partition_record != NULL )
+	return( result );
+
+on_error:
+	if( *partition != NULL )
 	{
-		libvsgpt_boot_record_free(
-		 &extended_partition_record,
+		libvsgpt_partition_free(
+		 partition,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the number of bytes per sector
+/* Retrieves the indexes of the partitions that contain specific volume offsets
+ * The lookups are done while holding the read lock once
+ * A partition index of -1 is set for a volume offset that is not contained in a partition
+ * The partition offsets are set to the offset relative to the start of the partition
  * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_get_bytes_per_sector(
+int libvsgpt_volume_get_partition_indexes_by_volume_offsets(
      libvsgpt_volume_t *volume,
-     uint32_t *bytes_per_sector,
+     const off64_t *volume_offsets,
+     int number_of_offsets,
+     int *partition_indexes,
+     off64_t *partition_offsets,
      libcerror_error_t **error )
 {
 	libvsgpt_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsgpt_volume_get_bytes_per_sector";
+	static char *function                       = "libvsgpt_volume_get_partition_indexes_by_volume_offsets";
+	int offset_index                            = 0;
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2107,24 +5604,46 @@ int libvsgpt_volume_get_bytes_per_sector(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-	if( internal_volume->io_handle == NULL )
+	if( volume_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( bytes_per_sector == NULL )
+	if( number_of_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 "%s: invalid partition indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition offsets.",
 		 function );
 
 		return( -1 );
@@ -2144,8 +5663,36 @@ int libvsgpt_volume_get_bytes_per_sector(
 		return( -1 );
 	}
 #endif
-	*bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
+	for( offset_index = 0;
+	     offset_index < number_of_offsets;
+	     offset_index++ )
+	{
+		result = libvsgpt_offset_index_get_partition_index_by_offset(
+		          internal_volume->offset_index,
+		          volume_offsets[ offset_index ],
+		          &( partition_indexes[ offset_index ] ),
+		          &( partition_offsets[ offset_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition index for volume offset: %d.",
+			 function,
+			 offset_index );
 
+			break;
+		}
+		else if( result == 0 )
+		{
+			partition_indexes[ offset_index ] = -1;
+			partition_offsets[ offset_index ] = 0;
+		}
+		result = 1;
+	}
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2161,22 +5708,265 @@ int libvsgpt_volume_get_bytes_per_sector(
 		return( -1 );
 	}
 #endif
+	return( result );
+}
+
+/* Creates the partitions for processing the partition data
+ * The partitions are read using a file IO handle that is passed to the read functions,
+ * such as the file IO handles of the partition chunks threads
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_internal_volume_create_partitions(
+     libvsgpt_internal_volume_t *internal_volume,
+     libvsgpt_partition_t ***partitions,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_t **safe_partitions        = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsgpt_internal_volume_create_partitions";
+	int partition_index                           = 0;
+	int safe_number_of_partitions                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_values_array_get_number_of_values(
+	     internal_volume->partitions,
+	     &safe_number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_number_of_partitions > 0 )
+	{
+		if( (size_t) safe_number_of_partitions > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvsgpt_partition_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of partitions value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		safe_partitions = (libvsgpt_partition_t **) memory_allocate(
+		                                             sizeof( libvsgpt_partition_t * ) * safe_number_of_partitions );
+
+		if( safe_partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_partitions,
+		     0,
+		     sizeof( libvsgpt_partition_t * ) * safe_number_of_partitions ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partitions.",
+			 function );
+
+			goto on_error;
+		}
+		for( partition_index = 0;
+		     partition_index < safe_number_of_partitions;
+		     partition_index++ )
+		{
+			if( libvsgpt_partition_values_array_get_values_by_index(
+			     internal_volume->partitions,
+			     partition_index,
+			     &partition_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition values: %d from array.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libvsgpt_partition_initialize(
+			     &( safe_partitions[ partition_index ] ),
+			     internal_volume->io_handle,
+			     NULL,
+			     internal_volume->buffer,
+			     internal_volume->buffer_size,
+			     partition_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	*partitions           = safe_partitions;
+	*number_of_partitions = safe_number_of_partitions;
+
 	return( 1 );
+
+on_error:
+	if( safe_partitions != NULL )
+	{
+		libvsgpt_internal_volume_free_partitions(
+		 &safe_partitions,
+		 safe_number_of_partitions,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the disk identifier
- * The identifier is a GUID stored in little-endian and is 16 bytes of size
+/* Frees the partitions created for processing the partition data
  * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_get_disk_identifier(
-     libvsgpt_volume_t *volume,
-     uint8_t *guid_data,
-     size_t guid_data_size,
+int libvsgpt_internal_volume_free_partitions(
+     libvsgpt_partition_t ***partitions,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsgpt_internal_volume_free_partitions";
+	int partition_index   = 0;
+	int result            = 1;
+
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			if( ( *partitions )[ partition_index ] == NULL )
+			{
+				continue;
+			}
+			if( libvsgpt_partition_free(
+			     &( ( *partitions )[ partition_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition: %d.",
+				 function,
+				 partition_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *partitions );
+
+		*partitions = NULL;
+	}
+	return( result );
+}
+
+/* Processes the data of all partitions in parallel
+ * The data of the partitions is passed to the callback in chunks, which are divided
+ * over the threads one chunk at a time, so that a large partition is processed by all threads
+ * The callback can be called concurrently from multiple threads and the chunks are not
+ * passed in a specific order. The callback should return 1 to continue or -1 on error
+ * Processing stops at the first chunk that fails
+ * Returns 1 if successful or -1 on error
+ */
+int libvsgpt_volume_for_each_partition_parallel(
+     libvsgpt_volume_t *volume,
+     int (*callback)(
+            int partition_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libvsgpt_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsgpt_volume_get_disk_identifier";
-	int result                                  = 1;
+	libvsgpt_internal_volume_t *internal_volume   = NULL;
+	libvsgpt_partition_chunks_t *partition_chunks = NULL;
+	libvsgpt_partition_t **partitions             = NULL;
+	static char *function                         = "libvsgpt_volume_for_each_partition_parallel";
+	int number_of_partitions                      = 0;
+	int result                                    = 1;
 
 	if( volume == NULL )
 	{
@@ -2191,17 +5981,30 @@ int libvsgpt_volume_get_disk_identifier(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-	if( internal_volume->partition_table_header == NULL )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing partition table header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
 		 function );
 
 		return( -1 );
 	}
+	/* The read lock is held while processing so that the volume cannot be closed
+	 */
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
@@ -2217,89 +6020,81 @@ int libvsgpt_volume_get_disk_identifier(
 		return( -1 );
 	}
 #endif
-	if( libvsgpt_partition_table_header_get_disk_identifier(
-	     internal_volume->partition_table_header,
-	     guid_data,
-	     guid_data_size,
+	/* The partitions are read using the file IO handles of
+	 * the partition chunks threads
+	 */
+	if( libvsgpt_internal_volume_create_partitions(
+	     internal_volume,
+	     &partitions,
+	     &number_of_partitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve disk identifier.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partitions.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libvsgpt_partition_chunks_initialize(
+	     &partition_chunks,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     partitions,
+	     number_of_partitions,
+	     LIBVSGPT_PARTITION_CHUNK_SIZE,
+	     callback,
+	     user_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition chunks.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the number of partitions
- * Returns 1 if successful or -1 on error
- */
-int libvsgpt_volume_get_number_of_partitions(
-     libvsgpt_volume_t *volume,
-     int *number_of_partitions,
-     libcerror_error_t **error )
-{
-	libvsgpt_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsgpt_volume_get_number_of_partitions";
-	int result                                  = 1;
-
-	if( volume == NULL )
+	if( libvsgpt_partition_chunks_process(
+	     partition_chunks,
+	     number_of_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process partitions.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	internal_volume = (libvsgpt_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libvsgpt_partition_chunks_free(
+	     &partition_chunks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition chunks.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_volume->partitions,
+	if( libvsgpt_internal_volume_free_partitions(
+	     &partitions,
 	     number_of_partitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of partitions from array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partitions.",
 		 function );
 
 		result = -1;
@@ -2320,21 +6115,68 @@ int libvsgpt_volume_get_number_of_partitions(
 	}
 #endif
 	return( result );
+
+on_error:
+	if( partition_chunks != NULL )
+	{
+		libvsgpt_partition_chunks_free(
+		 &partition_chunks,
+		 NULL );
+	}
+	if( partitions != NULL )
+	{
+		libvsgpt_internal_volume_free_partitions(
+		 &partitions,
+		 number_of_partitions,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves a specific partition
+/* Compares the partition data of the volume with that of another volume
+ * Partitions are matched by identifier, partitions without an identifier are matched
+ * by entry index. The data of matching partitions is compared in chunks, which are
+ * divided over the threads one chunk at a time
+ * The callback is called for every range of differing data, where the offset is relative
+ * to the start of the partition. Data that has no counterpart in the other volume is
+ * reported as differing, with a partition index of -1 for the volume that lacks it
+ * The callback is not called concurrently, but the ranges are not passed in a specific order
+ * and a range that spans multiple chunks is passed as adjacent ranges
+ * The callback should return 1 to continue or -1 on error
  * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_get_partition_by_index(
+int libvsgpt_volume_compare(
      libvsgpt_volume_t *volume,
-     int partition_index,
-     libvsgpt_partition_t **partition,
+     libvsgpt_volume_t *compare_volume,
+     int (*callback)(
+            int partition_index,
+            int compare_partition_index,
+            off64_t offset,
+            size64_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libvsgpt_internal_volume_t *internal_volume   = NULL;
-	libvsgpt_partition_values_t *partition_values = NULL;
-	static char *function                         = "libvsgpt_volume_get_partition_by_index";
-	int result                                    = 1;
+	libvsgpt_internal_volume_t *internal_compare_volume   = NULL;
+	libvsgpt_internal_volume_t *internal_volume           = NULL;
+	libvsgpt_partition_comparison_t *partition_comparison = NULL;
+	libvsgpt_partition_t **compare_partitions             = NULL;
+	libvsgpt_partition_t **partitions                     = NULL;
+	static char *function                                 = "libvsgpt_volume_compare";
+	int number_of_compare_partitions                      = 0;
+	int number_of_partitions                              = 0;
+	int result                                            = 1;
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	uint8_t compare_volume_is_locked                      = 0;
+#endif
 
 	if( volume == NULL )
 	{
@@ -2349,218 +6191,264 @@ int libvsgpt_volume_get_partition_by_index(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-	if( partition == NULL )
+	if( compare_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid partition.",
+		 "%s: invalid compare volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( *partition != NULL )
+	internal_compare_volume = (libvsgpt_internal_volume_t *) compare_volume;
+
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid partition value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( number_of_threads <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_volume->partitions,
-	     partition_index,
-	     (intptr_t **) &partition_values,
+	/* The read locks are held while comparing so that the volumes cannot be closed
+	 */
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve partition values: %d from array.",
-		 function,
-		 partition_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	else
+	if( internal_compare_volume != internal_volume )
 	{
-		if( libvsgpt_partition_initialize(
-		     partition,
-		     internal_volume->file_io_handle,
-		     partition_values,
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_compare_volume->read_write_lock,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create partition: %d.",
-			 function,
-			 partition_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab compare volume read/write lock for reading.",
+			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		compare_volume_is_locked = 1;
 	}
-#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+#endif
+	if( libvsgpt_internal_volume_create_partitions(
+	     internal_volume,
+	     &partitions,
+	     &number_of_partitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partitions.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#endif
-	if( result == -1 )
+	if( libvsgpt_internal_volume_create_partitions(
+	     internal_compare_volume,
+	     &compare_partitions,
+	     &number_of_compare_partitions,
+	     error ) != 1 )
 	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compare partitions.",
+		 function );
+
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( *partition != NULL )
+	if( libvsgpt_partition_comparison_initialize(
+	     &partition_comparison,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     partitions,
+	     number_of_partitions,
+	     internal_compare_volume->file_io_handle,
+	     compare_partitions,
+	     number_of_compare_partitions,
+	     LIBVSGPT_PARTITION_CHUNK_SIZE,
+	     LIBVSGPT_PARTITION_COMPARISON_BLOCK_SIZE,
+	     callback,
+	     user_data,
+	     error ) != 1 )
 	{
-		libvsgpt_partition_free(
-		 partition,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves the partition values with the corresponding (partition) entry index
- * This function is not multi-thread safe acquire read lock before call
- * Returns 1 if successful, 0 if not found or -1 on error
- */
-int libvsgpt_internal_volume_get_partition_values_by_identifier(
-     libvsgpt_internal_volume_t *internal_volume,
-     uint32_t entry_index,
-     libvsgpt_partition_values_t **partition_values,
-     libcerror_error_t **error )
-{
-	libvsgpt_partition_values_t *safe_partition_values = NULL;
-	static char *function                              = "libvsgpt_internal_volume_get_partition_values_by_identifier";
-	uint32_t safe_entry_index                          = 0;
-	int number_of_partitions                           = 0;
-	int partition_index                                = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition comparison.",
+		 function );
 
-	if( internal_volume == NULL )
+		goto on_error;
+	}
+	if( libvsgpt_partition_comparison_process(
+	     partition_comparison,
+	     number_of_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare partitions.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( partition_values == NULL )
+	if( libvsgpt_partition_comparison_free(
+	     &partition_comparison,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid partition values.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition comparison.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_volume->partitions,
-	     &number_of_partitions,
+	if( libvsgpt_internal_volume_free_partitions(
+	     &compare_partitions,
+	     number_of_compare_partitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of partitions from array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compare partitions.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	for( partition_index = 0;
-	     partition_index < number_of_partitions;
-	     partition_index++ )
+	if( libvsgpt_internal_volume_free_partitions(
+	     &partitions,
+	     number_of_partitions,
+	     error ) != 1 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_volume->partitions,
-		     partition_index,
-		     (intptr_t **) &safe_partition_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve partition values: %d from array.",
-			 function,
-			 partition_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partitions.",
+		 function );
 
-			return( -1 );
-		}
-		if( libvsgpt_partition_values_get_entry_index(
-		     safe_partition_values,
-		     &safe_entry_index,
+		result = -1;
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( compare_volume_is_locked != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_compare_volume->read_write_lock,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry index from partition values: %d.",
-			 function,
-			 partition_index );
-
-			return( -1 );
-		}
-		if( safe_entry_index == entry_index )
-		{
-			*partition_values = safe_partition_values;
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release compare volume read/write lock for reading.",
+			 function );
 
-			return( 1 );
+			result = -1;
 		}
 	}
-	return( 0 );
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( partition_comparison != NULL )
+	{
+		libvsgpt_partition_comparison_free(
+		 &partition_comparison,
+		 NULL );
+	}
+	if( compare_partitions != NULL )
+	{
+		libvsgpt_internal_volume_free_partitions(
+		 &compare_partitions,
+		 number_of_compare_partitions,
+		 NULL );
+	}
+	if( partitions != NULL )
+	{
+		libvsgpt_internal_volume_free_partitions(
+		 &partitions,
+		 number_of_partitions,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	if( compare_volume_is_locked != 0 )
+	{
+		libcthreads_read_write_lock_release_for_read(
+		 internal_compare_volume->read_write_lock,
+		 NULL );
+	}
+	libcthreads_read_write_lock_release_for_read(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Determines if the volume contains a partition with the corresponding (partition) entry index
- * Returns 1 if the volume contains such a partition, 0 if not or -1 on error
+/* Retrieves the size of the volume layout
+ * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_has_partition_with_identifier(
+int libvsgpt_volume_get_layout_size(
      libvsgpt_volume_t *volume,
-     uint32_t entry_index,
+     size_t *layout_size,
      libcerror_error_t **error )
 {
-	libvsgpt_internal_volume_t *internal_volume   = NULL;
-	libvsgpt_partition_values_t *partition_values = NULL;
-	static char *function                         = "libvsgpt_volume_has_partition_with_identifier";
-	int result                                    = 0;
+	libvsgpt_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsgpt_volume_get_layout_size";
+	int number_of_partitions                    = 0;
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2575,6 +6463,17 @@ int libvsgpt_volume_has_partition_with_identifier(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
+	if( layout_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout size.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
@@ -2590,23 +6489,37 @@ int libvsgpt_volume_has_partition_with_identifier(
 		return( -1 );
 	}
 #endif
-	result = libvsgpt_internal_volume_get_partition_values_by_identifier(
-	          internal_volume,
-	          entry_index,
-	          &partition_values,
-	          error );
+	if( internal_volume->partition_table_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing partition table header.",
+		 function );
 
-	if( result == -1 )
+		result = -1;
+	}
+	else if( libvsgpt_partition_values_array_get_number_of_values(
+	          internal_volume->partitions,
+	          &number_of_partitions,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve partition values.",
+		 "%s: unable to retrieve number of partitions.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		*layout_size = sizeof( vsgpt_volume_layout_header_t )
+		             + ( (size_t) number_of_partitions * sizeof( vsgpt_volume_layout_partition_t ) )
+		             + sizeof( vsgpt_volume_layout_footer_t );
+	}
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2625,19 +6538,29 @@ int libvsgpt_volume_has_partition_with_identifier(
 	return( result );
 }
 
-/* Retrieves the partition with the corresponding (partition) entry index
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Exports the volume layout
+ * The volume layout contains the parsed partition table header and partitions
+ * and can be used to open the same volume without reading the partition entries
+ * Returns 1 if successful or -1 on error
  */
-int libvsgpt_volume_get_partition_by_identifier(
+int libvsgpt_volume_export_layout(
      libvsgpt_volume_t *volume,
-     uint32_t entry_index,
-     libvsgpt_partition_t **partition,
+     uint8_t *layout_data,
+     size_t layout_data_size,
      libcerror_error_t **error )
 {
-	libvsgpt_internal_volume_t *internal_volume   = NULL;
-	libvsgpt_partition_values_t *partition_values = NULL;
-	static char *function                         = "libvsgpt_volume_get_partition_by_identifier";
-	int result                                    = 1;
+	vsgpt_volume_layout_header_t *layout_header      = NULL;
+	vsgpt_volume_layout_partition_t *layout_partition = NULL;
+	libvsgpt_internal_volume_t *internal_volume       = NULL;
+	libvsgpt_partition_values_t *partition_values     = NULL;
+	libvsgpt_partition_table_header_t *table_header   = NULL;
+	static char *function                             = "libvsgpt_volume_export_layout";
+	size_t data_offset                                = 0;
+	size_t required_data_size                         = 0;
+	uint32_t checksum                                 = 0;
+	uint32_t flags                                    = 0;
+	int number_of_partitions                          = 0;
+	int partition_index                               = 0;
 
 	if( volume == NULL )
 	{
@@ -2652,24 +6575,35 @@ int libvsgpt_volume_get_partition_by_identifier(
 	}
 	internal_volume = (libvsgpt_internal_volume_t *) volume;
 
-	if( partition == NULL )
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid partition.",
+		 "%s: invalid layout data.",
 		 function );
 
 		return( -1 );
 	}
-	if( *partition != NULL )
+	if( layout_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid partition value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid layout data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -2689,41 +6623,248 @@ int libvsgpt_volume_get_partition_by_identifier(
 		return( -1 );
 	}
 #endif
-	result = libvsgpt_internal_volume_get_partition_values_by_identifier(
-	          internal_volume,
-	          entry_index,
-	          &partition_values,
-	          error );
+	table_header = internal_volume->partition_table_header;
 
-	if( result == -1 )
+	if( table_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing partition table header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_values_array_get_number_of_values(
+	     internal_volume->partitions,
+	     &number_of_partitions,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve partition values.",
+		 "%s: unable to retrieve number of partitions.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else if( result != 0 )
+	required_data_size = sizeof( vsgpt_volume_layout_header_t )
+	                   + ( (size_t) number_of_partitions * sizeof( vsgpt_volume_layout_partition_t ) )
+	                   + sizeof( vsgpt_volume_layout_footer_t );
+
+	if( layout_data_size < required_data_size )
 	{
-		if( libvsgpt_partition_initialize(
-		     partition,
-		     internal_volume->file_io_handle,
-		     partition_values,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid layout data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     layout_data,
+	     0,
+	     required_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear layout data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume->is_corrupt != 0 )
+	{
+		flags |= LIBVSGPT_VOLUME_LAYOUT_FLAG_IS_CORRUPT;
+	}
+	if( table_header->is_corrupt != 0 )
+	{
+		flags |= LIBVSGPT_VOLUME_LAYOUT_FLAG_HEADER_IS_CORRUPT;
+	}
+	layout_header = (vsgpt_volume_layout_header_t *) layout_data;
+
+	if( memory_copy(
+	     layout_header->signature,
+	     "vsgptlay",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->format_version,
+	 LIBVSGPT_VOLUME_LAYOUT_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->header_data_size,
+	 (uint32_t) sizeof( vsgpt_volume_layout_header_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->bytes_per_sector,
+	 (uint32_t) internal_volume->io_handle->bytes_per_sector );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->flags,
+	 flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->volume_size,
+	 internal_volume->size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->fingerprint,
+	 internal_volume->fingerprint );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->number_of_partitions,
+	 (uint32_t) number_of_partitions );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->header_block_number,
+	 table_header->partition_header_block_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->backup_header_block_number,
+	 table_header->backup_partition_header_block_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->area_start_block_number,
+	 table_header->partition_area_start_block_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->area_end_block_number,
+	 table_header->partition_area_end_block_number );
+
+	if( memory_copy(
+	     layout_header->disk_identifier,
+	     table_header->disk_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy disk identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 layout_header->entries_start_block_number,
+	 table_header->partition_entries_start_block_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->number_of_entries,
+	 table_header->number_of_partition_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->entry_data_size,
+	 table_header->partition_entry_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 layout_header->entries_data_checksum,
+	 table_header->partition_entries_data_checksum );
+
+	data_offset = sizeof( vsgpt_volume_layout_header_t );
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsgpt_partition_values_array_get_values_by_index(
+		     internal_volume->partitions,
+		     partition_index,
+		     &partition_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create partition.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d values.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		layout_partition = (vsgpt_volume_layout_partition_t *) &( layout_data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 layout_partition->entry_index,
+		 partition_values->entry_index );
+
+		layout_partition->type = partition_values->type;
+
+		if( memory_copy(
+		     layout_partition->type_identifier,
+		     partition_values->type_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy type identifier.",
 			 function );
 
-			result = -1;
+			goto on_error;
+		}
+		if( memory_copy(
+		     layout_partition->identifier,
+		     partition_values->identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier.",
+			 function );
+
+			goto on_error;
 		}
+		byte_stream_copy_from_uint64_little_endian(
+		 layout_partition->offset,
+		 (uint64_t) partition_values->offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 layout_partition->size,
+		 (uint64_t) partition_values->size );
+
+		data_offset += sizeof( vsgpt_volume_layout_partition_t );
+	}
+	if( libvsgpt_checksum_calculate_crc32(
+	     &checksum,
+	     layout_data,
+	     data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
 	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( layout_data[ data_offset ] ),
+	 checksum );
+
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2736,22 +6877,17 @@ int libvsgpt_volume_get_partition_by_identifier(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
 #endif
-	if( result == -1 )
-	{
-		goto on_error;
-	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( *partition != NULL )
-	{
-		libvsgpt_partition_free(
-		 partition,
-		 NULL );
-	}
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
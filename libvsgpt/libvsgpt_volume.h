@@ -28,12 +28,15 @@
 #include "libvsgpt_boot_record.h"
 #include "libvsgpt_extern.h"
 #include "libvsgpt_io_handle.h"
+#include "libvsgpt_io_trace.h"
 #include "libvsgpt_libbfio.h"
-#include "libvsgpt_libcdata.h"
 #include "libvsgpt_libcerror.h"
 #include "libvsgpt_libcthreads.h"
+#include "libvsgpt_metadata_cache.h"
+#include "libvsgpt_offset_index.h"
 #include "libvsgpt_partition_table_header.h"
 #include "libvsgpt_partition_values.h"
+#include "libvsgpt_partition_values_array.h"
 #include "libvsgpt_types.h"
 
 #if defined( __cplusplus )
@@ -54,12 +57,24 @@ struct libvsgpt_internal_volume
 
 	/* The partitions array
 	 */
-	libcdata_array_t *partitions;
+	libvsgpt_partition_values_array_t *partitions;
+
+	/* The partitions offset index
+	 */
+	libvsgpt_offset_index_t *offset_index;
 
 	/* The IO handle
 	 */
 	libvsgpt_io_handle_t *io_handle;
 
+	/* The IO trace
+	 */
+	libvsgpt_io_trace_t *io_trace;
+
+	/* The deadline of the current open operation in microseconds, where 0 represents no deadline
+	 */
+	int64_t deadline;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -72,10 +87,27 @@ struct libvsgpt_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The buffer, when the volume was opened from a buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The fingerprint
+	 */
+	uint32_t fingerprint;
+
 	/* Value to indicate the volume is corrupt
 	 */
 	uint8_t is_corrupt;
 
+	/* Value to indicate the partition table should be read from the backup
+	 * when the partition table header is corrupt
+	 */
+	uint8_t recovery_mode;
+
 #if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -98,6 +130,31 @@ int libvsgpt_volume_signal_abort(
      libvsgpt_volume_t *volume,
      libcerror_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_set_trace_callback(
+     libvsgpt_volume_t *volume,
+     void (*trace_callback)(
+            int event_type,
+            int phase,
+            off64_t offset,
+            size64_t size,
+            uint64_t duration,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_set_timeout(
+     libvsgpt_volume_t *volume,
+     uint32_t timeout,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_set_recovery_mode(
+     libvsgpt_volume_t *volume,
+     uint8_t recovery_mode,
+     libcerror_error_t **error );
+
 LIBVSGPT_EXTERN \
 int libvsgpt_volume_open(
      libvsgpt_volume_t *volume,
@@ -123,6 +180,23 @@ int libvsgpt_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_open_buffer(
+     libvsgpt_volume_t *volume,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_open_with_layout(
+     libvsgpt_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *layout_data,
+     size_t layout_data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBVSGPT_EXTERN \
 int libvsgpt_volume_close(
      libvsgpt_volume_t *volume,
@@ -133,7 +207,40 @@ int libvsgpt_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libvsgpt_internal_volume_calculate_fingerprint(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint32_t *fingerprint,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_open_read_with_layout(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *layout_data,
+     size_t layout_data_size,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_read_partition_table_header(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_partition_table_header_t *partition_table_header,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libvsgpt_internal_volume_read_partition_table_headers(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_recover_partition_table(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_read_backup_partition_table(
      libvsgpt_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
@@ -144,14 +251,31 @@ int libvsgpt_internal_volume_read_partition_entries(
      off64_t file_offset,
      libcerror_error_t **error );
 
-int libvsgpt_internal_volume_read_mbr_partition_entries(
+int libvsgpt_internal_volume_read_partition_entries_data(
+     libvsgpt_internal_volume_t *internal_volume,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *partition_entry_index,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_read_extended_partition_record(
      libvsgpt_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_boot_record_t *extended_partition_record,
      off64_t file_offset,
-     libvsgpt_boot_record_t *boot_record,
-     uint8_t is_master_boot_record,
-     off64_t first_extended_boot_record_offset,
-     int recursion_depth,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_read_mbr_partition_entries(
+     libvsgpt_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libvsgpt_metadata_cache_t *metadata_cache,
+     libvsgpt_boot_record_t *master_boot_record,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_is_corrupted(
+     libvsgpt_volume_t *volume,
      libcerror_error_t **error );
 
 LIBVSGPT_EXTERN \
@@ -199,6 +323,84 @@ int libvsgpt_volume_get_partition_by_identifier(
      libvsgpt_partition_t **partition,
      libcerror_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_get_partition_index_by_volume_offset(
+     libvsgpt_volume_t *volume,
+     off64_t volume_offset,
+     int *partition_index,
+     off64_t *partition_offset,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_get_partition_by_volume_offset(
+     libvsgpt_volume_t *volume,
+     off64_t volume_offset,
+     libvsgpt_partition_t **partition,
+     off64_t *partition_offset,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_get_partition_indexes_by_volume_offsets(
+     libvsgpt_volume_t *volume,
+     const off64_t *volume_offsets,
+     int number_of_offsets,
+     int *partition_indexes,
+     off64_t *partition_offsets,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_create_partitions(
+     libvsgpt_internal_volume_t *internal_volume,
+     libvsgpt_partition_t ***partitions,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+int libvsgpt_internal_volume_free_partitions(
+     libvsgpt_partition_t ***partitions,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_for_each_partition_parallel(
+     libvsgpt_volume_t *volume,
+     int (*callback)(
+            int partition_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_compare(
+     libvsgpt_volume_t *volume,
+     libvsgpt_volume_t *compare_volume,
+     int (*callback)(
+            int partition_index,
+            int compare_partition_index,
+            off64_t offset,
+            size64_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_get_layout_size(
+     libvsgpt_volume_t *volume,
+     size_t *layout_size,
+     libcerror_error_t **error );
+
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_export_layout(
+     libvsgpt_volume_t *volume,
+     uint8_t *layout_data,
+     size_t layout_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
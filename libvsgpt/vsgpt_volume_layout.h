@@ -0,0 +1,183 @@
+/*
+ * Volume layout definitions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSGPT_VOLUME_LAYOUT_H )
+#define _VSGPT_VOLUME_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsgpt_volume_layout_header vsgpt_volume_layout_header_t;
+
+struct vsgpt_volume_layout_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * Contains "vsgptlay"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Header data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_data_size[ 4 ];
+
+	/* Bytes per sector
+	 * Consists of 4 bytes
+	 */
+	uint8_t bytes_per_sector[ 4 ];
+
+	/* Flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* Volume size
+	 * Consists of 8 bytes
+	 */
+	uint8_t volume_size[ 8 ];
+
+	/* Fingerprint
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the partition table header sector
+	 */
+	uint8_t fingerprint[ 4 ];
+
+	/* Number of partitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_partitions[ 4 ];
+
+	/* Partition header block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t header_block_number[ 8 ];
+
+	/* Backup partition header block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t backup_header_block_number[ 8 ];
+
+	/* Partition area start block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t area_start_block_number[ 8 ];
+
+	/* Partition area end block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t area_end_block_number[ 8 ];
+
+	/* Disk identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t disk_identifier[ 16 ];
+
+	/* Partition entries start block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t entries_start_block_number[ 8 ];
+
+	/* Number of partition entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* Partition entry data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry_data_size[ 4 ];
+
+	/* Partition entries data checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t entries_data_checksum[ 4 ];
+};
+
+typedef struct vsgpt_volume_layout_partition vsgpt_volume_layout_partition_t;
+
+struct vsgpt_volume_layout_partition
+{
+	/* Entry index
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry_index[ 4 ];
+
+	/* Type
+	 * Consists of 1 byte
+	 */
+	uint8_t type;
+
+	/* Padding
+	 * Consists of 3 bytes
+	 */
+	uint8_t padding1[ 3 ];
+
+	/* Type identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t type_identifier[ 16 ];
+
+	/* Identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* Offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offset[ 8 ];
+
+	/* Size
+	 * Consists of 8 bytes
+	 */
+	uint8_t size[ 8 ];
+};
+
+typedef struct vsgpt_volume_layout_footer vsgpt_volume_layout_footer_t;
+
+struct vsgpt_volume_layout_footer
+{
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the header and partitions data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSGPT_VOLUME_LAYOUT_H ) */
+
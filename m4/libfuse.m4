@@ -0,0 +1,182 @@
+dnl Checks for libfuse required headers and functions
+dnl
+dnl Version: 20261018
+
+dnl Function to detect if libfuse is available
+dnl ac_libfuse_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBFUSE_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_libfuse" = xno],
+    [ac_cv_libfuse=no],
+    [ac_cv_libfuse=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-libfuse which returns "yes" and --with-libfuse= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_libfuse" != x && test "x$ac_cv_with_libfuse" != xauto-detect && test "x$ac_cv_with_libfuse" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([libfuse])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [fuse3],
+          [fuse3 >= 3.0],
+          [ac_cv_libfuse=libfuse3],
+          [ac_cv_libfuse=check])
+
+        AS_IF(
+          [test "x$ac_cv_libfuse" = xlibfuse3],
+          [ac_cv_libfuse_CPPFLAGS="$pkg_cv_fuse3_CFLAGS"
+          ac_cv_libfuse_LIBADD="$pkg_cv_fuse3_LIBS"],
+          [PKG_CHECK_MODULES(
+            [fuse],
+            [fuse >= 2.6],
+            [ac_cv_libfuse=libfuse],
+            [ac_cv_libfuse=check])
+
+          AS_IF(
+            [test "x$ac_cv_libfuse" = xlibfuse],
+            [ac_cv_libfuse_CPPFLAGS="$pkg_cv_fuse_CFLAGS"
+            ac_cv_libfuse_LIBADD="$pkg_cv_fuse_LIBS"])
+          ])
+        ])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_libfuse" = xcheck],
+      [dnl Check for headers
+      dnl The FUSE API version must be defined before including fuse.h
+      AC_LANG_PUSH(C)
+      AC_COMPILE_IFELSE(
+        [AC_LANG_PROGRAM(
+          [[#define FUSE_USE_VERSION 26
+#include <fuse.h>]],
+          [[]] )],
+        [ac_cv_header_fuse_h=yes],
+        [ac_cv_header_fuse_h=no])
+      AC_LANG_POP(C)
+
+      AS_IF(
+        [test "x$ac_cv_header_fuse_h" = xno],
+        [ac_cv_libfuse=no],
+        [ac_cv_libfuse=libfuse
+
+        AC_CHECK_LIB(
+          fuse,
+          fuse_daemonize,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_destroy,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_loop_mt,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_mount,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_new,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_unmount,
+          [ac_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+
+        AS_IF(
+          [test "x$ac_cv_libfuse" = xlibfuse],
+          [ac_cv_libfuse_LIBADD="-lfuse"])
+        ])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_with_libfuse" != xno && test "x$ac_cv_libfuse" = xno],
+      [AS_IF(
+        [test "x$ac_cv_with_libfuse" != x && test "x$ac_cv_with_libfuse" != xauto-detect],
+        [AC_MSG_FAILURE(
+          [unable to find supported libfuse in directory: $ac_cv_with_libfuse],
+          [1])
+        ])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse3],
+    [AC_DEFINE(
+      [HAVE_LIBFUSE3],
+      [1],
+      [Define to 1 if you have the 'fuse3' library (-lfuse3).])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse],
+    [AC_DEFINE(
+      [HAVE_LIBFUSE],
+      [1],
+      [Define to 1 if you have the 'fuse' library (-lfuse).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" != xno],
+    [AC_SUBST(
+      [HAVE_LIBFUSE],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBFUSE],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable libfuse
+AC_DEFUN([AX_LIBFUSE_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [libfuse],
+    [libfuse],
+    [search for libfuse in includedir and libdir or in the specified DIR, or no if not to use libfuse],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBFUSE_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_libfuse_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBFUSE_CPPFLAGS],
+      [$ac_cv_libfuse_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBFUSE_LIBADD],
+      [$ac_cv_libfuse_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse3],
+    [AC_SUBST(
+      [ax_libfuse_spec_requires],
+      [fuse3-libs])
+    AC_SUBST(
+      [ax_libfuse_spec_build_requires],
+      [fuse3-devel])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse],
+    [AC_SUBST(
+      [ax_libfuse_spec_requires],
+      [fuse-libs])
+    AC_SUBST(
+      [ax_libfuse_spec_build_requires],
+      [fuse-devel])
+    ])
+  ])
+
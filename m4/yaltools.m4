@@ -73,9 +73,9 @@ AC_DEFUN([AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE],
 
 dnl Function to detect if vsgpttools dependencies are available
 AC_DEFUN([AX_VSGPTTOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([dirent.h signal.h sys/resource.h sys/signal.h sys/stat.h unistd.h])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  AC_CHECK_FUNCS([clock_gettime close getopt getrusage setvbuf])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
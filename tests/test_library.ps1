@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "boot_record checksum chs_address error io_handle mbr_partition_entry mbr_partition_type notify partition partition_entry partition_table_header partition_type_identifier partition_values section_values sector_data"
+$LibraryTests = "boot_record checksum chs_address error header_scan io_handle io_trace mbr_partition_entry mbr_partition_type metadata_cache notify offset_index partition partition_comparison partition_cursor partition_entry partition_table_header partition_type_identifier partition_values partition_values_array section_values sector_cache sector_data"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "" -split " "
 
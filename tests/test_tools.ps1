@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "benchmark_handle carve_handle checksum diff_handle export_handle info_handle mount_file_entry mount_file_system mount_handle output scan_handle signal verify_handle"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
@@ -340,6 +340,92 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvsgpt_boot_record_check_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_boot_record_check_signature(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_boot_record_check_signature(
+	          vsgpt_test_boot_record_data1,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_boot_record_check_signature(
+	          vsgpt_test_boot_record_error_data1,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_boot_record_check_signature(
+	          NULL,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_boot_record_check_signature(
+	          vsgpt_test_boot_record_data1,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libvsgpt_boot_record_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -1058,6 +1144,10 @@ int main(
 	 "libvsgpt_boot_record_free",
 	 vsgpt_test_boot_record_free );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_boot_record_check_signature",
+	 vsgpt_test_boot_record_check_signature );
+
 	VSGPT_TEST_RUN(
 	 "libvsgpt_boot_record_read_data",
 	 vsgpt_test_boot_record_read_data );
@@ -107,6 +107,32 @@ int vsgpt_test_error_backtrace_sprint(
 	return( 1 );
 }
 
+/* Tests the libvsgpt_error_matches function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_error_matches(
+     void )
+{
+	int result = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_error_matches(
+	          NULL,
+	          LIBVSGPT_ERROR_DOMAIN_RUNTIME,
+	          LIBVSGPT_RUNTIME_ERROR_TIMED_OUT );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -142,6 +168,10 @@ int main(
 	 "libvsgpt_error_backtrace_sprint",
 	 vsgpt_test_error_backtrace_sprint );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_error_matches",
+	 vsgpt_test_error_matches );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,822 @@
+/*
+ * Library header scan functions test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_functions.h"
+#include "vsgpt_test_libbfio.h"
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_header_scan.h"
+
+uint8_t vsgpt_test_header_scan_data1[ 512 ] = {
+	0x45, 0x46, 0x49, 0x20, 0x50, 0x41, 0x52, 0x54, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00,
+	0x9c, 0xe7, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xde, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3e, 0xcf, 0x2d, 0x74, 0x22, 0x7a, 0x46,
+	0xbd, 0x48, 0xb6, 0xf3, 0x87, 0x6f, 0xde, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x4b, 0x1a, 0x63, 0x1a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Callback function that counts the partition table headers found by the scan
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_header_scan_count_callback(
+     off64_t offset VSGPT_TEST_ATTRIBUTE_UNUSED,
+     uint64_t header_block_number VSGPT_TEST_ATTRIBUTE_UNUSED,
+     uint32_t sector_size VSGPT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *disk_identifier VSGPT_TEST_ATTRIBUTE_UNUSED,
+     void *user_data,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( offset )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( header_block_number )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( sector_size )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( disk_identifier )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) user_data ) += 1;
+
+	return( 1 );
+}
+
+/* Callback function that stops the scan at the first partition table header
+ * Returns 0 to stop the scan or -1 on error
+ */
+int vsgpt_test_header_scan_stop_callback(
+     off64_t offset VSGPT_TEST_ATTRIBUTE_UNUSED,
+     uint64_t header_block_number VSGPT_TEST_ATTRIBUTE_UNUSED,
+     uint32_t sector_size VSGPT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *disk_identifier VSGPT_TEST_ATTRIBUTE_UNUSED,
+     void *user_data,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( offset )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( header_block_number )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( sector_size )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( disk_identifier )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) user_data ) += 1;
+
+	return( 0 );
+}
+
+/* Tests the libvsgpt_header_scan_search_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_header_scan_search_signature(
+     void )
+{
+	uint8_t test_data[ 16 ] = {
+		'E', 'F', 'I', ' ', 'E', 'E', 'F', 'I', ' ', 'P', 'A', 'R', 'T', 0, 0, 0 };
+
+	size_t signature_offset = 0;
+	int result              = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_header_scan_search_signature(
+	          test_data,
+	          16,
+	          &signature_offset );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 5 );
+
+	/* Test a signature that is not completely within the data
+	 */
+	result = libvsgpt_header_scan_search_signature(
+	          test_data,
+	          12,
+	          &signature_offset );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_header_scan_search_signature(
+	          NULL,
+	          16,
+	          &signature_offset );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsgpt_header_scan_search_signature(
+	          test_data,
+	          7,
+	          &signature_offset );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsgpt_header_scan_search_signature(
+	          test_data,
+	          16,
+	          NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libvsgpt_header_scan_validate_header function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_header_scan_validate_header(
+     void )
+{
+	uint8_t disk_identifier[ 16 ];
+	uint8_t test_data[ 512 ];
+
+	libcerror_error_t *error     = NULL;
+	uint64_t header_block_number = 0;
+	void *memcpy_result          = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          512,
+	          &header_block_number,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "header_block_number",
+	 header_block_number,
+	 (uint64_t) 1 );
+
+	result = memory_compare(
+	          disk_identifier,
+	          &( vsgpt_test_header_scan_data1[ 56 ] ),
+	          16 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that does not contain all the header data
+	 */
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          91,
+	          &header_block_number,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data with a checksum mismatch
+	 */
+	memcpy_result = memory_copy(
+	                 test_data,
+	                 vsgpt_test_header_scan_data1,
+	                 512 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	test_data[ 32 ] ^= 0x01;
+
+	result = libvsgpt_header_scan_validate_header(
+	          test_data,
+	          512,
+	          &header_block_number,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_header_scan_validate_header(
+	          NULL,
+	          512,
+	          &header_block_number,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &header_block_number,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          512,
+	          NULL,
+	          disk_identifier,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          512,
+	          &header_block_number,
+	          NULL,
+	          16,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_header_scan_validate_header(
+	          vsgpt_test_header_scan_data1,
+	          512,
+	          &header_block_number,
+	          disk_identifier,
+	          8,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_header_scan_get_sector_size function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_header_scan_get_sector_size(
+     void )
+{
+	uint32_t sector_size = 0;
+	int result           = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_header_scan_get_sector_size(
+	          512,
+	          1,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "sector_size",
+	 sector_size,
+	 (uint32_t) 512 );
+
+	result = libvsgpt_header_scan_get_sector_size(
+	          4096,
+	          1,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "sector_size",
+	 sector_size,
+	 (uint32_t) 4096 );
+
+	result = libvsgpt_header_scan_get_sector_size(
+	          (off64_t) 8191 * 512,
+	          8191,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "sector_size",
+	 sector_size,
+	 (uint32_t) 512 );
+
+	/* Test an offset that does not match a supported sector size
+	 */
+	result = libvsgpt_header_scan_get_sector_size(
+	          777777,
+	          1,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_header_scan_get_sector_size(
+	          0,
+	          1,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsgpt_header_scan_get_sector_size(
+	          512,
+	          0,
+	          &sector_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsgpt_header_scan_get_sector_size(
+	          512,
+	          1,
+	          NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libvsgpt_scan_for_headers_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_scan_for_headers_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *test_data               = NULL;
+	void *memcpy_result              = NULL;
+	void *memset_result              = NULL;
+	int number_of_headers            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	test_data = (uint8_t *) memory_allocate(
+	                         65536 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	memset_result = memory_set(
+	                 test_data,
+	                 0,
+	                 65536 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* A primary partition table header and a stray copy at an offset
+	 * that does not match a supported sector size
+	 */
+	memcpy_result = memory_copy(
+	                 &( test_data[ 512 ] ),
+	                 vsgpt_test_header_scan_data1,
+	                 512 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	memcpy_result = memory_copy(
+	                 &( test_data[ 40001 ] ),
+	                 vsgpt_test_header_scan_data1,
+	                 512 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          65536,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	number_of_headers = 0;
+
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          file_io_handle,
+	          0,
+	          0,
+	          &vsgpt_test_header_scan_count_callback,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_headers",
+	 number_of_headers,
+	 2 );
+
+	/* Test a range that only contains the start of the second header
+	 */
+	number_of_headers = 0;
+
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          file_io_handle,
+	          1024,
+	          40001 - 1024 + 1,
+	          &vsgpt_test_header_scan_count_callback,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_headers",
+	 number_of_headers,
+	 1 );
+
+	/* Test a callback that stops the scan
+	 */
+	number_of_headers = 0;
+
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          file_io_handle,
+	          0,
+	          0,
+	          &vsgpt_test_header_scan_stop_callback,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_headers",
+	 number_of_headers,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          NULL,
+	          0,
+	          0,
+	          &vsgpt_test_header_scan_count_callback,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          file_io_handle,
+	          -1,
+	          0,
+	          &vsgpt_test_header_scan_count_callback,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_scan_for_headers_file_io_handle(
+	          file_io_handle,
+	          0,
+	          0,
+	          NULL,
+	          &number_of_headers,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 test_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_header_scan_search_signature",
+	 vsgpt_test_header_scan_search_signature );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_header_scan_validate_header",
+	 vsgpt_test_header_scan_validate_header );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_header_scan_get_sector_size",
+	 vsgpt_test_header_scan_get_sector_size );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_scan_for_headers_file_io_handle",
+	 vsgpt_test_scan_for_headers_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
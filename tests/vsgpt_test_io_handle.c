@@ -398,6 +398,264 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvsgpt_io_handle_get_deadline function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_handle_get_deadline(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_io_handle_t *io_handle = NULL;
+	int64_t deadline                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	deadline = libvsgpt_io_handle_get_deadline(
+	            io_handle );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "deadline",
+	 deadline,
+	 (int64_t) 0 );
+
+	io_handle->timeout = 1000000;
+
+	deadline = libvsgpt_io_handle_get_deadline(
+	            io_handle );
+
+	VSGPT_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "deadline",
+	 deadline,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	deadline = libvsgpt_io_handle_get_deadline(
+	            NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "deadline",
+	 deadline,
+	 (int64_t) 0 );
+
+	/* Clean up
+	 */
+	result = libvsgpt_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libvsgpt_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_io_handle_check_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_handle_check_abort(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_io_handle_check_abort(
+	          io_handle,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_io_handle_check_abort(
+	          NULL,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_io_handle_check_abort with a deadline that has passed
+	 */
+	result = libvsgpt_io_handle_check_abort(
+	          io_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBVSGPT_IO_HANDLE_RUNTIME_ERROR_TIMED_OUT );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_io_handle_check_abort with abort signalled
+	 */
+	io_handle->abort = 1;
+
+	result = libvsgpt_io_handle_check_abort(
+	          io_handle,
+	          0,
+	          &error );
+
+	io_handle->abort = 0;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libvsgpt_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +687,14 @@ int main(
 	 "libvsgpt_io_handle_clear",
 	 vsgpt_test_io_handle_clear );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_handle_get_deadline",
+	 vsgpt_test_io_handle_get_deadline );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_handle_check_abort",
+	 vsgpt_test_io_handle_check_abort );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,941 @@
+/*
+ * Library io_trace type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_functions.h"
+#include "vsgpt_test_libbfio.h"
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_io_trace.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Tests the libvsgpt_io_trace_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_trace_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_io_trace_t *io_trace   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_io_trace_initialize(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_free(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_io_trace_initialize(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_trace = (libvsgpt_io_trace_t *) 0x12345678UL;
+
+	result = libvsgpt_io_trace_initialize(
+	          &io_trace,
+	          &error );
+
+	io_trace = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_io_trace_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_io_trace_initialize(
+		          &io_trace,
+			          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( io_trace != NULL )
+			{
+				libvsgpt_io_trace_free(
+				 &io_trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "io_trace",
+			 io_trace );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_io_trace_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_io_trace_initialize(
+		          &io_trace,
+			          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( io_trace != NULL )
+			{
+				libvsgpt_io_trace_free(
+				 &io_trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "io_trace",
+			 io_trace );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_trace != NULL )
+	{
+		libvsgpt_io_trace_free(
+		 &io_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_io_trace_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_trace_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_io_trace_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Test trace callback values
+ */
+int vsgpt_test_io_trace_number_of_read_events  = 0;
+int vsgpt_test_io_trace_number_of_phase_events = 0;
+int vsgpt_test_io_trace_last_phase             = 0;
+off64_t vsgpt_test_io_trace_last_offset        = 0;
+size64_t vsgpt_test_io_trace_last_size         = 0;
+
+/* Test trace callback function
+ */
+void vsgpt_test_io_trace_callback(
+      int event_type,
+      int phase,
+      off64_t offset,
+      size64_t size,
+      uint64_t duration VSGPT_TEST_ATTRIBUTE_UNUSED,
+      void *user_data VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( duration )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	if( event_type == LIBVSGPT_TRACE_EVENT_TYPE_READ )
+	{
+		vsgpt_test_io_trace_number_of_read_events++;
+	}
+	else if( event_type == LIBVSGPT_TRACE_EVENT_TYPE_PHASE )
+	{
+		vsgpt_test_io_trace_number_of_phase_events++;
+	}
+	vsgpt_test_io_trace_last_phase  = phase;
+	vsgpt_test_io_trace_last_offset = offset;
+	vsgpt_test_io_trace_last_size   = size;
+}
+
+/* Tests the libvsgpt_io_trace_set_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_trace_set_callback(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libvsgpt_io_trace_t *io_trace = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_io_trace_initialize(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_io_trace_set_callback(
+	          io_trace,
+	          &vsgpt_test_io_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_io_trace_set_callback(
+	          NULL,
+	          &vsgpt_test_io_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_io_trace_free(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_trace != NULL )
+	{
+		libvsgpt_io_trace_free(
+		 &io_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_io_trace_start_phase and libvsgpt_io_trace_end_phase functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_trace_start_and_end_phase(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libvsgpt_io_trace_t *io_trace = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	vsgpt_test_io_trace_number_of_phase_events = 0;
+
+	result = libvsgpt_io_trace_initialize(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without a trace callback
+	 */
+	result = libvsgpt_io_trace_start_phase(
+	          io_trace,
+	          LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_end_phase(
+	          io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_number_of_phase_events",
+	 vsgpt_test_io_trace_number_of_phase_events,
+	 0 );
+
+	/* Test regular cases with a trace callback
+	 */
+	result = libvsgpt_io_trace_set_callback(
+	          io_trace,
+	          &vsgpt_test_io_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_start_phase(
+	          io_trace,
+	          LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_end_phase(
+	          io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_number_of_phase_events",
+	 vsgpt_test_io_trace_number_of_phase_events,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_last_phase",
+	 vsgpt_test_io_trace_last_phase,
+	 LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "vsgpt_test_io_trace_last_size",
+	 vsgpt_test_io_trace_last_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_io_trace_start_phase(
+	          NULL,
+	          LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_io_trace_end_phase(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_io_trace_free(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_trace != NULL )
+	{
+		libvsgpt_io_trace_free(
+		 &io_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_io_trace_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_io_trace_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t test_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsgpt_io_trace_t *io_trace    = NULL;
+	size_t test_data_offset          = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	vsgpt_test_io_trace_number_of_read_events  = 0;
+	vsgpt_test_io_trace_number_of_phase_events = 0;
+
+	for( test_data_offset = 0;
+	     test_data_offset < 2048;
+	     test_data_offset++ )
+	{
+		test_data[ test_data_offset ] = (uint8_t) ( test_data_offset % 251 );
+	}
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          2048,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_initialize(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without an IO trace
+	 */
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( test_data[ 512 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases without a trace callback
+	 */
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              io_trace,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_number_of_read_events",
+	 vsgpt_test_io_trace_number_of_read_events,
+	 0 );
+
+	/* Test regular cases with a trace callback
+	 */
+	result = libvsgpt_io_trace_set_callback(
+	          io_trace,
+	          &vsgpt_test_io_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_trace_start_phase(
+	          io_trace,
+	          LIBVSGPT_OPEN_PHASE_BOOT_RECORDS,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              io_trace,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_number_of_read_events",
+	 vsgpt_test_io_trace_number_of_read_events,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_last_phase",
+	 vsgpt_test_io_trace_last_phase,
+	 LIBVSGPT_OPEN_PHASE_BOOT_RECORDS );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "vsgpt_test_io_trace_last_offset",
+	 (int64_t) vsgpt_test_io_trace_last_offset,
+	 (int64_t) 1024 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "vsgpt_test_io_trace_last_size",
+	 vsgpt_test_io_trace_last_size,
+	 (uint64_t) 512 );
+
+	result = libvsgpt_io_trace_end_phase(
+	          io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "vsgpt_test_io_trace_number_of_phase_events",
+	 vsgpt_test_io_trace_number_of_phase_events,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "vsgpt_test_io_trace_last_size",
+	 vsgpt_test_io_trace_last_size,
+	 (uint64_t) 512 );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_io_trace_read_buffer_at_offset(
+	              io_trace,
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_io_trace_free(
+	          &io_trace,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_trace",
+	 io_trace );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_trace != NULL )
+	{
+		libvsgpt_io_trace_free(
+		 &io_trace,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_trace_initialize",
+	 vsgpt_test_io_trace_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_trace_free",
+	 vsgpt_test_io_trace_free );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_trace_set_callback",
+	 vsgpt_test_io_trace_set_callback );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_trace_start_phase",
+	 vsgpt_test_io_trace_start_and_end_phase );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_io_trace_read_buffer_at_offset",
+	 vsgpt_test_io_trace_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
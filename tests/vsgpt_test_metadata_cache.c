@@ -0,0 +1,756 @@
+/*
+ * Library metadata_cache type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_functions.h"
+#include "vsgpt_test_libbfio.h"
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_metadata_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Tests the libvsgpt_metadata_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_metadata_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libvsgpt_metadata_cache_t *metadata_cache = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          1048576,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_metadata_cache_initialize(
+	          NULL,
+	          1048576,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache = (libvsgpt_metadata_cache_t *) 0x12345678UL;
+
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          1048576,
+	          &error );
+
+	metadata_cache = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_metadata_cache_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_metadata_cache_initialize(
+		          &metadata_cache,
+		          1048576,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libvsgpt_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_metadata_cache_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_metadata_cache_initialize(
+		          &metadata_cache,
+		          1048576,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libvsgpt_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libvsgpt_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_metadata_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_metadata_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_metadata_cache_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_metadata_cache_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_metadata_cache_get_data(
+     void )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libvsgpt_metadata_cache_t *metadata_cache = NULL;
+	const uint8_t *data                       = NULL;
+	uint8_t *test_data                        = NULL;
+	size_t test_data_offset                   = 0;
+	size_t test_data_size                     = 132072;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * test_data_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	for( test_data_offset = 0;
+	     test_data_offset < test_data_size;
+	     test_data_offset++ )
+	{
+		test_data[ test_data_offset ] = (uint8_t) ( test_data_offset % 251 );
+	}
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          (size64_t) test_data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          test_data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          0,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_reads",
+	 metadata_cache->number_of_reads,
+	 1 );
+
+	result = memory_compare(
+	          data,
+	          &( test_data[ 0 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that data in the same block is served from memory
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          4096,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_reads",
+	 metadata_cache->number_of_reads,
+	 1 );
+
+	result = memory_compare(
+	          data,
+	          &( test_data[ 4096 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data in the last block, which is smaller than the block size
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          131560,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_reads",
+	 metadata_cache->number_of_reads,
+	 2 );
+
+	result = memory_compare(
+	          data,
+	          &( test_data[ 131560 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that spans multiple blocks
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          65280,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_reads",
+	 metadata_cache->number_of_reads,
+	 3 );
+
+	result = memory_compare(
+	          data,
+	          &( test_data[ 65280 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data outside the volume
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          131972,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_reads",
+	 metadata_cache->number_of_reads,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_metadata_cache_get_data(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          -1,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          0,
+	          0,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          0,
+	          65537,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          file_io_handle,
+	          0,
+	          512,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_metadata_cache_get_data(
+	          metadata_cache,
+	          NULL,
+	          130560,
+	          512,
+	          &data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 test_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( metadata_cache != NULL )
+	{
+		libvsgpt_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_metadata_cache_initialize",
+	 vsgpt_test_metadata_cache_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_metadata_cache_free",
+	 vsgpt_test_metadata_cache_free );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_metadata_cache_get_data",
+	 vsgpt_test_metadata_cache_get_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,921 @@
+/*
+ * Library offset_index type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_offset_index.h"
+#include "../libvsgpt/libvsgpt_partition_values.h"
+#include "../libvsgpt/libvsgpt_partition_values_array.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Tests the libvsgpt_offset_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_offset_index_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvsgpt_offset_index_t *offset_index = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_offset_index_initialize(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset_index = (libvsgpt_offset_index_t *) 0x12345678UL;
+
+	result = libvsgpt_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	offset_index = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_offset_index_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_offset_index_initialize(
+		          &offset_index,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( offset_index != NULL )
+			{
+				libvsgpt_offset_index_free(
+				 &offset_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "offset_index",
+			 offset_index );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_offset_index_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_offset_index_initialize(
+		          &offset_index,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( offset_index != NULL )
+			{
+				libvsgpt_offset_index_free(
+				 &offset_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "offset_index",
+			 offset_index );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_index != NULL )
+	{
+		libvsgpt_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_offset_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_offset_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_offset_index_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Appends partition values to a partitions array
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_offset_index_append_partition_values(
+     libvsgpt_partition_values_array_t *partitions,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_values_t partition_values;
+
+	int values_index = 0;
+
+	if( memory_set(
+	     &partition_values,
+	     0,
+	     sizeof( libvsgpt_partition_values_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	partition_values.offset = offset;
+	partition_values.size   = size;
+
+	if( libvsgpt_partition_values_array_append_values(
+	     partitions,
+	     &partition_values,
+	     &values_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libvsgpt_offset_index_build function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_offset_index_build(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_offset_index_t *offset_index         = NULL;
+	libvsgpt_partition_values_array_t *partitions = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_initialize(
+	          &partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00004000,
+	          0x00001000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00001000,
+	          0x00001000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00002000,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_offset_index_build(
+	          offset_index,
+	          partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->number_of_entries",
+	 offset_index->number_of_entries,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset_index->entries[ 0 ].start_offset",
+	 (int64_t) offset_index->entries[ 0 ].start_offset,
+	 (int64_t) 0x00001000 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->entries[ 0 ].partition_index",
+	 offset_index->entries[ 0 ].partition_index,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset_index->entries[ 1 ].start_offset",
+	 (int64_t) offset_index->entries[ 1 ].start_offset,
+	 (int64_t) 0x00004000 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->entries[ 1 ].partition_index",
+	 offset_index->entries[ 1 ].partition_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_offset_index_build(
+	          NULL,
+	          partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_offset_index_build(
+	          offset_index,
+	          partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_offset_index_clear(
+	          offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_build(
+	          offset_index,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_values_array_free(
+	          &partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partitions != NULL )
+	{
+		libvsgpt_partition_values_array_free(
+		 &partitions,
+		 NULL );
+	}
+	if( offset_index != NULL )
+	{
+		libvsgpt_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_offset_index_get_partition_index_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_offset_index_get_partition_index_by_offset(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_offset_index_t *offset_index         = NULL;
+	libvsgpt_partition_values_array_t *partitions = NULL;
+	off64_t relative_offset                       = 0;
+	int partition_index                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_initialize(
+	          &partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Partition 0 overlaps partition 1 and is contained in neither of the others
+	 */
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00001000,
+	          0x00008000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00002000,
+	          0x00001000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsgpt_test_offset_index_append_partition_values(
+	          partitions,
+	          0x00010000,
+	          0x00001000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libvsgpt_offset_index_build(
+	          offset_index,
+	          partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00000fff,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00002800,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "relative_offset",
+	 (int64_t) relative_offset,
+	 (int64_t) 0x00001800 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00008fff,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00009000,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00010010,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "relative_offset",
+	 (int64_t) relative_offset,
+	 (int64_t) 0x00000010 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          -1,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          NULL,
+	          0x00002800,
+	          &partition_index,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00002800,
+	          NULL,
+	          &relative_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_offset_index_get_partition_index_by_offset(
+	          offset_index,
+	          0x00002800,
+	          &partition_index,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_values_array_free(
+	          &partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partitions != NULL )
+	{
+		libvsgpt_partition_values_array_free(
+		 &partitions,
+		 NULL );
+	}
+	if( offset_index != NULL )
+	{
+		libvsgpt_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_offset_index_initialize",
+	 vsgpt_test_offset_index_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_offset_index_free",
+	 vsgpt_test_offset_index_free );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_offset_index_build",
+	 vsgpt_test_offset_index_build );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_offset_index_get_partition_index_by_offset",
+	 vsgpt_test_offset_index_get_partition_index_by_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
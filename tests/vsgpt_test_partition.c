@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -36,9 +37,16 @@
 #include "vsgpt_test_rwlock.h"
 #include "vsgpt_test_unused.h"
 
+#include "../libvsgpt/libvsgpt_io_handle.h"
+#include "../libvsgpt/libvsgpt_libcthreads.h"
 #include "../libvsgpt/libvsgpt_partition.h"
+#include "../libvsgpt/libvsgpt_partition_cursor.h"
 #include "../libvsgpt/libvsgpt_partition_values.h"
 
+#define VSGPT_TEST_PARTITION_DATA_SIZE			16384
+#define VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS	4
+#define VSGPT_TEST_PARTITION_NUMBER_OF_THREADS		16
+
 #if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
 
 /* Tests the libvsgpt_partition_initialize function
@@ -82,6 +90,9 @@ int vsgpt_test_partition_initialize(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -120,6 +131,9 @@ int vsgpt_test_partition_initialize(
 	result = libvsgpt_partition_initialize(
 	          NULL,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -140,6 +154,9 @@ int vsgpt_test_partition_initialize(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -161,6 +178,9 @@ int vsgpt_test_partition_initialize(
 	          &partition,
 	          NULL,
 	          NULL,
+	          NULL,
+	          0,
+	          NULL,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -193,6 +213,9 @@ int vsgpt_test_partition_initialize(
 		result = libvsgpt_partition_initialize(
 		          &partition,
 		          NULL,
+		          NULL,
+		          NULL,
+		          0,
 		          partition_values,
 		          &error );
 
@@ -239,6 +262,9 @@ int vsgpt_test_partition_initialize(
 		result = libvsgpt_partition_initialize(
 		          &partition,
 		          NULL,
+		          NULL,
+		          NULL,
+		          0,
 		          partition_values,
 		          &error );
 
@@ -369,6 +395,9 @@ int vsgpt_test_partition_free(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -478,21 +507,54 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_entry_index function
+/* Tests the libvsgpt_partition_clone_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_entry_index(
-     libvsgpt_partition_t *partition )
+int vsgpt_test_partition_clone_file_io_handle(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t entry_index     = 0;
-	int result               = 0;
+	uint8_t buffer[ 512 ];
+	uint8_t test_data[ 2048 ];
+
+	libbfio_handle_t *destination_file_io_handle = NULL;
+	libbfio_handle_t *source_file_io_handle      = NULL;
+	libcerror_error_t *error                     = NULL;
+	ssize_t read_count                           = 0;
+	size_t data_offset                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = vsgpt_test_open_file_io_handle(
+	          &source_file_io_handle,
+	          test_data,
+	          2048,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "source_file_io_handle",
+	 source_file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_partition_get_entry_index(
-	          partition,
-	          &entry_index,
+	result = libvsgpt_partition_clone_file_io_handle(
+	          &destination_file_io_handle,
+	          source_file_io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -500,15 +562,58 @@ int vsgpt_test_partition_get_entry_index(
 	 result,
 	 1 );
 
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_file_io_handle",
+	 destination_file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              destination_file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( test_data[ 1024 ] ),
+	          512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &destination_file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libvsgpt_partition_get_entry_index(
+	result = libvsgpt_partition_clone_file_io_handle(
 	          NULL,
-	          &entry_index,
+	          source_file_io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -523,11 +628,15 @@ int vsgpt_test_partition_get_entry_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_entry_index(
-	          partition,
-	          NULL,
+	destination_file_io_handle = (libbfio_handle_t *) 0x12345678UL;
+
+	result = libvsgpt_partition_clone_file_io_handle(
+	          &destination_file_io_handle,
+	          source_file_io_handle,
 	          &error );
 
+	destination_file_io_handle = NULL;
+
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -540,63 +649,37 @@ int vsgpt_test_partition_get_entry_index(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_partition_get_entry_index with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_partition_get_entry_index(
-	          partition,
-	          &entry_index,
+	result = libvsgpt_partition_clone_file_io_handle(
+	          &destination_file_io_handle,
+	          NULL,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_partition_get_entry_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libvsgpt_partition_get_entry_index(
-	          partition,
-	          &entry_index,
+	/* Clean up
+	 */
+	result = vsgpt_test_close_file_io_handle(
+	          &source_file_io_handle,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -606,106 +689,314 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( destination_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &destination_file_io_handle,
+		 NULL );
+	}
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_identifier function
+/* Tests the libvsgpt_internal_partition_get_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_identifier(
-     libvsgpt_partition_t *partition )
+int vsgpt_test_internal_partition_get_file_io_handle(
+     void )
 {
-	uint8_t guid_data[ 16 ];
+	uint8_t test_data[ 2048 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle              = NULL;
+	libbfio_handle_t *partition_file_io_handle    = NULL;
+	libbfio_handle_t *volume_file_io_handle       = NULL;
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	size_t data_offset                            = 0;
+	int result                                    = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libvsgpt_partition_get_identifier(
-	          partition,
-	          guid_data,
-	          16,
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = vsgpt_test_open_file_io_handle(
+	          &volume_file_io_handle,
+	          test_data,
+	          2048,
 	          &error );
 
-	VSGPT_TEST_ASSERT_NOT_EQUAL_INT(
+	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_file_io_handle",
+	 volume_file_io_handle );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libvsgpt_partition_get_identifier(
-	          NULL,
-	          guid_data,
-	          16,
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	partition_values->offset = 512;
+	partition_values->size   = 1024;
 
-	result = libvsgpt_partition_get_identifier(
-	          partition,
+	result = libvsgpt_partition_initialize(
+	          &partition,
 	          NULL,
-	          16,
+	          volume_file_io_handle,
+	          NULL,
+	          0,
+	          partition_values,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* The file IO handle is not cloned before the first read
+	 */
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 ( (libvsgpt_internal_partition_t *) partition )->file_io_handle );
 
-	result = libvsgpt_partition_get_identifier(
-	          partition,
-	          guid_data,
-	          0,
+	/* Test regular cases
+	 */
+	result = libvsgpt_internal_partition_get_file_io_handle(
+	          (libvsgpt_internal_partition_t *) partition,
+	          &partition_file_io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_file_io_handle",
+	 partition_file_io_handle );
+
+	VSGPT_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "partition_file_io_handle",
+	 (intptr_t) partition_file_io_handle,
+	 (intptr_t) volume_file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libvsgpt_partition_get_identifier(
-	          partition,
-	          guid_data,
-	          (size_t) SSIZE_MAX + 1,
+	/* The file IO handle is cloned only once
+	 */
+	result = libvsgpt_internal_partition_get_file_io_handle(
+	          (libvsgpt_internal_partition_t *) partition,
+	          &file_io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
+	VSGPT_TEST_ASSERT_EQUAL_INTPTR(
+	 "file_io_handle",
+	 (intptr_t) file_io_handle,
+	 (intptr_t) partition_file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_internal_partition_get_file_io_handle(
+	          NULL,
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_internal_partition_get_file_io_handle(
+	          (libvsgpt_internal_partition_t *) partition,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &volume_file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	if( volume_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &volume_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_get_entry_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_get_entry_index(
+     libvsgpt_partition_t *partition )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t entry_index     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_get_entry_index(
+	          partition,
+	          &entry_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_get_entry_index(
+	          NULL,
+	          &entry_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_get_entry_index(
+	          partition,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
 	 error );
 
 	libcerror_error_free(
@@ -713,14 +1004,13 @@ int vsgpt_test_partition_get_identifier(
 
 #if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
 
-	/* Test libvsgpt_partition_get_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libvsgpt_partition_get_entry_index with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
 	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libvsgpt_partition_get_identifier(
+	result = libvsgpt_partition_get_entry_index(
 	          partition,
-	          guid_data,
-	          16,
+	          &entry_index,
 	          &error );
 
 	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
@@ -741,14 +1031,13 @@ int vsgpt_test_partition_get_identifier(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libvsgpt_partition_get_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libvsgpt_partition_get_entry_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libvsgpt_partition_get_identifier(
+	result = libvsgpt_partition_get_entry_index(
 	          partition,
-	          guid_data,
-	          16,
+	          &entry_index,
 	          &error );
 
 	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -782,10 +1071,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_type_identifier function
+/* Tests the libvsgpt_partition_get_identifier function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_type_identifier(
+int vsgpt_test_partition_get_identifier(
      libvsgpt_partition_t *partition )
 {
 	uint8_t guid_data[ 16 ];
@@ -795,7 +1084,7 @@ int vsgpt_test_partition_get_type_identifier(
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          guid_data,
 	          16,
@@ -812,7 +1101,7 @@ int vsgpt_test_partition_get_type_identifier(
 
 	/* Test error cases
 	 */
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          NULL,
 	          guid_data,
 	          16,
@@ -830,7 +1119,7 @@ int vsgpt_test_partition_get_type_identifier(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          NULL,
 	          16,
@@ -848,7 +1137,7 @@ int vsgpt_test_partition_get_type_identifier(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          guid_data,
 	          0,
@@ -866,7 +1155,7 @@ int vsgpt_test_partition_get_type_identifier(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          guid_data,
 	          (size_t) SSIZE_MAX + 1,
@@ -886,11 +1175,11 @@ int vsgpt_test_partition_get_type_identifier(
 
 #if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
 
-	/* Test libvsgpt_partition_get_type_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libvsgpt_partition_get_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
 	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          guid_data,
 	          16,
@@ -914,11 +1203,11 @@ int vsgpt_test_partition_get_type_identifier(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libvsgpt_partition_get_type_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libvsgpt_partition_get_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libvsgpt_partition_get_type_identifier(
+	result = libvsgpt_partition_get_identifier(
 	          partition,
 	          guid_data,
 	          16,
@@ -955,27 +1244,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_type function
+/* Tests the libvsgpt_partition_get_type_identifier function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_type(
+int vsgpt_test_partition_get_type_identifier(
      libvsgpt_partition_t *partition )
 {
+	uint8_t guid_data[ 16 ];
+
 	libcerror_error_t *error = NULL;
 	int result               = 0;
-	uint8_t partition_type   = 0;
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_partition_get_type(
+	result = libvsgpt_partition_get_type_identifier(
 	          partition,
-	          &partition_type,
+	          guid_data,
+	          16,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT(
+	VSGPT_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -983,9 +1274,10 @@ int vsgpt_test_partition_get_type(
 
 	/* Test error cases
 	 */
-	result = libvsgpt_partition_get_type(
+	result = libvsgpt_partition_get_type_identifier(
 	          NULL,
-	          &partition_type,
+	          guid_data,
+	          16,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1000,9 +1292,10 @@ int vsgpt_test_partition_get_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_type(
+	result = libvsgpt_partition_get_type_identifier(
 	          partition,
 	          NULL,
+	          16,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1017,33 +1310,202 @@ int vsgpt_test_partition_get_type(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_partition_get_type with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_partition_get_type(
+	result = libvsgpt_partition_get_type_identifier(
 	          partition,
-	          &partition_type,
+	          guid_data,
+	          0,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_get_type_identifier(
+	          partition,
+	          guid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_partition_get_type_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_partition_get_type_identifier(
+	          partition,
+	          guid_data,
+	          16,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_partition_get_type_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_partition_get_type_identifier(
+	          partition,
+	          guid_data,
+	          16,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_get_type(
+     libvsgpt_partition_t *partition )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	uint8_t partition_type   = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_get_type(
+	          partition,
+	          &partition_type,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_get_type(
+	          NULL,
+	          &partition_type,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_get_type(
+	          partition,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_partition_get_type with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_partition_get_type(
+	          partition,
+	          &partition_type,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
 		 &error );
 	}
 	/* Test libvsgpt_partition_get_type with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
@@ -1258,6 +1720,9 @@ int vsgpt_test_internal_partition_read_buffer_from_file_io_handle(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -1542,25 +2007,50 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_read_buffer function
+/* Tests the libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_read_buffer(
+int vsgpt_test_internal_partition_read_buffer_at_offset_from_file_io_handle(
      void )
 {
-	uint8_t buffer[ 2048 ];
-	uint8_t test_data[ 2048 ];
-
 	libbfio_handle_t *file_io_handle              = NULL;
-
 	libcerror_error_t *error                      = NULL;
 	libvsgpt_partition_t *partition               = NULL;
 	libvsgpt_partition_values_t *partition_values = NULL;
+	uint8_t *buffer                               = NULL;
+	uint8_t *test_data                            = NULL;
+	size_t cache_sector_size                      = 0;
+	size_t data_offset                            = 0;
+	size_t uncached_read_size                     = 0;
 	ssize_t read_count                            = 0;
+	int number_of_deduplicated_misses             = 0;
+	int number_of_sector_reads                    = 0;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
+	uncached_read_size = LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARDS * LIBVSGPT_SECTOR_CACHE_NUMBER_OF_SHARD_ENTRIES * 512;
+
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * 2 * uncached_read_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	for( data_offset = 0;
+	     data_offset < ( 2 * uncached_read_size );
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( ( data_offset / 512 ) + data_offset );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * uncached_read_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
 	result = libvsgpt_partition_values_initialize(
 	          &partition_values,
 	          &error );
@@ -1578,12 +2068,15 @@ int vsgpt_test_partition_read_buffer(
 	 "error",
 	 error );
 
-	partition_values->size = 2048;
+	partition_values->size = 2 * uncached_read_size;
 
-	result = vsgpt_test_open_file_io_handle(
-	          &file_io_handle,
-	          test_data,
-	          2048,
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          partition_values,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1592,17 +2085,26 @@ int vsgpt_test_partition_read_buffer(
 	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	 "partition",
+	 partition );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libvsgpt_partition_initialize(
-	          &partition,
-	          file_io_handle,
-	          partition_values,
+	/* The threshold is derived from the sector size of the sector cache
+	 */
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncached_read_minimum_size",
+	 ( (libvsgpt_internal_partition_t *) partition )->uncached_read_minimum_size,
+	 uncached_read_size );
+
+	/* Initialize file IO handle
+	 */
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          2 * uncached_read_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1611,19 +2113,21 @@ int vsgpt_test_partition_read_buffer(
 	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition",
-	 partition );
+	 "file_io_handle",
+	 file_io_handle );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test a small read, which uses the sector cache
 	 */
-	read_count = libvsgpt_partition_read_buffer(
-	              partition,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              buffer,
 	              512,
+	              0,
 	              &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
@@ -1635,120 +2139,91 @@ int vsgpt_test_partition_read_buffer(
 	 "error",
 	 error );
 
-	read_count = libvsgpt_partition_read_buffer(
-	              partition,
-	              buffer,
-	              2048,
-	              &error );
+	result = libvsgpt_partition_get_cache_statistics(
+	          partition,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
+	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 1536 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_reads",
+	 number_of_sector_reads,
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test a large read, which does not use the sector cache
 	 */
-	read_count = libvsgpt_partition_read_buffer(
-	              NULL,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              buffer,
-	              512,
-	              &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
-
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	/* Test libvsgpt_partition_read_buffer with libvsgpt_internal_partition_read_buffer_from_file_io_handle failing
-	 */
-	read_count = libvsgpt_partition_read_buffer(
-	              partition,
-	              NULL,
-	              512,
+	              uncached_read_size,
+	              100,
 	              &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) -1 );
+	 (ssize_t) uncached_read_size );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          buffer,
+	          &( test_data[ 100 ] ),
+	          uncached_read_size );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Test libvsgpt_partition_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	result = libvsgpt_partition_get_cache_statistics(
+	          partition,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
+	          &error );
 
-	read_count = libvsgpt_partition_read_buffer(
-	              partition,
-	              buffer,
-	              512,
-	              &error );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_reads",
+	 number_of_sector_reads,
+	 1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_partition_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Clean up file IO handle
 	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	read_count = libvsgpt_partition_read_buffer(
-	              partition,
-	              buffer,
-	              512,
-	              &error );
-
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Clean up
 	 */
@@ -1769,19 +2244,6 @@ int vsgpt_test_partition_read_buffer(
 	 "error",
 	 error );
 
-	result = vsgpt_test_close_file_io_handle(
-	          &file_io_handle,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libvsgpt_partition_values_free(
 	          &partition_values,
 	          &error );
@@ -1799,6 +2261,12 @@ int vsgpt_test_partition_read_buffer(
 	 "error",
 	 error );
 
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 test_data );
+
 	return( 1 );
 
 on_error:
@@ -1807,48 +2275,68 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( partition != NULL )
-	{
-		libvsgpt_partition_free(
-		 &partition,
-		 NULL );
-	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
 		 &file_io_handle,
 		 NULL );
 	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
 	if( partition_values != NULL )
 	{
 		libvsgpt_partition_values_free(
 		 &partition_values,
 		 NULL );
 	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_read_buffer_at_offset function
+/* Tests the libvsgpt_internal_partition_read_buffer_at_offset_uncached function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_read_buffer_at_offset(
+int vsgpt_test_internal_partition_read_buffer_at_offset_uncached(
      void )
 {
 	uint8_t buffer[ 2048 ];
 	uint8_t test_data[ 2048 ];
 
 	libbfio_handle_t *file_io_handle              = NULL;
-
 	libcerror_error_t *error                      = NULL;
+	libvsgpt_io_handle_t *io_handle               = NULL;
 	libvsgpt_partition_t *partition               = NULL;
 	libvsgpt_partition_values_t *partition_values = NULL;
+	size_t cache_sector_size                      = 0;
 	ssize_t read_count                            = 0;
+	int number_of_deduplicated_misses             = 0;
+	int number_of_sector_reads                    = 0;
 	int result                                    = 0;
+	int test_index                                = 0;
 
 	/* Initialize test
 	 */
-	result = libvsgpt_partition_values_initialize(
-	          &partition_values,
+	for( test_index = 0;
+	     test_index < 2048;
+	     test_index++ )
+	{
+		test_data[ test_index ] = (uint8_t) ( test_index / 7 );
+	}
+	result = libvsgpt_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1857,19 +2345,15 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition_values",
-	 partition_values );
+	 "io_handle",
+	 io_handle );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	partition_values->size = 2048;
-
-	result = vsgpt_test_open_file_io_handle(
-	          &file_io_handle,
-	          test_data,
-	          2048,
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1878,16 +2362,22 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	 "partition_values",
+	 partition_values );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	partition_values->offset = 512;
+	partition_values->size   = 1024;
+
 	result = libvsgpt_partition_initialize(
 	          &partition,
-	          file_io_handle,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -1904,13 +2394,64 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	 "error",
 	 error );
 
+	/* Initialize file IO handle
+	 */
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          2048,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
+	              buffer,
+	              700,
+	              100,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 700 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( test_data[ 612 ] ),
+	          700 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read beyond the end of the partition
+	 */
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              buffer,
+	              2048,
 	              512,
-	              0,
 	              &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
@@ -1922,31 +2463,60 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	 "error",
 	 error );
 
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              buffer,
-	              2048,
 	              512,
+	              1024,
 	              &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) 1536 );
+	 (ssize_t) 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test that the sector cache was not used
 	 */
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              NULL,
+	result = libvsgpt_partition_get_cache_statistics(
+	          partition,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_reads",
+	 number_of_sector_reads,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with abort signalled
+	 */
+	io_handle->abort = 1;
+
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              buffer,
 	              512,
 	              0,
 	              &error );
 
+	io_handle->abort = 0;
+
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
@@ -1959,13 +2529,14 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test libvsgpt_partition_read_buffer_at_offset with libvsgpt_internal_partition_seek_offset failing
+	/* Test error cases
 	 */
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              NULL,
+	              file_io_handle,
 	              buffer,
 	              512,
-	              -1,
+	              0,
 	              &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
@@ -1980,10 +2551,9 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test libvsgpt_partition_read_buffer_at_offset with libvsgpt_internal_partition_read_buffer_from_file_io_handle failing
-	 */
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
 	              NULL,
 	              512,
 	              0,
@@ -2001,18 +2571,1387 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_at_offset_uncached(
+	              (libvsgpt_internal_partition_t *) partition,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              -1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvsgpt_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_partition_read_buffer_from_data function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_partition_read_buffer_from_data(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+	uint8_t test_data[ 2048 ];
+
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	ssize_t read_count                            = 0;
+	off64_t current_offset                        = 0;
+	size_t data_offset                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( data_offset / 512 );
+	}
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The partition extends beyond the end of the volume data
+	 */
+	partition_values->offset = 512;
+	partition_values->size   = 2048;
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          NULL,
+	          test_data,
+	          2048,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              2048,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 2 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              NULL,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	current_offset = ( (libvsgpt_internal_partition_t *) partition )->current_offset;
+
+	( (libvsgpt_internal_partition_t *) partition )->current_offset = -1;
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              512,
+	              &error );
+
+	( (libvsgpt_internal_partition_t *) partition )->current_offset = current_offset;
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              NULL,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_internal_partition_read_buffer_from_data(
+	              (libvsgpt_internal_partition_t *) partition,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_read_buffer(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+	uint8_t test_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle              = NULL;
+
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	ssize_t read_count                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	partition_values->size = 2048;
+
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          2048,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libvsgpt_partition_read_buffer(
+	              partition,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_partition_read_buffer(
+	              partition,
+	              buffer,
+	              2048,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1536 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_partition_read_buffer(
+	              NULL,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_partition_read_buffer with libvsgpt_internal_partition_read_buffer_from_file_io_handle failing
+	 */
+	read_count = libvsgpt_partition_read_buffer(
+	              partition,
+	              NULL,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_partition_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libvsgpt_partition_read_buffer(
+	              partition,
+	              buffer,
+	              512,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_partition_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libvsgpt_partition_read_buffer(
+	              partition,
+	              buffer,
+	              512,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+	uint8_t test_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle              = NULL;
+
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	ssize_t read_count                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	partition_values->size = 2048;
+
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          2048,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              2048,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1536 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_partition_read_buffer_at_offset with libvsgpt_internal_partition_seek_offset failing
+	 */
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              -1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_partition_read_buffer_at_offset with libvsgpt_internal_partition_read_buffer_from_file_io_handle failing
+	 */
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              NULL,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
 	/* Test libvsgpt_partition_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
-	              buffer,
-	              512,
-	              0,
-	              &error );
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_partition_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libvsgpt_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_partition_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_partition_seek_offset(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	off64_t offset                                = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	partition_values->size = 2048;
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          512,
+	          SEEK_CUR,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          512,
+	          SEEK_CUR,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1024 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 2048 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libvsgpt_internal_partition_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libvsgpt_internal_partition_seek_offset(
+	          (libvsgpt_internal_partition_t *) partition,
+	          0,
+	          -1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_seek_offset(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	off64_t offset                                = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libvsgpt_partition_seek_offset(
+	          partition,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libvsgpt_partition_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libvsgpt_partition_seek_offset with libvsgpt_internal_partition_seek_offset failing
+	 */
+	offset = libvsgpt_partition_seek_offset(
+	          partition,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_partition_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	offset = libvsgpt_partition_seek_offset(
+	          partition,
+	          0,
+	          SEEK_SET,
+	          &error );
 
 	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
@@ -2020,10 +3959,10 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	}
 	else
 	{
-		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+		VSGPT_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
 
 		VSGPT_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2032,16 +3971,15 @@ int vsgpt_test_partition_read_buffer_at_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libvsgpt_partition_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libvsgpt_partition_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	read_count = libvsgpt_partition_read_buffer_at_offset(
-	              partition,
-	              buffer,
-	              512,
-	              0,
-	              &error );
+	offset = libvsgpt_partition_seek_offset(
+	          partition,
+	          0,
+	          SEEK_SET,
+	          &error );
 
 	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
@@ -2049,10 +3987,10 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	}
 	else
 	{
-		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+		VSGPT_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
 
 		VSGPT_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2082,19 +4020,6 @@ int vsgpt_test_partition_read_buffer_at_offset(
 	 "error",
 	 error );
 
-	result = vsgpt_test_close_file_io_handle(
-	          &file_io_handle,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libvsgpt_partition_values_free(
 	          &partition_values,
 	          &error );
@@ -2126,12 +4051,6 @@ on_error:
 		 &partition,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	if( partition_values != NULL )
 	{
 		libvsgpt_partition_values_free(
@@ -2141,10 +4060,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_internal_partition_seek_offset function
+/* Tests the libvsgpt_partition_get_offset function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_internal_partition_seek_offset(
+int vsgpt_test_partition_get_offset(
      void )
 {
 	libcerror_error_t *error                      = NULL;
@@ -2172,11 +4091,12 @@ int vsgpt_test_internal_partition_seek_offset(
 	 "error",
 	 error );
 
-	partition_values->size = 2048;
-
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -2195,61 +4115,15 @@ int vsgpt_test_internal_partition_seek_offset(
 
 	/* Test regular cases
 	 */
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          512,
-	          SEEK_CUR,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) 512 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          512,
-	          SEEK_CUR,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) 1024 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          0,
-	          SEEK_END,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) 2048 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          0,
-	          SEEK_SET,
+	result = libvsgpt_partition_get_offset(
+	          partition,
+	          &offset,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) 0 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2257,16 +4131,15 @@ int vsgpt_test_internal_partition_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libvsgpt_internal_partition_seek_offset(
+	result = libvsgpt_partition_get_offset(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          &offset,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2275,16 +4148,15 @@ int vsgpt_test_internal_partition_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          -1,
-	          SEEK_SET,
+	result = libvsgpt_partition_get_offset(
+	          partition,
+	          NULL,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2293,23 +4165,63 @@ int vsgpt_test_internal_partition_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libvsgpt_internal_partition_seek_offset(
-	          (libvsgpt_internal_partition_t *) partition,
-	          0,
-	          -1,
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_partition_get_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_partition_get_offset(
+	          partition,
+	          &offset,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_partition_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_partition_get_offset(
+	          partition,
+	          &offset,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) -1 );
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
 
 	/* Clean up
 	 */
@@ -2370,16 +4282,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_seek_offset function
+/* Tests the libvsgpt_partition_get_size function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_seek_offset(
+int vsgpt_test_partition_get_size(
      void )
 {
 	libcerror_error_t *error                      = NULL;
 	libvsgpt_partition_t *partition               = NULL;
 	libvsgpt_partition_values_t *partition_values = NULL;
-	off64_t offset                                = 0;
+	size64_t size                                 = 0;
 	int result                                    = 0;
 
 	/* Initialize test
@@ -2404,6 +4316,9 @@ int vsgpt_test_partition_seek_offset(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -2422,16 +4337,15 @@ int vsgpt_test_partition_seek_offset(
 
 	/* Test regular cases
 	 */
-	offset = libvsgpt_partition_seek_offset(
+	result = libvsgpt_partition_get_size(
 	          partition,
-	          0,
-	          SEEK_SET,
+	          &size,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) 0 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2439,16 +4353,15 @@ int vsgpt_test_partition_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libvsgpt_partition_seek_offset(
+	result = libvsgpt_partition_get_size(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          &size,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2457,18 +4370,15 @@ int vsgpt_test_partition_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test libvsgpt_partition_seek_offset with libvsgpt_internal_partition_seek_offset failing
-	 */
-	offset = libvsgpt_partition_seek_offset(
+	result = libvsgpt_partition_get_size(
 	          partition,
-	          -1,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 (int64_t) offset,
-	 (int64_t) -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2479,26 +4389,25 @@ int vsgpt_test_partition_seek_offset(
 
 #if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
 
-	/* Test libvsgpt_partition_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libvsgpt_partition_get_size with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	offset = libvsgpt_partition_seek_offset(
+	result = libvsgpt_partition_get_size(
 	          partition,
-	          0,
-	          SEEK_SET,
+	          &size,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
-		VSGPT_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
 		VSGPT_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2507,14 +4416,13 @@ int vsgpt_test_partition_seek_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libvsgpt_partition_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libvsgpt_partition_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	offset = libvsgpt_partition_seek_offset(
+	result = libvsgpt_partition_get_size(
 	          partition,
-	          0,
-	          SEEK_SET,
+	          &size,
 	          &error );
 
 	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -2523,10 +4431,10 @@ int vsgpt_test_partition_seek_offset(
 	}
 	else
 	{
-		VSGPT_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
 		VSGPT_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2596,16 +4504,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_offset function
+/* Tests the libvsgpt_partition_get_cache_statistics function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_offset(
+int vsgpt_test_partition_get_cache_statistics(
      void )
 {
 	libcerror_error_t *error                      = NULL;
 	libvsgpt_partition_t *partition               = NULL;
 	libvsgpt_partition_values_t *partition_values = NULL;
-	off64_t offset                                = 0;
+	size_t cache_sector_size                      = 0;
+	int number_of_deduplicated_misses             = 0;
+	int number_of_sector_reads                    = 0;
 	int result                                    = 0;
 
 	/* Initialize test
@@ -2630,6 +4540,9 @@ int vsgpt_test_partition_get_offset(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -2648,9 +4561,11 @@ int vsgpt_test_partition_get_offset(
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_partition_get_offset(
+	result = libvsgpt_partition_get_cache_statistics(
 	          partition,
-	          &offset,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2658,15 +4573,32 @@ int vsgpt_test_partition_get_offset(
 	 result,
 	 1 );
 
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_sector_size",
+	 cache_sector_size,
+	 (size_t) 512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_reads",
+	 number_of_sector_reads,
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_deduplicated_misses",
+	 number_of_deduplicated_misses,
+	 0 );
+
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libvsgpt_partition_get_offset(
+	result = libvsgpt_partition_get_cache_statistics(
 	          NULL,
-	          &offset,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2681,9 +4613,11 @@ int vsgpt_test_partition_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_partition_get_offset(
+	result = libvsgpt_partition_get_cache_statistics(
 	          partition,
 	          NULL,
+	          &number_of_sector_reads,
+	          &number_of_deduplicated_misses,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2698,63 +4632,43 @@ int vsgpt_test_partition_get_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_partition_get_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_partition_get_offset(
+	result = libvsgpt_partition_get_cache_statistics(
 	          partition,
-	          &offset,
+	          &cache_sector_size,
+	          NULL,
+	          &number_of_deduplicated_misses,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_partition_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libvsgpt_partition_get_offset(
+	result = libvsgpt_partition_get_cache_statistics(
 	          partition,
-	          &offset,
+	          &cache_sector_size,
+	          &number_of_sector_reads,
+	          NULL,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -2815,41 +4729,166 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_partition_get_size function
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+typedef struct vsgpt_test_partition_thread_values vsgpt_test_partition_thread_values_t;
+
+struct vsgpt_test_partition_thread_values
+{
+	/* The partition
+	 */
+	libvsgpt_partition_t *partition;
+
+	/* The partition cursor
+	 */
+	libvsgpt_partition_cursor_t *partition_cursor;
+
+	/* The partition data
+	 */
+	const uint8_t *partition_data;
+
+	/* The index of the thread
+	 */
+	int thread_index;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Reads the partition data several times with reads that are not sector aligned
+ * alternating between reads of the partition and reads of the partition cursor
+ * Callback function for the partition threads
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_partition_read_thread(
+     vsgpt_test_partition_thread_values_t *thread_values )
+{
+	uint8_t buffer[ 1000 ];
+
+	ssize_t read_count = 0;
+	size_t read_size   = 0;
+	off64_t offset     = 0;
+	int iteration      = 0;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	thread_values->result = 1;
+
+	for( iteration = 0;
+	     iteration < 16;
+	     iteration++ )
+	{
+		/* Start every thread at a different offset so that the threads
+		 * read different sectors of the same partition at the same time
+		 */
+		offset = (off64_t) thread_values->thread_index * 1000;
+
+		while( offset < VSGPT_TEST_PARTITION_DATA_SIZE )
+		{
+			read_size = 1000;
+
+			if( read_size > (size_t) ( VSGPT_TEST_PARTITION_DATA_SIZE - offset ) )
+			{
+				read_size = (size_t) ( VSGPT_TEST_PARTITION_DATA_SIZE - offset );
+			}
+			if( ( iteration % 2 ) == 0 )
+			{
+				read_count = libvsgpt_partition_read_buffer_at_offset(
+				              thread_values->partition,
+				              buffer,
+				              read_size,
+				              offset,
+				              NULL );
+			}
+			else
+			{
+				read_count = libvsgpt_partition_cursor_read_buffer_at_offset(
+				              thread_values->partition_cursor,
+				              buffer,
+				              read_size,
+				              offset,
+				              NULL );
+			}
+
+			if( read_count != (ssize_t) read_size )
+			{
+				thread_values->result = 0;
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     buffer,
+			     &( thread_values->partition_data[ offset ] ),
+			     read_size ) != 0 )
+			{
+				thread_values->result = 0;
+
+				return( -1 );
+			}
+			offset += read_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libvsgpt_partition_read_buffer_at_offset function with multiple threads
+ * reading multiple partitions that share the same file IO handle
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_partition_get_size(
+int vsgpt_test_partition_read_buffer_at_offset_threaded(
      void )
 {
-	libcerror_error_t *error                      = NULL;
-	libvsgpt_partition_t *partition               = NULL;
-	libvsgpt_partition_values_t *partition_values = NULL;
-	size64_t size                                 = 0;
-	int result                                    = 0;
-
+	libcthreads_thread_t *threads[ VSGPT_TEST_PARTITION_NUMBER_OF_THREADS ];
+	libvsgpt_partition_cursor_t *partition_cursors[ VSGPT_TEST_PARTITION_NUMBER_OF_THREADS ];
+	libvsgpt_partition_t *partitions[ VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS ];
+	libvsgpt_partition_values_t *partition_values[ VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS ];
+	vsgpt_test_partition_thread_values_t thread_values[ VSGPT_TEST_PARTITION_NUMBER_OF_THREADS ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *test_data               = NULL;
+	size_t data_offset               = 0;
+	int other_thread_index           = 0;
+	int partition_index              = 0;
+	int result                       = 0;
+	int thread_index                 = 0;
+
+	for( partition_index = 0;
+	     partition_index < VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		partitions[ partition_index ]       = NULL;
+		partition_values[ partition_index ] = NULL;
+	}
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ]           = NULL;
+		partition_cursors[ thread_index ] = NULL;
+	}
 	/* Initialize test
 	 */
-	result = libvsgpt_partition_values_initialize(
-	          &partition_values,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS * VSGPT_TEST_PARTITION_DATA_SIZE );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition_values",
-	 partition_values );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 "test_data",
+	 test_data );
 
-	result = libvsgpt_partition_initialize(
-	          &partition,
-	          NULL,
-	          partition_values,
+	for( data_offset = 0;
+	     data_offset < ( VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS * VSGPT_TEST_PARTITION_DATA_SIZE );
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( ( data_offset / 512 ) + data_offset );
+	}
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS * VSGPT_TEST_PARTITION_DATA_SIZE,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2858,159 +4897,234 @@ int vsgpt_test_partition_get_size(
 	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition",
-	 partition );
+	 "file_io_handle",
+	 file_io_handle );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libvsgpt_partition_get_size(
-	          partition,
-	          &size,
-	          &error );
+	for( partition_index = 0;
+	     partition_index < VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		result = libvsgpt_partition_values_initialize(
+		          &( partition_values[ partition_index ] ),
+		          &error );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test error cases
-	 */
-	result = libvsgpt_partition_get_size(
-	          NULL,
-	          &size,
-	          &error );
+		partition_values[ partition_index ]->offset = (off64_t) partition_index * VSGPT_TEST_PARTITION_DATA_SIZE;
+		partition_values[ partition_index ]->size   = VSGPT_TEST_PARTITION_DATA_SIZE;
 
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		result = libvsgpt_partition_initialize(
+		          &( partitions[ partition_index ] ),
+		          NULL,
+		          file_io_handle,
+		          NULL,
+		          0,
+		          partition_values[ partition_index ],
+		          &error );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libvsgpt_partition_get_size(
-	          partition,
-	          NULL,
-	          &error );
+		/* The file IO handle is not cloned before the first read
+		 */
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 ( (libvsgpt_internal_partition_t *) partitions[ partition_index ] )->file_io_handle );
+	}
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		/* Multiple threads read the same partition
+		 */
+		partition_index = thread_index % VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
 
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		result = libvsgpt_partition_cursor_initialize(
+		          &( partition_cursors[ thread_index ] ),
+		          partitions[ partition_index ],
+		          &error );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+		thread_values[ thread_index ].partition        = partitions[ partition_index ];
+		thread_values[ thread_index ].partition_cursor = partition_cursors[ thread_index ];
+		thread_values[ thread_index ].partition_data   = &( test_data[ partition_index * VSGPT_TEST_PARTITION_DATA_SIZE ] );
+		thread_values[ thread_index ].thread_index     = thread_index;
+		thread_values[ thread_index ].result           = 0;
 
-	/* Test libvsgpt_partition_get_size with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &vsgpt_test_partition_read_thread,
+		          (void *) &( thread_values[ thread_index ] ),
+		          &error );
 
-	result = libvsgpt_partition_get_size(
-	          partition,
-	          &size,
-	          &error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 	}
-	else
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
 	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
 		VSGPT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		VSGPT_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].result",
+		 thread_values[ thread_index ].result,
+		 1 );
 	}
-	/* Test libvsgpt_partition_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	for( partition_index = 0;
+	     partition_index < VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		/* Every partition reads using its own clone of the file IO handle
+		 */
+		VSGPT_TEST_ASSERT_EQUAL_UINT8(
+		 "file_io_handle_created_in_library",
+		 ( (libvsgpt_internal_partition_t *) partitions[ partition_index ] )->file_io_handle_created_in_library,
+		 (uint8_t) 1 );
+
+		VSGPT_TEST_ASSERT_NOT_EQUAL_INTPTR(
+		 "file_io_handle",
+		 (intptr_t) ( (libvsgpt_internal_partition_t *) partitions[ partition_index ] )->file_io_handle,
+		 (intptr_t) file_io_handle );
+	}
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		/* Every cursor reads using its own clone of the file IO handle
+		 */
+		partition_index = thread_index % VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
 
-	result = libvsgpt_partition_get_size(
-	          partition,
-	          &size,
-	          &error );
+		VSGPT_TEST_ASSERT_EQUAL_UINT8(
+		 "file_io_handle_created_in_library",
+		 ( (libvsgpt_internal_partition_cursor_t *) partition_cursors[ thread_index ] )->file_io_handle_created_in_library,
+		 (uint8_t) 1 );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+		VSGPT_TEST_ASSERT_NOT_EQUAL_INTPTR(
+		 "file_io_handle",
+		 (intptr_t) ( (libvsgpt_internal_partition_cursor_t *) partition_cursors[ thread_index ] )->file_io_handle,
+		 (intptr_t) ( (libvsgpt_internal_partition_t *) partitions[ partition_index ] )->file_io_handle );
+
+		for( other_thread_index = 0;
+		     other_thread_index < thread_index;
+		     other_thread_index++ )
+		{
+			VSGPT_TEST_ASSERT_NOT_EQUAL_INTPTR(
+			 "file_io_handle",
+			 (intptr_t) ( (libvsgpt_internal_partition_cursor_t *) partition_cursors[ thread_index ] )->file_io_handle,
+			 (intptr_t) ( (libvsgpt_internal_partition_cursor_t *) partition_cursors[ other_thread_index ] )->file_io_handle );
+		}
 	}
-	else
+	/* Clean up
+	 */
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
 	{
+		result = libvsgpt_partition_cursor_free(
+		          &( partition_cursors[ thread_index ] ),
+		          &error );
+
 		VSGPT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		VSGPT_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
-
-		libcerror_error_free(
-		 &error );
 	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	for( partition_index = 0;
+	     partition_index < VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		result = libvsgpt_partition_free(
+		          &( partitions[ partition_index ] ),
+		          &error );
 
-	/* Clean up
-	 */
-	result = libvsgpt_partition_free(
-	          &partition,
-	          &error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "partition",
-	 partition );
+		result = libvsgpt_partition_values_free(
+		          &( partition_values[ partition_index ] ),
+		          &error );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libvsgpt_partition_values_free(
-	          &partition_values,
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "partition_values",
-	 partition_values );
+	 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	memory_free(
+	 test_data );
+
 	return( 1 );
 
 on_error:
@@ -3019,21 +5133,56 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( partition != NULL )
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_PARTITION_NUMBER_OF_THREADS;
+	     thread_index++ )
 	{
-		libvsgpt_partition_free(
-		 &partition,
-		 NULL );
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+		if( partition_cursors[ thread_index ] != NULL )
+		{
+			libvsgpt_partition_cursor_free(
+			 &( partition_cursors[ thread_index ] ),
+			 NULL );
+		}
 	}
-	if( partition_values != NULL )
+	for( partition_index = 0;
+	     partition_index < VSGPT_TEST_PARTITION_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
 	{
-		libvsgpt_partition_values_free(
-		 &partition_values,
+		if( partitions[ partition_index ] != NULL )
+		{
+			libvsgpt_partition_free(
+			 &( partitions[ partition_index ] ),
+			 NULL );
+		}
+		if( partition_values[ partition_index ] != NULL )
+		{
+			libvsgpt_partition_values_free(
+			 &( partition_values[ partition_index ] ),
+			 NULL );
+		}
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
 		 NULL );
 	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
 	return( 0 );
 }
 
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
 
 /* The main program
@@ -3068,6 +5217,14 @@ int main(
 	 "libvsgpt_partition_free",
 	 vsgpt_test_partition_free );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_clone_file_io_handle",
+	 vsgpt_test_partition_clone_file_io_handle );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_partition_get_file_io_handle",
+	 vsgpt_test_internal_partition_get_file_io_handle );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -3092,6 +5249,9 @@ int main(
 	result = libvsgpt_partition_initialize(
 	          &partition,
 	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          partition_values,
 	          &error );
 
@@ -3137,6 +5297,18 @@ int main(
 	 "libvsgpt_internal_partition_read_buffer_from_file_io_handle",
 	 vsgpt_test_internal_partition_read_buffer_from_file_io_handle );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_partition_read_buffer_at_offset_from_file_io_handle",
+	 vsgpt_test_internal_partition_read_buffer_at_offset_from_file_io_handle );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_partition_read_buffer_at_offset_uncached",
+	 vsgpt_test_internal_partition_read_buffer_at_offset_uncached );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_partition_read_buffer_from_data",
+	 vsgpt_test_internal_partition_read_buffer_from_data );
+
 	VSGPT_TEST_RUN(
 	 "libvsgpt_partition_read_buffer",
 	 vsgpt_test_partition_read_buffer );
@@ -3161,6 +5333,18 @@ int main(
 	 "libvsgpt_partition_get_size",
 	 vsgpt_test_partition_get_size );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_get_cache_statistics",
+	 vsgpt_test_partition_get_cache_statistics );
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_read_buffer_at_offset_threaded",
+	 vsgpt_test_partition_read_buffer_at_offset_threaded );
+
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
 	/* Clean up
 	 */
 	result = libvsgpt_partition_free(
@@ -0,0 +1,935 @@
+/*
+ * Library partition comparison type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_partition_comparison.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+typedef struct vsgpt_test_partition_comparison_ranges vsgpt_test_partition_comparison_ranges_t;
+
+struct vsgpt_test_partition_comparison_ranges
+{
+	/* The offsets of the ranges
+	 */
+	off64_t offsets[ 8 ];
+
+	/* The sizes of the ranges
+	 */
+	size64_t sizes[ 8 ];
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+};
+
+uint8_t vsgpt_test_partition_comparison_data[ 16384 ];
+
+uint8_t vsgpt_test_partition_comparison_compare_data[ 16384 ];
+
+/* Callback function that stores the ranges of differing data
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_partition_comparison_range_callback(
+     int partition_index VSGPT_TEST_ATTRIBUTE_UNUSED,
+     int compare_partition_index VSGPT_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset,
+     size64_t size,
+     void *user_data,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	vsgpt_test_partition_comparison_ranges_t *ranges = NULL;
+
+	VSGPT_TEST_UNREFERENCED_PARAMETER( partition_index )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( compare_partition_index )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	ranges = (vsgpt_test_partition_comparison_ranges_t *) user_data;
+
+	if( ranges->number_of_ranges >= 8 )
+	{
+		return( -1 );
+	}
+	ranges->offsets[ ranges->number_of_ranges ] = offset;
+	ranges->sizes[ ranges->number_of_ranges ]   = size;
+
+	ranges->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Tests the libvsgpt_partition_comparison_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_comparison_initialize(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libvsgpt_partition_comparison_t *partition_comparison = NULL;
+	int result                                            = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                       = 1;
+	int test_number                                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_comparison",
+	 partition_comparison );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_comparison_free(
+	          &partition_comparison,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_comparison",
+	 partition_comparison );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_comparison_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition_comparison = (libvsgpt_partition_comparison_t *) 0x12345678UL;
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	partition_comparison = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          -1,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          32768,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          NULL,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_partition_comparison_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_partition_comparison_initialize(
+		          &partition_comparison,
+		          NULL,
+		          NULL,
+		          NULL,
+		          0,
+		          NULL,
+		          NULL,
+		          0,
+		          16384,
+		          4096,
+		          &vsgpt_test_partition_comparison_range_callback,
+		          NULL,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( partition_comparison != NULL )
+			{
+				libvsgpt_partition_comparison_free(
+				 &partition_comparison,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "partition_comparison",
+			 partition_comparison );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_comparison != NULL )
+	{
+		libvsgpt_partition_comparison_free(
+		 &partition_comparison,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_comparison_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_comparison_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_comparison_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_comparison_get_next_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_comparison_get_next_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison )
+{
+	libcerror_error_t *error    = NULL;
+	size_t chunk_size           = 0;
+	off64_t chunk_offset        = 0;
+	int compare_partition_index = 0;
+	int partition_index         = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_comparison_get_next_chunk(
+	          partition_comparison,
+	          &partition_index,
+	          &compare_partition_index,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_comparison_get_next_chunk(
+	          NULL,
+	          &partition_index,
+	          &compare_partition_index,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_get_next_chunk(
+	          partition_comparison,
+	          &partition_index,
+	          NULL,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_comparison_compare_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_comparison_compare_chunk(
+     libvsgpt_partition_comparison_t *partition_comparison )
+{
+	vsgpt_test_partition_comparison_ranges_t ranges;
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		vsgpt_test_partition_comparison_data[ data_offset ]         = (uint8_t) ( data_offset % 251 );
+		vsgpt_test_partition_comparison_compare_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	ranges.number_of_ranges = 0;
+
+	partition_comparison->user_data = (void *) &ranges;
+
+	/* Test equal data
+	 */
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          65536,
+	          vsgpt_test_partition_comparison_data,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "ranges.number_of_ranges",
+	 ranges.number_of_ranges,
+	 0 );
+
+	/* Test differing data within a block and differing data that spans
+	 * the boundary of 2 blocks
+	 */
+	vsgpt_test_partition_comparison_compare_data[ 10 ]    ^= 0xff;
+	vsgpt_test_partition_comparison_compare_data[ 12 ]    ^= 0xff;
+	vsgpt_test_partition_comparison_compare_data[ 12287 ] ^= 0xff;
+	vsgpt_test_partition_comparison_compare_data[ 12288 ] ^= 0xff;
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          65536,
+	          vsgpt_test_partition_comparison_data,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "ranges.number_of_ranges",
+	 ranges.number_of_ranges,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "ranges.offsets[ 0 ]",
+	 (int64_t) ranges.offsets[ 0 ],
+	 (int64_t) 65546 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "ranges.sizes[ 0 ]",
+	 (uint64_t) ranges.sizes[ 0 ],
+	 (uint64_t) 3 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "ranges.offsets[ 1 ]",
+	 (int64_t) ranges.offsets[ 1 ],
+	 (int64_t) 77823 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "ranges.sizes[ 1 ]",
+	 (uint64_t) ranges.sizes[ 1 ],
+	 (uint64_t) 2 );
+
+	/* Test differing data at the end of the chunk
+	 */
+	ranges.number_of_ranges = 0;
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          0,
+	          &( vsgpt_test_partition_comparison_data[ 8192 ] ),
+	          &( vsgpt_test_partition_comparison_compare_data[ 8192 ] ),
+	          4097,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "ranges.number_of_ranges",
+	 ranges.number_of_ranges,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "ranges.offsets[ 0 ]",
+	 (int64_t) ranges.offsets[ 0 ],
+	 (int64_t) 4095 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "ranges.sizes[ 0 ]",
+	 (uint64_t) ranges.sizes[ 0 ],
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          vsgpt_test_partition_comparison_data,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          0,
+	          NULL,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          0,
+	          vsgpt_test_partition_comparison_data,
+	          NULL,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          -1,
+	          vsgpt_test_partition_comparison_data,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a failing callback
+	 */
+	partition_comparison->user_data = NULL;
+
+	result = libvsgpt_partition_comparison_compare_chunk(
+	          partition_comparison,
+	          0,
+	          0,
+	          0,
+	          vsgpt_test_partition_comparison_data,
+	          vsgpt_test_partition_comparison_compare_data,
+	          16384,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	partition_comparison->user_data = NULL;
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	libcerror_error_t *error                              = NULL;
+	libvsgpt_partition_comparison_t *partition_comparison = NULL;
+	int result                                            = 0;
+#endif
+
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_comparison_initialize",
+	 vsgpt_test_partition_comparison_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_comparison_free",
+	 vsgpt_test_partition_comparison_free );
+
+	/* Initialize partition comparison for tests
+	 */
+	result = libvsgpt_partition_comparison_initialize(
+	          &partition_comparison,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          0,
+	          16384,
+	          4096,
+	          &vsgpt_test_partition_comparison_range_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_comparison",
+	 partition_comparison );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_comparison_get_next_chunk",
+	 vsgpt_test_partition_comparison_get_next_chunk,
+	 partition_comparison );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_comparison_compare_chunk",
+	 vsgpt_test_partition_comparison_compare_chunk,
+	 partition_comparison );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_comparison_free(
+	          &partition_comparison,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_comparison",
+	 partition_comparison );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_comparison != NULL )
+	{
+		libvsgpt_partition_comparison_free(
+		 &partition_comparison,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
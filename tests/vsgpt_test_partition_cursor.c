@@ -0,0 +1,970 @@
+/*
+ * Library partition_cursor type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_partition.h"
+#include "../libvsgpt/libvsgpt_partition_cursor.h"
+#include "../libvsgpt/libvsgpt_partition_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+uint8_t vsgpt_test_partition_cursor_data[ 2048 ];
+
+/* Tests the libvsgpt_partition_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_initialize(
+     libvsgpt_partition_t *partition )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_cursor_t *partition_cursor = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_cursor_initialize(
+	          &partition_cursor,
+	          partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_cursor",
+	 partition_cursor );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_cursor_free(
+	          &partition_cursor,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_cursor",
+	 partition_cursor );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_cursor_initialize(
+	          NULL,
+	          partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition_cursor = (libvsgpt_partition_cursor_t *) 0x12345678UL;
+
+	result = libvsgpt_partition_cursor_initialize(
+	          &partition_cursor,
+	          partition,
+	          &error );
+
+	partition_cursor = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_cursor_initialize(
+	          &partition_cursor,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_partition_cursor_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_partition_cursor_initialize(
+		          &partition_cursor,
+		          partition,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( partition_cursor != NULL )
+			{
+				libvsgpt_partition_cursor_free(
+				 &partition_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "partition_cursor",
+			 partition_cursor );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_partition_cursor_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_partition_cursor_initialize(
+		          &partition_cursor,
+		          partition,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( partition_cursor != NULL )
+			{
+				libvsgpt_partition_cursor_free(
+				 &partition_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "partition_cursor",
+			 partition_cursor );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_cursor != NULL )
+	{
+		libvsgpt_partition_cursor_free(
+		 &partition_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_cursor_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_cursor_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_read_buffer(
+     libvsgpt_partition_cursor_t *partition_cursor )
+{
+	uint8_t buffer[ 2048 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              partition_cursor,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              partition_cursor,
+	              buffer,
+	              2048,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 2 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read beyond the end of the partition
+	 */
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              partition_cursor,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              NULL,
+	              buffer,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              partition_cursor,
+	              NULL,
+	              512,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_partition_cursor_read_buffer(
+	              partition_cursor,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_cursor_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_read_buffer_at_offset(
+     libvsgpt_partition_cursor_t *partition_cursor )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	read_count = libvsgpt_partition_cursor_read_buffer_at_offset(
+	              partition_cursor,
+	              buffer,
+	              256,
+	              768,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 2 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_cursor_get_offset(
+	          partition_cursor,
+	          &offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_partition_cursor_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_partition_cursor_read_buffer_at_offset(
+	              partition_cursor,
+	              buffer,
+	              512,
+	              -1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_cursor_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_seek_offset(
+     libvsgpt_partition_cursor_t *partition_cursor )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          -512,
+	          SEEK_CUR,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libvsgpt_partition_cursor_seek_offset(
+	          partition_cursor,
+	          0,
+	          -1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_cursor_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_cursor_get_offset(
+     libvsgpt_partition_cursor_t *partition_cursor )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_cursor_get_offset(
+	          partition_cursor,
+	          &offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_cursor_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_cursor_get_offset(
+	          partition_cursor,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	libcerror_error_t *error                      = NULL;
+	libvsgpt_partition_t *partition               = NULL;
+	libvsgpt_partition_cursor_t *partition_cursor = NULL;
+	libvsgpt_partition_values_t *partition_values = NULL;
+	size_t data_offset                            = 0;
+	int result                                    = 0;
+#endif
+
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		vsgpt_test_partition_cursor_data[ data_offset ] = (uint8_t) ( data_offset / 512 );
+	}
+	result = libvsgpt_partition_values_initialize(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	partition_values->offset = 512;
+	partition_values->size   = 1024;
+
+	result = libvsgpt_partition_initialize(
+	          &partition,
+	          NULL,
+	          NULL,
+	          vsgpt_test_partition_cursor_data,
+	          2048,
+	          partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_cursor_initialize",
+	 vsgpt_test_partition_cursor_initialize,
+	 partition );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_cursor_free",
+	 vsgpt_test_partition_cursor_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	result = libvsgpt_partition_cursor_initialize(
+	          &partition_cursor,
+	          partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_cursor",
+	 partition_cursor );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_cursor_read_buffer",
+	 vsgpt_test_partition_cursor_read_buffer,
+	 partition_cursor );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_cursor_read_buffer_at_offset",
+	 vsgpt_test_partition_cursor_read_buffer_at_offset,
+	 partition_cursor );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_cursor_seek_offset",
+	 vsgpt_test_partition_cursor_seek_offset,
+	 partition_cursor );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_partition_cursor_get_offset",
+	 vsgpt_test_partition_cursor_get_offset,
+	 partition_cursor );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_cursor_free(
+	          &partition_cursor,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_cursor",
+	 partition_cursor );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_free(
+	          &partition_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values",
+	 partition_values );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_cursor != NULL )
+	{
+		libvsgpt_partition_cursor_free(
+		 &partition_cursor,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_values != NULL )
+	{
+		libvsgpt_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
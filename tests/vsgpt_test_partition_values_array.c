@@ -0,0 +1,771 @@
+/*
+ * Library partition_values_array type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_partition_values.h"
+#include "../libvsgpt/libvsgpt_partition_values_array.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Tests the libvsgpt_partition_values_array_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_values_array_initialize(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libvsgpt_partition_values_array_t *partition_values_array = NULL;
+	int result                                                = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                           = 1;
+	int number_of_memset_fail_tests                           = 1;
+	int test_number                                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_values_array_initialize(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_free(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_values_array_initialize(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition_values_array = (libvsgpt_partition_values_array_t *) 0x12345678UL;
+
+	result = libvsgpt_partition_values_array_initialize(
+	          &partition_values_array,
+	          &error );
+
+	partition_values_array = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_partition_values_array_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_partition_values_array_initialize(
+		          &partition_values_array,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( partition_values_array != NULL )
+			{
+				libvsgpt_partition_values_array_free(
+				 &partition_values_array,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "partition_values_array",
+			 partition_values_array );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_partition_values_array_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_partition_values_array_initialize(
+		          &partition_values_array,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( partition_values_array != NULL )
+			{
+				libvsgpt_partition_values_array_free(
+				 &partition_values_array,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "partition_values_array",
+			 partition_values_array );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_values_array != NULL )
+	{
+		libvsgpt_partition_values_array_free(
+		 &partition_values_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_values_array_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_values_array_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_values_array_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_values_array_append_values function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_values_array_append_values(
+     void )
+{
+	libvsgpt_partition_values_t partition_values;
+
+	libcerror_error_t *error                                  = NULL;
+	libvsgpt_partition_values_array_t *partition_values_array = NULL;
+	int number_of_values                                      = 0;
+	int result                                                = 0;
+	int values_index                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_array_initialize(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &partition_values,
+	          0,
+	          sizeof( libvsgpt_partition_values_t ) ) != NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( values_index = 0;
+	     values_index < 40;
+	     values_index++ )
+	{
+		partition_values.entry_index = (uint32_t) ( values_index * 2 );
+		partition_values.offset      = (off64_t) ( values_index + 1 ) * 1048576;
+		partition_values.size        = 1048576;
+
+		result = libvsgpt_partition_values_array_append_values(
+		          partition_values_array,
+		          &partition_values,
+		          &number_of_values,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 values_index );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_values_array->number_of_values",
+	 partition_values_array->number_of_values,
+	 40 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "partition_values_array->offsets[ 39 ]",
+	 (int64_t) partition_values_array->offsets[ 39 ],
+	 (int64_t) 41943040 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "partition_values_array->entry_indexes[ 39 ]",
+	 partition_values_array->entry_indexes[ 39 ],
+	 (uint32_t) 78 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_values_array_append_values(
+	          NULL,
+	          &partition_values,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_values_array_append_values(
+	          partition_values_array,
+	          NULL,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_values_array_append_values(
+	          partition_values_array,
+	          &partition_values,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_values_array_free(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_values_array != NULL )
+	{
+		libvsgpt_partition_values_array_free(
+		 &partition_values_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_partition_values_array_get_values_by_index and libvsgpt_partition_values_array_get_index_by_entry_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_partition_values_array_get_values_by_index(
+     void )
+{
+	libvsgpt_partition_values_t partition_values;
+
+	libcerror_error_t *error                                  = NULL;
+	libvsgpt_partition_values_array_t *partition_values_array = NULL;
+	libvsgpt_partition_values_t *values                       = NULL;
+	int number_of_values                                      = 0;
+	int result                                                = 0;
+	int values_index                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_partition_values_array_initialize(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_resize(
+	          partition_values_array,
+	          4,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &partition_values,
+	          0,
+	          sizeof( libvsgpt_partition_values_t ) ) != NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	partition_values.entry_index = 5;
+	partition_values.offset      = 1048576;
+	partition_values.size        = 2097152;
+
+	result = libvsgpt_partition_values_array_append_values(
+	          partition_values_array,
+	          &partition_values,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_partition_values_array_get_number_of_values(
+	          partition_values_array,
+	          &number_of_values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_get_values_by_index(
+	          partition_values_array,
+	          0,
+	          &values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "values->offset",
+	 (int64_t) values->offset,
+	 (int64_t) 1048576 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "values->size",
+	 (uint64_t) values->size,
+	 (uint64_t) 2097152 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	values_index = -1;
+
+	result = libvsgpt_partition_values_array_get_index_by_entry_index(
+	          partition_values_array,
+	          5,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "values_index",
+	 values_index,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_values_array_get_index_by_entry_index(
+	          partition_values_array,
+	          6,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_partition_values_array_get_values_by_index(
+	          NULL,
+	          0,
+	          &values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_values_array_get_values_by_index(
+	          partition_values_array,
+	          1,
+	          &values,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_values_array_get_values_by_index(
+	          partition_values_array,
+	          0,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_partition_values_array_get_index_by_entry_index(
+	          NULL,
+	          5,
+	          &values_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_values_array_free(
+	          &partition_values_array,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition_values_array",
+	 partition_values_array );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_values_array != NULL )
+	{
+		libvsgpt_partition_values_array_free(
+		 &partition_values_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_values_array_initialize",
+	 vsgpt_test_partition_values_array_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_values_array_free",
+	 vsgpt_test_partition_values_array_free );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_values_array_append_values",
+	 vsgpt_test_partition_values_array_append_values );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_partition_values_array_get_values_by_index",
+	 vsgpt_test_partition_values_array_get_values_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1338 @@
+/*
+ * Library sector_cache type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_functions.h"
+#include "vsgpt_test_libbfio.h"
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_libvsgpt.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_rwlock.h"
+#include "vsgpt_test_unused.h"
+
+#include "../libvsgpt/libvsgpt_io_trace.h"
+#include "../libvsgpt/libvsgpt_libcthreads.h"
+#include "../libvsgpt/libvsgpt_sector_cache.h"
+
+#define VSGPT_TEST_SECTOR_CACHE_DATA_SIZE		65536
+#define VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS	64
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+uint8_t vsgpt_test_sector_cache_data[ VSGPT_TEST_SECTOR_CACHE_DATA_SIZE ];
+
+/* Tests the libvsgpt_sector_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvsgpt_sector_cache_t *sector_cache = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          512,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_sector_cache_initialize(
+	          NULL,
+	          512,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sector_cache = (libvsgpt_sector_cache_t *) 0x12345678UL;
+
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          512,
+	          4096,
+	          512,
+	          &error );
+
+	sector_cache = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          -1,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          512,
+	          (size64_t) INT64_MAX + 1,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          512,
+	          4096,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_sector_cache_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsgpt_sector_cache_initialize(
+		          &sector_cache,
+		          512,
+		          4096,
+		          512,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( sector_cache != NULL )
+			{
+				libvsgpt_sector_cache_free(
+				 &sector_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "sector_cache",
+			 sector_cache );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsgpt_sector_cache_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = libvsgpt_sector_cache_initialize(
+		          &sector_cache,
+		          512,
+		          4096,
+		          512,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( sector_cache != NULL )
+			{
+				libvsgpt_sector_cache_free(
+				 &sector_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "sector_cache",
+			 sector_cache );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_sector_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_sector_cache_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_sector_cache_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_read_buffer_at_offset(
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t buffer[ 1024 ];
+
+	libcerror_error_t *error              = NULL;
+	libvsgpt_sector_cache_t *sector_cache = NULL;
+	ssize_t read_count                    = 0;
+	int number_of_reads                   = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          512,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              1024,
+	              256,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsgpt_test_sector_cache_data[ 768 ] ),
+	          256 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read of a cached sector
+	 */
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsgpt_test_sector_cache_data[ 512 ] ),
+	          16 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsgpt_sector_cache_get_number_of_reads(
+	          sector_cache,
+	          &number_of_reads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read beyond the end of the data
+	 */
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              4096,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              NULL,
+	              512,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              -1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a read of an uncached sector without a file IO handle
+	 */
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              NULL,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_sector_cache_read_buffer_at_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_sector_cache_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              2048,
+	              &error );
+
+	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libvsgpt_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_sector_cache_get_number_of_reads function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_get_number_of_reads(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvsgpt_sector_cache_t *sector_cache = NULL;
+	int number_of_reads                   = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          0,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_sector_cache_get_number_of_reads(
+	          sector_cache,
+	          &number_of_reads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_sector_cache_get_number_of_reads(
+	          NULL,
+	          &number_of_reads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_sector_cache_get_number_of_reads(
+	          sector_cache,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_sector_cache_get_number_of_deduplicated_misses function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_get_number_of_deduplicated_misses(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvsgpt_sector_cache_t *sector_cache = NULL;
+	int number_of_deduplicated_misses     = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_sector_cache_initialize(
+	          &sector_cache,
+	          0,
+	          4096,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+	          sector_cache,
+	          &number_of_deduplicated_misses,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_deduplicated_misses",
+	 number_of_deduplicated_misses,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+	          NULL,
+	          &number_of_deduplicated_misses,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+	          sector_cache,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+typedef struct vsgpt_test_sector_cache_thread_values vsgpt_test_sector_cache_thread_values_t;
+
+struct vsgpt_test_sector_cache_thread_values
+{
+	/* The sector cache
+	 */
+	libvsgpt_sector_cache_t *sector_cache;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The index of the thread
+	 */
+	int thread_index;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Reads the data several times in sector sized reads
+ * Callback function for the sector cache threads
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_sector_cache_read_thread(
+     vsgpt_test_sector_cache_thread_values_t *thread_values )
+{
+	uint8_t buffer[ 512 ];
+
+	ssize_t read_count = 0;
+	off64_t offset     = 0;
+	int iteration      = 0;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	thread_values->result = 1;
+
+	for( iteration = 0;
+	     iteration < 16;
+	     iteration++ )
+	{
+		/* Start every thread at a different sector to spread them over the shards
+		 */
+		offset = (off64_t) thread_values->thread_index * 512;
+
+		do
+		{
+			read_count = libvsgpt_sector_cache_read_buffer_at_offset(
+			              thread_values->sector_cache,
+			              thread_values->file_io_handle,
+			              buffer,
+			              512,
+			              offset,
+			              NULL );
+
+			if( read_count != 512 )
+			{
+				thread_values->result = 0;
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     buffer,
+			     &( vsgpt_test_sector_cache_data[ offset ] ),
+			     512 ) != 0 )
+			{
+				thread_values->result = 0;
+
+				return( -1 );
+			}
+			offset = ( offset + 512 ) % VSGPT_TEST_SECTOR_CACHE_DATA_SIZE;
+		}
+		while( offset != ( (off64_t) thread_values->thread_index * 512 ) );
+	}
+	return( 1 );
+}
+
+/* Tests the libvsgpt_sector_cache_read_buffer_at_offset function with 1 to 64 threads
+ * The duration per number of threads is printed to show how the cache scales
+ * if the VSGPT_TEST_BENCHMARK environment variable is set
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_sector_cache_read_buffer_at_offset_threaded(
+     libbfio_handle_t *file_io_handle )
+{
+	libcthreads_thread_t *threads[ VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS ];
+	vsgpt_test_sector_cache_thread_values_t thread_values[ VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error              = NULL;
+	libvsgpt_sector_cache_t *sector_cache = NULL;
+	int64_t duration                      = 0;
+	int number_of_deduplicated_misses     = 0;
+	int number_of_reads                   = 0;
+	int number_of_threads                 = 0;
+	int print_timings                     = 0;
+	int result                            = 0;
+	int thread_index                      = 0;
+
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	print_timings = ( getenv( "VSGPT_TEST_BENCHMARK" ) != NULL );
+
+	for( number_of_threads = 1;
+	     number_of_threads <= VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS;
+	     number_of_threads *= 2 )
+	{
+		result = libvsgpt_sector_cache_initialize(
+		          &sector_cache,
+		          0,
+		          VSGPT_TEST_SECTOR_CACHE_DATA_SIZE,
+		          512,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		duration = libvsgpt_io_trace_get_current_time();
+
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			thread_values[ thread_index ].sector_cache   = sector_cache;
+			thread_values[ thread_index ].file_io_handle = file_io_handle;
+			thread_values[ thread_index ].thread_index   = thread_index;
+			thread_values[ thread_index ].result         = 0;
+
+			result = libcthreads_thread_create(
+			          &( threads[ thread_index ] ),
+			          NULL,
+			          (int (*)(void *)) &vsgpt_test_sector_cache_read_thread,
+			          (void *) &( thread_values[ thread_index ] ),
+			          &error );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			result = libcthreads_thread_join(
+			          &( threads[ thread_index ] ),
+			          &error );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "thread_values[ thread_index ].result",
+			 thread_values[ thread_index ].result,
+			 1 );
+		}
+		duration = libvsgpt_io_trace_get_current_time() - duration;
+
+		/* Every sector is read once regardless of the number of threads
+		 */
+		result = libvsgpt_sector_cache_get_number_of_reads(
+		          sector_cache,
+		          &number_of_reads,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_reads",
+		 number_of_reads,
+		 VSGPT_TEST_SECTOR_CACHE_DATA_SIZE / 512 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_sector_cache_get_number_of_deduplicated_misses(
+		          sector_cache,
+		          &number_of_deduplicated_misses,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( print_timings != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "\t%d thread(s): %" PRIi64 " microseconds, %d deduplicated misses\n",
+			 number_of_threads,
+			 duration,
+			 number_of_deduplicated_misses );
+		}
+
+		result = libvsgpt_sector_cache_free(
+		          &sector_cache,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < VSGPT_TEST_SECTOR_CACHE_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( sector_cache != NULL )
+	{
+		libvsgpt_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	int result                       = 0;
+#endif
+
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_sector_cache_initialize",
+	 vsgpt_test_sector_cache_initialize );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_sector_cache_free",
+	 vsgpt_test_sector_cache_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < VSGPT_TEST_SECTOR_CACHE_DATA_SIZE;
+	     data_offset++ )
+	{
+		vsgpt_test_sector_cache_data[ data_offset ] = (uint8_t) ( ( data_offset / 512 ) + data_offset );
+	}
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsgpt_test_sector_cache_data,
+	          VSGPT_TEST_SECTOR_CACHE_DATA_SIZE,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_sector_cache_read_buffer_at_offset",
+	 vsgpt_test_sector_cache_read_buffer_at_offset,
+	 file_io_handle );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_sector_cache_get_number_of_reads",
+	 vsgpt_test_sector_cache_get_number_of_reads );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_sector_cache_get_number_of_deduplicated_misses",
+	 vsgpt_test_sector_cache_get_number_of_deduplicated_misses );
+
+#if defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT )
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_sector_cache_read_buffer_at_offset with threads",
+	 vsgpt_test_sector_cache_read_buffer_at_offset_threaded,
+	 file_io_handle );
+
+#endif /* defined( HAVE_LIBVSGPT_MULTI_THREAD_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+}
+
@@ -46,6 +46,13 @@ int libvsgpt_check_volume_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_check_volume_signatures_file_io_handles(
+     libbfio_handle_t **file_io_handles,
+     int number_of_file_io_handles,
+     int *results,
+     libcerror_error_t **error );
+
 #endif /* !defined( LIBVSGPT_HAVE_BFIO ) */
 
 /* Tests the libvsgpt_get_version function
@@ -363,6 +370,135 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvsgpt_check_volume_signatures function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_check_volume_signatures(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	int results[ 2 ];
+
+	const char *filenames[ 2 ] = { NULL, NULL };
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = vsgpt_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test check volume signatures
+		 */
+		filenames[ 0 ] = narrow_source;
+		filenames[ 1 ] = "";
+
+		result = libvsgpt_check_volume_signatures(
+		          filenames,
+		          2,
+		          results,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "results[ 0 ]",
+		 results[ 0 ],
+		 1 );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "results[ 1 ]",
+		 results[ 1 ],
+		 -1 );
+	}
+	/* Test error cases
+	 */
+	result = libvsgpt_check_volume_signatures(
+	          NULL,
+	          2,
+	          results,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_check_volume_signatures(
+	          filenames,
+	          0,
+	          results,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_check_volume_signatures(
+	          filenames,
+	          2,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Tests the libvsgpt_check_volume_signature_wide function
@@ -755,6 +891,236 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvsgpt_check_volume_signatures_file_io_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_check_volume_signatures_file_io_handles(
+     void )
+{
+	uint8_t empty_block[ 8192 ];
+	uint8_t signature_block_512[ 8192 ];
+	uint8_t signature_block_4096[ 8192 ];
+	int results[ 3 ];
+
+	libbfio_handle_t *file_io_handles[ 3 ] = { NULL, NULL, NULL };
+	libcerror_error_t *error               = NULL;
+	void *memset_result                    = NULL;
+	int file_io_handle_index               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 signature_block_512,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 signature_block_4096,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memory_copy(
+	 &( signature_block_512[ 512 ] ),
+	 "EFI PART",
+	 8 );
+
+	memory_copy(
+	 &( signature_block_4096[ 4096 ] ),
+	 "EFI PART",
+	 8 );
+
+	result = vsgpt_test_open_file_io_handle(
+	          &( file_io_handles[ 0 ] ),
+	          signature_block_512,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_open_file_io_handle(
+	          &( file_io_handles[ 1 ] ),
+	          empty_block,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_open_file_io_handle(
+	          &( file_io_handles[ 2 ] ),
+	          signature_block_4096,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check volume signatures
+	 */
+	result = libvsgpt_check_volume_signatures_file_io_handles(
+	          file_io_handles,
+	          3,
+	          results,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "results[ 0 ]",
+	 results[ 0 ],
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "results[ 1 ]",
+	 results[ 1 ],
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "results[ 2 ]",
+	 results[ 2 ],
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_check_volume_signatures_file_io_handles(
+	          NULL,
+	          3,
+	          results,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_check_volume_signatures_file_io_handles(
+	          file_io_handles,
+	          0,
+	          results,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_check_volume_signatures_file_io_handles(
+	          file_io_handles,
+	          3,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < 3;
+	     file_io_handle_index++ )
+	{
+		result = vsgpt_test_close_file_io_handle(
+		          &( file_io_handles[ file_io_handle_index ] ),
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < 3;
+	     file_io_handle_index++ )
+	{
+		if( file_io_handles[ file_io_handle_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ file_io_handle_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -822,6 +1188,11 @@ int main(
 	 vsgpt_test_check_volume_signature,
 	 source );
 
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "libvsgpt_check_volume_signatures",
+	 vsgpt_test_check_volume_signatures,
+	 source );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 	VSGPT_TEST_RUN_WITH_ARGS(
@@ -836,6 +1207,10 @@ int main(
 	 vsgpt_test_check_volume_signature_file_io_handle,
 	 source );
 
+	VSGPT_TEST_RUN(
+	 "libvsgpt_check_volume_signatures_file_io_handles",
+	 vsgpt_test_check_volume_signatures_file_io_handles );
+
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,532 @@
+/*
+ * Tools benchmark_handle type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/benchmark_handle.h"
+
+/* Tests the benchmark_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_benchmark_handle_initialize(
+     void )
+{
+	benchmark_handle_t *benchmark_handle = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 2;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = benchmark_handle_initialize(
+	          &benchmark_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "benchmark_handle",
+	 benchmark_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = benchmark_handle_free(
+	          &benchmark_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "benchmark_handle",
+	 benchmark_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = benchmark_handle_initialize(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	benchmark_handle = (benchmark_handle_t *) 0x12345678UL;
+
+	result = benchmark_handle_initialize(
+	          &benchmark_handle,
+	          &error );
+
+	benchmark_handle = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test benchmark_handle_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = benchmark_handle_initialize(
+		          &benchmark_handle,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( benchmark_handle != NULL )
+			{
+				benchmark_handle_free(
+				 &benchmark_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "benchmark_handle",
+			 benchmark_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test benchmark_handle_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = benchmark_handle_initialize(
+		          &benchmark_handle,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( benchmark_handle != NULL )
+			{
+				benchmark_handle_free(
+				 &benchmark_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "benchmark_handle",
+			 benchmark_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( benchmark_handle != NULL )
+	{
+		benchmark_handle_free(
+		 &benchmark_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the benchmark_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_benchmark_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = benchmark_handle_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the benchmark_handle_get_access_type_description function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_benchmark_handle_get_access_type_description(
+     void )
+{
+	const char *description = NULL;
+	int result              = 0;
+
+	/* Test regular cases
+	 */
+	description = benchmark_handle_get_access_type_description(
+	               BENCHMARK_ACCESS_TYPE_RANDOM );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "description",
+	 description );
+
+	result = narrow_string_compare(
+	          description,
+	          "random",
+	          7 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	description = benchmark_handle_get_access_type_description(
+	               -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "description",
+	 description );
+
+	result = narrow_string_compare(
+	          description,
+	          "unknown",
+	          8 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the benchmark_handle_get_number_of_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_benchmark_handle_get_number_of_sectors(
+     void )
+{
+	uint64_t number_of_sectors = 0;
+
+	/* Test regular cases
+	 */
+	number_of_sectors = benchmark_handle_get_number_of_sectors(
+	                     0,
+	                     4096,
+	                     512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 8 );
+
+	number_of_sectors = benchmark_handle_get_number_of_sectors(
+	                     511,
+	                     2,
+	                     512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	number_of_sectors = benchmark_handle_get_number_of_sectors(
+	                     0,
+	                     4096,
+	                     0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 0 );
+
+	number_of_sectors = benchmark_handle_get_number_of_sectors(
+	                     -1,
+	                     4096,
+	                     512 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the benchmark_handle_get_random_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_benchmark_handle_get_random_offset(
+     void )
+{
+	benchmark_handle_t *benchmark_handle = NULL;
+	libcerror_error_t *error             = NULL;
+	off64_t offset                       = 0;
+	int offset_index                     = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = benchmark_handle_initialize(
+	          &benchmark_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "benchmark_handle",
+	 benchmark_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( offset_index = 0;
+	     offset_index < 64;
+	     offset_index++ )
+	{
+		offset = benchmark_handle_get_random_offset(
+		          benchmark_handle,
+		          1048576 + 100,
+		          4096 );
+
+		VSGPT_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		VSGPT_TEST_ASSERT_LESS_THAN_UINT64(
+		 "offset",
+		 (uint64_t) offset,
+		 (uint64_t) 1048576 );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT64(
+		 "offset % 4096",
+		 (int64_t) ( offset % 4096 ),
+		 (int64_t) 0 );
+	}
+	/* Test error cases
+	 */
+	offset = benchmark_handle_get_random_offset(
+	          benchmark_handle,
+	          4095,
+	          4096 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	offset = benchmark_handle_get_random_offset(
+	          NULL,
+	          1048576,
+	          4096 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	/* Clean up
+	 */
+	result = benchmark_handle_free(
+	          &benchmark_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( benchmark_handle != NULL )
+	{
+		benchmark_handle_free(
+		 &benchmark_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "benchmark_handle_initialize",
+	 vsgpt_test_tools_benchmark_handle_initialize );
+
+	VSGPT_TEST_RUN(
+	 "benchmark_handle_free",
+	 vsgpt_test_tools_benchmark_handle_free );
+
+	VSGPT_TEST_RUN(
+	 "benchmark_handle_get_access_type_description",
+	 vsgpt_test_tools_benchmark_handle_get_access_type_description );
+
+	VSGPT_TEST_RUN(
+	 "benchmark_handle_get_number_of_sectors",
+	 vsgpt_test_tools_benchmark_handle_get_number_of_sectors );
+
+	VSGPT_TEST_RUN(
+	 "benchmark_handle_get_random_offset",
+	 vsgpt_test_tools_benchmark_handle_get_random_offset );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,183 @@
+/*
+ * Tools checksum functions test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/vsgpttools_checksum.h"
+
+/* Tests the vsgpttools_checksum_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_checksum_calculate_crc32(
+     void )
+{
+	uint8_t data[ 9 ]        = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	libcerror_error_t *error = NULL;
+	uint32_t crc32           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = vsgpttools_checksum_calculate_crc32(
+	          &crc32,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the CRC-32 can be calculated in parts
+	 */
+	result = vsgpttools_checksum_calculate_crc32(
+	          &crc32,
+	          data,
+	          4,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpttools_checksum_calculate_crc32(
+	          &crc32,
+	          &( data[ 4 ] ),
+	          5,
+	          crc32,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = vsgpttools_checksum_calculate_crc32(
+	          NULL,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = vsgpttools_checksum_calculate_crc32(
+	          &crc32,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "vsgpttools_checksum_calculate_crc32",
+	 vsgpt_test_tools_checksum_calculate_crc32 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,912 @@
+/*
+ * Tools diff_handle type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/diff_handle.h"
+
+/* Tests the diff_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_diff_handle_initialize(
+     void )
+{
+	diff_handle_t *diff_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = diff_handle_free(
+	          &diff_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = diff_handle_initialize(
+	          NULL,
+	          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	diff_handle = (diff_handle_t *) 0x12345678UL;
+
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	          &error );
+
+	diff_handle = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          DIFF_HANDLE_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test diff_handle_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = diff_handle_initialize(
+		          &diff_handle,
+		          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( diff_handle != NULL )
+			{
+				diff_handle_free(
+				 &diff_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "diff_handle",
+			 diff_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test diff_handle_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = diff_handle_initialize(
+		          &diff_handle,
+		          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( diff_handle != NULL )
+			{
+				diff_handle_free(
+				 &diff_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "diff_handle",
+			 diff_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff_handle != NULL )
+	{
+		diff_handle_free(
+		 &diff_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the diff_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_diff_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = diff_handle_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the diff_handle_parse_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_diff_handle_parse_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 16 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = diff_handle_parse_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "4x" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "0" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "99999999999" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the diff_handle_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_diff_handle_append_range(
+     void )
+{
+	diff_handle_t *diff_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          100,
+	          10,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending a range before an existing range
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          0,
+	          10,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending a range adjacent to an existing range
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          110,
+	          5,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->number_of_ranges",
+	 diff_handle->number_of_ranges,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "diff_handle->ranges[ 0 ].offset",
+	 (int64_t) diff_handle->ranges[ 0 ].offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "diff_handle->ranges[ 0 ].size",
+	 diff_handle->ranges[ 0 ].size,
+	 (uint64_t) 10 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "diff_handle->ranges[ 1 ].offset",
+	 (int64_t) diff_handle->ranges[ 1 ].offset,
+	 (int64_t) 100 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "diff_handle->ranges[ 1 ].size",
+	 diff_handle->ranges[ 1 ].size,
+	 (uint64_t) 15 );
+
+	/* Test appending a range that overlaps with both existing ranges
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          5,
+	          100,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->number_of_ranges",
+	 diff_handle->number_of_ranges,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "diff_handle->ranges[ 0 ].offset",
+	 (int64_t) diff_handle->ranges[ 0 ].offset,
+	 (int64_t) 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "diff_handle->ranges[ 0 ].size",
+	 diff_handle->ranges[ 0 ].size,
+	 (uint64_t) 115 );
+
+	/* Test appending ranges of other partitions
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          1,
+	          1,
+	          0,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = diff_handle_append_range(
+	          diff_handle,
+	          -1,
+	          2,
+	          0,
+	          1024,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->number_of_ranges",
+	 diff_handle->number_of_ranges,
+	 3 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->ranges[ 0 ].partition_index",
+	 diff_handle->ranges[ 0 ].partition_index,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->ranges[ 0 ].compare_partition_index",
+	 diff_handle->ranges[ 0 ].compare_partition_index,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->ranges[ 1 ].partition_index",
+	 diff_handle->ranges[ 1 ].partition_index,
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->ranges[ 2 ].partition_index",
+	 diff_handle->ranges[ 2 ].partition_index,
+	 1 );
+
+	/* Test appending an empty range
+	 */
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->number_of_ranges",
+	 diff_handle->number_of_ranges,
+	 3 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = diff_handle_append_range(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          10,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = diff_handle_append_range(
+	          diff_handle,
+	          0,
+	          0,
+	          -1,
+	          10,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = diff_handle_free(
+	          &diff_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff_handle != NULL )
+	{
+		diff_handle_free(
+		 &diff_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the diff_handle_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_diff_handle_signal_abort(
+     void )
+{
+	diff_handle_t *diff_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = diff_handle_initialize(
+	          &diff_handle,
+	          DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "diff_handle",
+	 diff_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = diff_handle_signal_abort(
+	          diff_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "diff_handle->abort",
+	 diff_handle->abort,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = diff_handle_signal_abort(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = diff_handle_free(
+	          &diff_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff_handle != NULL )
+	{
+		diff_handle_free(
+		 &diff_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "diff_handle_initialize",
+	 vsgpt_test_tools_diff_handle_initialize );
+
+	VSGPT_TEST_RUN(
+	 "diff_handle_free",
+	 vsgpt_test_tools_diff_handle_free );
+
+	VSGPT_TEST_RUN(
+	 "diff_handle_parse_number_of_threads",
+	 vsgpt_test_tools_diff_handle_parse_number_of_threads );
+
+	VSGPT_TEST_RUN(
+	 "diff_handle_append_range",
+	 vsgpt_test_tools_diff_handle_append_range );
+
+	VSGPT_TEST_RUN(
+	 "diff_handle_signal_abort",
+	 vsgpt_test_tools_diff_handle_signal_abort );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
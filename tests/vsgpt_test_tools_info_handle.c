@@ -22,6 +22,8 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -268,6 +270,503 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the info_handle_get_open_phase_description function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_info_handle_get_open_phase_description(
+     void )
+{
+	const char *description = NULL;
+	int result              = 0;
+
+	/* Test regular cases
+	 */
+	description = info_handle_get_open_phase_description(
+	               LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "description",
+	 description );
+
+	result = narrow_string_compare(
+	          description,
+	          "partition entries",
+	          18 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	description = info_handle_get_open_phase_description(
+	               -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "description",
+	 description );
+
+	result = narrow_string_compare(
+	          description,
+	          "unknown",
+	          8 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the info_handle_set_output_format function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_info_handle_set_output_format(
+     void )
+{
+	info_handle_t *info_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "jsonl" ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_JSONL );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "csv" ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "xml" ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	/* Test error cases
+	 */
+	result = info_handle_set_output_format(
+	          NULL,
+	          _SYSTEM_STRING( "json" ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_handle_output_write functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_info_handle_output_write(
+     void )
+{
+	char output_data[ 128 ];
+
+	uint8_t guid_data[ 16 ] = {
+		0x96, 0x2f, 0x52, 0x2d, 0xad, 0x53, 0x0b, 0x4b, 0x92, 0x71, 0x68, 0x9a, 0x87, 0x75, 0xf9, 0xa0 };
+
+	const char *expected_output = "2d522f96-53ad-4b0b-9271-689a8775f9a0,18446744073709551615,0,\"a\\\"b\\\\c\\u0009\"";
+	info_handle_t *info_handle  = NULL;
+	libcerror_error_t *error    = NULL;
+	FILE *stream                = NULL;
+	size_t expected_size        = 0;
+	size_t read_count           = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	info_handle->notify_stream = stream;
+	info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSON;
+
+	/* Test regular cases
+	 */
+	result = info_handle_output_write_guid(
+	          info_handle,
+	          guid_data,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_string(
+	          info_handle,
+	          ",",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_decimal(
+	          info_handle,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_string(
+	          info_handle,
+	          ",",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_decimal(
+	          info_handle,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_string(
+	          info_handle,
+	          ",",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_write_quoted_string(
+	          info_handle,
+	          _SYSTEM_STRING( "a\"b\\c\t" ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_output_flush(
+	          info_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->output_buffer_offset",
+	 info_handle->output_buffer_offset,
+	 (size_t) 0 );
+
+	rewind(
+	 stream );
+
+	expected_size = narrow_string_length(
+	                 expected_output );
+
+	read_count = file_stream_read(
+	              stream,
+	              output_data,
+	              128 );
+
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 expected_size );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output,
+	          expected_size );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_handle_output_write(
+	          NULL,
+	          ",",
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_output_write(
+	          info_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_output_write_guid(
+	          info_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	info_handle->notify_stream = stdout;
+
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle->notify_stream = stdout;
+
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +790,18 @@ int main(
 	 "info_handle_free",
 	 vsgpt_test_tools_info_handle_free );
 
+	VSGPT_TEST_RUN(
+	 "info_handle_get_open_phase_description",
+	 vsgpt_test_tools_info_handle_get_open_phase_description );
+
+	VSGPT_TEST_RUN(
+	 "info_handle_set_output_format",
+	 vsgpt_test_tools_info_handle_set_output_format );
+
+	VSGPT_TEST_RUN(
+	 "info_handle_output_write",
+	 vsgpt_test_tools_info_handle_output_write );
+
 	return( EXIT_SUCCESS );
 
 on_error:
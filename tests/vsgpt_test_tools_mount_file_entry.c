@@ -0,0 +1,1137 @@
+/*
+ * Tools mount_file_entry type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/mount_file_entry.h"
+
+/* Tests the mount_file_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	mount_file_entry_t *file_entry  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = mount_file_entry_initialize(
+	          &file_entry,
+	          _SYSTEM_STRING( "vsgpt1" ),
+	          6,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_file_entry_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "vsgpt1" ),
+	          6,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_entry = (mount_file_entry_t *) 0x12345678UL;
+
+	result = mount_file_entry_initialize(
+	          &file_entry,
+	          _SYSTEM_STRING( "vsgpt1" ),
+	          6,
+	          NULL,
+	          &error );
+
+	file_entry = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_initialize(
+	          &file_entry,
+	          NULL,
+	          6,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test mount_file_entry_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = mount_file_entry_initialize(
+		          &file_entry,
+		          _SYSTEM_STRING( "vsgpt1" ),
+		          6,
+		          NULL,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( file_entry != NULL )
+			{
+				mount_file_entry_free(
+				 &file_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "file_entry",
+			 file_entry );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test mount_file_entry_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = mount_file_entry_initialize(
+		          &file_entry,
+		          _SYSTEM_STRING( "vsgpt1" ),
+		          6,
+		          NULL,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( file_entry != NULL )
+			{
+				mount_file_entry_free(
+				 &file_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "file_entry",
+			 file_entry );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = mount_file_entry_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_entry_get_name function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_get_name(
+     mount_file_entry_t *file_entry )
+{
+	system_character_t name[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t name_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_file_entry_get_name_size(
+	          file_entry,
+	          &name_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 7 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_get_name(
+	          file_entry,
+	          name,
+	          32,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          name,
+	          _SYSTEM_STRING( "vsgpt1" ),
+	          7 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = mount_file_entry_get_name(
+	          NULL,
+	          name,
+	          32,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_get_name(
+	          file_entry,
+	          name,
+	          6,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_entry_is_directory and mount_file_entry_get_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_is_directory(
+     mount_file_entry_t *file_entry )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_file_entry_is_directory(
+	          file_entry,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_file_entry_is_directory(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_get_size(
+	          file_entry,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_entry_grab_read_ahead_slot, mount_file_entry_complete_read_ahead_slot
+ * and mount_file_entry_release_read_ahead_slot functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_read_ahead_slots(
+     mount_file_entry_t *file_entry )
+{
+	libcerror_error_t *error = NULL;
+	off64_t block_offset     = 0;
+	int block_index          = 0;
+	int evicted_slot_index   = 0;
+	int result               = 0;
+	int slot_index           = 0;
+	int second_slot_index    = 0;
+
+	/* Test that a block that is not in a slot reserves a slot to be filled
+	 */
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          0,
+	          &slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_complete_read_ahead_slot(
+	          file_entry,
+	          slot_index,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_readers",
+	 file_entry->read_ahead_slots[ slot_index ].number_of_readers,
+	 1 );
+
+	result = mount_file_entry_release_read_ahead_slot(
+	          file_entry,
+	          slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a block that is in a slot is shared
+	 */
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          0,
+	          &second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "second_slot_index",
+	 second_slot_index,
+	 slot_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_release_read_ahead_slot(
+	          file_entry,
+	          second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a failed fill makes the slot available again
+	 */
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          (off64_t) MOUNT_FILE_ENTRY_READ_AHEAD_SIZE,
+	          &second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "second_slot_index",
+	 second_slot_index,
+	 slot_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_complete_read_ahead_slot(
+	          file_entry,
+	          second_slot_index,
+	          -1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) file_entry->read_ahead_slots[ second_slot_index ].data_offset,
+	 (int64_t) -1 );
+
+	/* Test that the least recently used slot is reused
+	 */
+	for( block_index = 1;
+	     block_index < MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS;
+	     block_index++ )
+	{
+		block_offset = (off64_t) block_index * MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+
+		result = mount_file_entry_grab_read_ahead_slot(
+		          file_entry,
+		          block_offset,
+		          &second_slot_index,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = mount_file_entry_complete_read_ahead_slot(
+		          file_entry,
+		          second_slot_index,
+		          512,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = mount_file_entry_release_read_ahead_slot(
+		          file_entry,
+		          second_slot_index,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( block_index == 1 )
+		{
+			evicted_slot_index = second_slot_index;
+		}
+	}
+	/* The slot of block 0 was used before the slots of the other blocks
+	 * so reading block 0 makes block 1 the least recently used
+	 */
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          0,
+	          &second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_release_read_ahead_slot(
+	          file_entry,
+	          second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	block_offset = (off64_t) MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS * MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          block_offset,
+	          &second_slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "second_slot_index",
+	 second_slot_index,
+	 evicted_slot_index );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_entry_complete_read_ahead_slot(
+	          file_entry,
+	          second_slot_index,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_file_entry_grab_read_ahead_slot(
+	          NULL,
+	          0,
+	          &slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          1,
+	          &slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_grab_read_ahead_slot(
+	          file_entry,
+	          0,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_complete_read_ahead_slot(
+	          file_entry,
+	          slot_index,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_complete_read_ahead_slot(
+	          file_entry,
+	          MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS,
+	          512,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_release_read_ahead_slot(
+	          file_entry,
+	          slot_index,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_entry_release_read_ahead_slot(
+	          file_entry,
+	          -1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_entry_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_mount_file_entry_read_buffer_at_offset(
+     mount_file_entry_t *file_entry )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	/* Test regular cases
+	 */
+	read_count = mount_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = mount_file_entry_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = mount_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = mount_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a file entry without partition cannot be filled
+	 */
+	read_count = mount_file_entry_fill_read_ahead_slot(
+	              file_entry,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	int result                     = 0;
+
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "mount_file_entry_initialize",
+	 vsgpt_test_tools_mount_file_entry_initialize );
+
+	VSGPT_TEST_RUN(
+	 "mount_file_entry_free",
+	 vsgpt_test_tools_mount_file_entry_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize file entry for tests
+	 */
+	result = mount_file_entry_initialize(
+	          &file_entry,
+	          _SYSTEM_STRING( "vsgpt1" ),
+	          6,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "mount_file_entry_get_name",
+	 vsgpt_test_tools_mount_file_entry_get_name,
+	 file_entry );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "mount_file_entry_is_directory",
+	 vsgpt_test_tools_mount_file_entry_is_directory,
+	 file_entry );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "mount_file_entry_read_ahead_slots",
+	 vsgpt_test_tools_mount_file_entry_read_ahead_slots,
+	 file_entry );
+
+	VSGPT_TEST_RUN_WITH_ARGS(
+	 "mount_file_entry_read_buffer_at_offset",
+	 vsgpt_test_tools_mount_file_entry_read_buffer_at_offset,
+	 file_entry );
+
+	/* Clean up
+	 */
+	result = mount_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
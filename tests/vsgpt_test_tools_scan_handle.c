@@ -0,0 +1,872 @@
+/*
+ * Tools scan_handle type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/scan_handle.h"
+
+/* Tests the scan_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_scan_handle_initialize(
+     void )
+{
+	scan_handle_t *scan_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_handle = (scan_handle_t *) 0x12345678UL;
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          1,
+	          &error );
+
+	scan_handle = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test scan_handle_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = scan_handle_initialize(
+		          &scan_handle,
+		          1,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( scan_handle != NULL )
+			{
+				scan_handle_free(
+				 &scan_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "scan_handle",
+			 scan_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test scan_handle_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = scan_handle_initialize(
+		          &scan_handle,
+		          1,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( scan_handle != NULL )
+			{
+				scan_handle_free(
+				 &scan_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "scan_handle",
+			 scan_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_scan_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = scan_handle_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_parse_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_scan_handle_parse_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 16 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_parse_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "4x" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "0" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "99999999999" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_escape_source function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_scan_handle_escape_source(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	char *escaped_source     = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = scan_handle_escape_source(
+	          _SYSTEM_STRING( "dir\\\"image\".raw\t" ),
+	          &escaped_source,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "escaped_source",
+	 escaped_source );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          escaped_source,
+	          "dir\\\\\\\"image\\\".raw\\u0009",
+	          25 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 escaped_source );
+
+	escaped_source = NULL;
+
+	/* Test error cases
+	 */
+	result = scan_handle_escape_source(
+	          NULL,
+	          &escaped_source,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_escape_source(
+	          _SYSTEM_STRING( "image.raw" ),
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( escaped_source != NULL )
+	{
+		memory_free(
+		 escaped_source );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_read_completed_sources and scan_handle_is_completed_source functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_scan_handle_is_completed_source(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	scan_handle_t *scan_handle          = NULL;
+	FILE *stream                        = NULL;
+	size64_t expected_records_data_size = 0;
+	size64_t records_data_size          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream = tmpfile();
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* The source with an error is not completed and the last record
+	 * was not completely written
+	 */
+	fprintf(
+	 stream,
+	 "{\"source\": \"b.raw\", \"status\": \"not_gpt\", \"elapsed_time\": 10}\n"
+	 "{\"source\": \"a \\\"1\\\".raw\", \"status\": \"not_gpt\", \"elapsed_time\": 10}\n"
+	 "{\"source\": \"d.raw\", \"status\": \"error\", \"elapsed_time\": 10}\n" );
+
+	expected_records_data_size = (size64_t) ftell(
+	                                         stream );
+
+	fprintf(
+	 stream,
+	 "{\"source\": \"c.raw\", \"status\": \"gpt\", \"disk_" );
+
+	rewind(
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = scan_handle_read_completed_sources(
+	          scan_handle,
+	          stream,
+	          &records_data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "scan_handle->number_of_completed_sources",
+	 scan_handle->number_of_completed_sources,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "records_data_size",
+	 records_data_size,
+	 expected_records_data_size );
+
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          "a \\\"1\\\".raw",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          "b.raw",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          "c.raw",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          "d.raw",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_read_completed_sources(
+	          NULL,
+	          stream,
+	          &records_data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_read_completed_sources(
+	          scan_handle,
+	          NULL,
+	          &records_data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_read_completed_sources(
+	          scan_handle,
+	          stream,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_is_completed_source(
+	          NULL,
+	          "b.raw",
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "scan_handle_initialize",
+	 vsgpt_test_tools_scan_handle_initialize );
+
+	VSGPT_TEST_RUN(
+	 "scan_handle_free",
+	 vsgpt_test_tools_scan_handle_free );
+
+	VSGPT_TEST_RUN(
+	 "scan_handle_parse_number_of_threads",
+	 vsgpt_test_tools_scan_handle_parse_number_of_threads );
+
+	VSGPT_TEST_RUN(
+	 "scan_handle_escape_source",
+	 vsgpt_test_tools_scan_handle_escape_source );
+
+	VSGPT_TEST_RUN(
+	 "scan_handle_is_completed_source",
+	 vsgpt_test_tools_scan_handle_is_completed_source );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1291 @@
+/*
+ * Tools verify_handle type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsgpt_test_libcerror.h"
+#include "vsgpt_test_macros.h"
+#include "vsgpt_test_memory.h"
+#include "vsgpt_test_unused.h"
+
+#include "../vsgpttools/verify_handle.h"
+
+/* Tests the verify_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_initialize(
+     void )
+{
+	verify_handle_t *verify_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verify_handle_free(
+	          &verify_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verify_handle_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	verify_handle = (verify_handle_t *) 0x12345678UL;
+
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          1,
+	          &error );
+
+	verify_handle = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test verify_handle_initialize with malloc failing
+		 */
+		vsgpt_test_malloc_attempts_before_fail = test_number;
+
+		result = verify_handle_initialize(
+		          &verify_handle,
+		          1,
+		          &error );
+
+		if( vsgpt_test_malloc_attempts_before_fail != -1 )
+		{
+			vsgpt_test_malloc_attempts_before_fail = -1;
+
+			if( verify_handle != NULL )
+			{
+				verify_handle_free(
+				 &verify_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "verify_handle",
+			 verify_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test verify_handle_initialize with memset failing
+		 */
+		vsgpt_test_memset_attempts_before_fail = test_number;
+
+		result = verify_handle_initialize(
+		          &verify_handle,
+		          1,
+		          &error );
+
+		if( vsgpt_test_memset_attempts_before_fail != -1 )
+		{
+			vsgpt_test_memset_attempts_before_fail = -1;
+
+			if( verify_handle != NULL )
+			{
+				verify_handle_free(
+				 &verify_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "verify_handle",
+			 verify_handle );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSGPT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle != NULL )
+	{
+		verify_handle_free(
+		 &verify_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = verify_handle_free(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_parse_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_parse_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 16 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verify_handle_parse_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "16" ),
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "4x" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "0" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_number_of_threads(
+	          _SYSTEM_STRING( "99999999999" ),
+	          &number_of_threads,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_read_manifest_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_read_manifest_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	verify_handle_t *verify_handle = NULL;
+	FILE *stream                   = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream = tmpfile();
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	fprintf(
+	 stream,
+	 "Exporting partition: 1 to: partition.raw.p1.\n"
+	 "CRC-32 of partition: 1\t: 0x5e8d6a2c\n"
+	 "CRC-32 of partition: 0\t: 0x12345678\n"
+	 "CRC-32 of partition: 3\t: 0xCBF4392\n"
+	 "CRC-32 of partition: 4\t: 0xcbf43926\n" );
+
+	rewind(
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = verify_handle_read_manifest_stream(
+	          verify_handle,
+	          stream,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "verify_handle->number_of_manifest_entries",
+	 verify_handle->number_of_manifest_entries,
+	 2 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "verify_handle->manifest_entries[ 0 ].partition_number",
+	 verify_handle->manifest_entries[ 0 ].partition_number,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "verify_handle->manifest_entries[ 0 ].crc32",
+	 verify_handle->manifest_entries[ 0 ].crc32,
+	 (uint32_t) 0x5e8d6a2cUL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "verify_handle->manifest_entries[ 1 ].partition_number",
+	 verify_handle->manifest_entries[ 1 ].partition_number,
+	 4 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "verify_handle->manifest_entries[ 1 ].crc32",
+	 verify_handle->manifest_entries[ 1 ].crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	/* Test error cases
+	 */
+	result = verify_handle_read_manifest_stream(
+	          NULL,
+	          stream,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_read_manifest_stream(
+	          verify_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	result = verify_handle_free(
+	          &verify_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( verify_handle != NULL )
+	{
+		verify_handle_free(
+		 &verify_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_parse_header function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_parse_header(
+     void )
+{
+	uint8_t header_data[ 92 ];
+
+	verify_header_t header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 header_data,
+	 0,
+	 92 );
+
+	memory_copy(
+	 header_data,
+	 "EFI PART",
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 92 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 (uint64_t) 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 32 ] ),
+	 (uint64_t) 2047 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 40 ] ),
+	 (uint64_t) 34 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 48 ] ),
+	 (uint64_t) 2014 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 72 ] ),
+	 (uint64_t) 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 80 ] ),
+	 128 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 84 ] ),
+	 128 );
+
+	memory_set(
+	 &header,
+	 0,
+	 sizeof( verify_header_t ) );
+
+	/* Test regular cases
+	 */
+	result = verify_handle_parse_header(
+	          &header,
+	          header_data,
+	          92,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "header.has_signature",
+	 header.has_signature,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "header.header_data_size",
+	 header.header_data_size,
+	 92 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "header.backup_header_block_number",
+	 header.backup_header_block_number,
+	 (uint64_t) 2047 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "header.area_end_block_number",
+	 header.area_end_block_number,
+	 (uint64_t) 2014 );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT32(
+	 "header.number_of_entries",
+	 header.number_of_entries,
+	 128 );
+
+	header_data[ 0 ] = 'X';
+
+	result = verify_handle_parse_header(
+	          &header,
+	          header_data,
+	          92,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_UINT8(
+	 "header.has_signature",
+	 header.has_signature,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = verify_handle_parse_header(
+	          NULL,
+	          header_data,
+	          92,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_header(
+	          &header,
+	          NULL,
+	          92,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_parse_header(
+	          &header,
+	          header_data,
+	          8,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_check_protective_mbr function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_check_protective_mbr(
+     void )
+{
+	uint8_t mbr_data[ 512 ];
+
+	verify_check_t check;
+
+	libcerror_error_t *error       = NULL;
+	verify_handle_t *verify_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 mbr_data,
+	 0,
+	 512 );
+
+	mbr_data[ 446 + 4 ] = 0xee;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( mbr_data[ 446 + 8 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( mbr_data[ 446 + 12 ] ),
+	 2047 );
+
+	mbr_data[ 510 ] = 0x55;
+	mbr_data[ 511 ] = 0xaa;
+
+	memory_set(
+	 &check,
+	 0,
+	 sizeof( verify_check_t ) );
+
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	verify_handle->media_size       = 2048 * 512;
+	verify_handle->bytes_per_sector = 512;
+	verify_handle->mbr_data         = mbr_data;
+
+	/* Test regular cases
+	 */
+	result = verify_handle_check_protective_mbr(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_PASSED );
+
+	/* Test a hybrid MBR
+	 */
+	mbr_data[ 462 + 4 ] = 0x07;
+
+	result = verify_handle_check_protective_mbr(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_FAILED );
+
+	mbr_data[ 462 + 4 ] = 0x00;
+
+	/* Test a protective partition that does not cover the volume
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( mbr_data[ 446 + 12 ] ),
+	 1024 );
+
+	result = verify_handle_check_protective_mbr(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_FAILED );
+
+	/* Test an MBR without boot signature
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( mbr_data[ 446 + 12 ] ),
+	 2047 );
+
+	mbr_data[ 510 ] = 0x00;
+
+	result = verify_handle_check_protective_mbr(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_FAILED );
+
+	/* Test error cases
+	 */
+	result = verify_handle_check_protective_mbr(
+	          NULL,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_check_protective_mbr(
+	          verify_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	verify_handle->mbr_data = NULL;
+
+	result = verify_handle_free(
+	          &verify_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle != NULL )
+	{
+		verify_handle->mbr_data = NULL;
+
+		verify_handle_free(
+		 &verify_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verify_handle_check_partition_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_tools_verify_handle_check_partition_layout(
+     void )
+{
+	verify_partition_t partitions[ 2 ];
+
+	verify_check_t check;
+
+	libcerror_error_t *error       = NULL;
+	verify_handle_t *verify_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 partitions,
+	 0,
+	 sizeof( verify_partition_t ) * 2 );
+
+	partitions[ 0 ].partition_number   = 1;
+	partitions[ 0 ].start_block_number = 34;
+	partitions[ 0 ].end_block_number   = 1023;
+	partitions[ 1 ].partition_number   = 2;
+	partitions[ 1 ].start_block_number = 1024;
+	partitions[ 1 ].end_block_number   = 2014;
+
+	memory_set(
+	 &check,
+	 0,
+	 sizeof( verify_check_t ) );
+
+	result = verify_handle_initialize(
+	          &verify_handle,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	verify_handle->backup_header.area_start_block_number = 34;
+	verify_handle->backup_header.area_end_block_number   = 2014;
+	verify_handle->partitions                            = partitions;
+	verify_handle->number_of_partitions                  = 2;
+
+	/* Test regular cases
+	 */
+	result = verify_handle_check_partition_layout(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_PASSED );
+
+	/* Test overlapping partitions
+	 */
+	partitions[ 1 ].start_block_number = 1000;
+
+	result = verify_handle_check_partition_layout(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_FAILED );
+
+	/* Test a partition outside of the partition area
+	 */
+	partitions[ 1 ].start_block_number = 1024;
+	partitions[ 1 ].end_block_number   = 2047;
+
+	result = verify_handle_check_partition_layout(
+	          verify_handle,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "check.status",
+	 check.status,
+	 VERIFY_CHECK_STATUS_FAILED );
+
+	/* Test error cases
+	 */
+	result = verify_handle_check_partition_layout(
+	          NULL,
+	          &check,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verify_handle_check_partition_layout(
+	          verify_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	verify_handle->partitions           = NULL;
+	verify_handle->number_of_partitions = 0;
+
+	result = verify_handle_free(
+	          &verify_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "verify_handle",
+	 verify_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle != NULL )
+	{
+		verify_handle->partitions = NULL;
+
+		verify_handle_free(
+		 &verify_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSGPT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSGPT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argc )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_initialize",
+	 vsgpt_test_tools_verify_handle_initialize );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_free",
+	 vsgpt_test_tools_verify_handle_free );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_parse_number_of_threads",
+	 vsgpt_test_tools_verify_handle_parse_number_of_threads );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_read_manifest_stream",
+	 vsgpt_test_tools_verify_handle_read_manifest_stream );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_parse_header",
+	 vsgpt_test_tools_verify_handle_parse_header );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_check_protective_mbr",
+	 vsgpt_test_tools_verify_handle_check_protective_mbr );
+
+	VSGPT_TEST_RUN(
+	 "verify_handle_check_partition_layout",
+	 vsgpt_test_tools_verify_handle_check_partition_layout );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -19,8 +19,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -41,9 +43,14 @@
 #include "vsgpt_test_unused.h"
 
 #if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+#include "../libvsgpt/libvsgpt_boot_record.h"
+#include "../libvsgpt/libvsgpt_checksum.h"
 #include "../libvsgpt/libvsgpt_io_handle.h"
+#include "../libvsgpt/libvsgpt_io_trace.h"
+#include "../libvsgpt/libvsgpt_metadata_cache.h"
 #include "../libvsgpt/libvsgpt_partition_table_header.h"
 #include "../libvsgpt/libvsgpt_volume.h"
+#include "../libvsgpt/vsgpt_volume_layout.h"
 #endif
 
 #if !defined( LIBVSGPT_HAVE_BFIO )
@@ -60,6 +67,15 @@ int libvsgpt_volume_open_file_io_handle(
      int access_flags,
      libvsgpt_error_t **error );
 
+LIBVSGPT_EXTERN \
+int libvsgpt_volume_open_with_layout(
+     libvsgpt_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *layout_data,
+     size_t layout_data_size,
+     int access_flags,
+     libvsgpt_error_t **error );
+
 #endif /* !defined( LIBVSGPT_HAVE_BFIO ) */
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -1099,56 +1115,110 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_volume_close function
+/* Tests the libvsgpt_volume_open_buffer function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_volume_close(
-     void )
+int vsgpt_test_volume_open_buffer(
+     libbfio_handle_t *file_io_handle )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t sector_data[ 512 ];
 
-	/* Test error cases
+	uint8_t *buffer                 = NULL;
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = NULL;
+	libvsgpt_volume_t *volume       = NULL;
+	size64_t file_size              = 0;
+	ssize_t read_count              = 0;
+	off64_t volume_offset           = 0;
+	int number_of_partitions        = 0;
+	int result                      = 0;
+
+	/* Initialize test
 	 */
-	result = libvsgpt_volume_close(
-	          NULL,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
 
-	return( 1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only test with sources that are small enough to fit in memory
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) ( 64 * 1024 * 1024 ) ) )
 	{
-		libcerror_error_free(
-		 &error );
+		result = libbfio_handle_close(
+		          file_io_handle,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		return( 1 );
 	}
-	return( 0 );
-}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) file_size );
 
-/* Tests the libvsgpt_volume_open and libvsgpt_volume_close functions
- * Returns 1 if successful or 0 if not
- */
-int vsgpt_test_volume_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error  = NULL;
-	libvsgpt_volume_t *volume = NULL;
-	int result                = 0;
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libvsgpt_volume_initialize(
 	          &volume,
 	          &error );
@@ -1166,21 +1236,14 @@ int vsgpt_test_volume_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libvsgpt_volume_open_wide(
-	          volume,
-	          source,
-	          LIBVSGPT_OPEN_READ,
-	          &error );
-#else
-	result = libvsgpt_volume_open(
+	result = libvsgpt_volume_open_buffer(
 	          volume,
-	          source,
+	          buffer,
+	          (size_t) file_size,
 	          LIBVSGPT_OPEN_READ,
 	          &error );
-#endif
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1191,44 +1254,119 @@ int vsgpt_test_volume_open_close(
 	 "error",
 	 error );
 
-	result = libvsgpt_volume_close(
+	result = libvsgpt_volume_get_number_of_partitions(
 	          volume,
+	          &number_of_partitions,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	if( number_of_partitions > 0 )
+	{
+		result = libvsgpt_volume_get_partition_by_index(
+		          volume,
+		          0,
+		          &partition,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "partition",
+		 partition );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_partition_get_volume_offset(
+		          partition,
+		          &volume_offset,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libvsgpt_partition_read_buffer_at_offset(
+		              partition,
+		              sector_data,
+		              512,
+		              0,
+		              &error );
+
+		VSGPT_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( read_count > 0 )
+		 && ( (size64_t) volume_offset < file_size ) )
+		{
+			result = memory_compare(
+			          sector_data,
+			          &( buffer[ volume_offset ] ),
+			          (size_t) read_count );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+
+		result = libvsgpt_partition_free(
+		          &partition,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test open when already opened
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libvsgpt_volume_open_wide(
-	          volume,
-	          source,
-	          LIBVSGPT_OPEN_READ,
-	          &error );
-#else
-	result = libvsgpt_volume_open(
+	result = libvsgpt_volume_open_buffer(
 	          volume,
-	          source,
+	          buffer,
+	          (size_t) file_size,
 	          LIBVSGPT_OPEN_READ,
 	          &error );
-#endif
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	result = libvsgpt_volume_close(
 	          volume,
 	          &error );
@@ -1242,152 +1380,89 @@ int vsgpt_test_volume_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
+	/* Test error cases
 	 */
-	result = libvsgpt_volume_free(
-	          &volume,
+	result = libvsgpt_volume_open_buffer(
+	          NULL,
+	          buffer,
+	          (size_t) file_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "volume",
-	 volume );
+	 -1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	libcerror_error_free(
+	 &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( volume != NULL )
-	{
-		libvsgpt_volume_free(
-		 &volume,
-		 NULL );
-	}
-	return( 0 );
-}
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          NULL,
+	          (size_t) file_size,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
 
-#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libvsgpt_internal_volume_open_read function
- * Returns 1 if successful or 0 if not
- */
-int vsgpt_test_internal_volume_open_read(
-     const system_character_t *source )
-{
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libvsgpt_volume_t *volume        = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          buffer,
+	          0,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-        VSGPT_TEST_ASSERT_IS_NOT_NULL(
-         "file_io_handle",
-         file_io_handle );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	libcerror_error_free(
+	 &error );
 
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	result = libbfio_handle_open(
-	          file_io_handle,
-	          LIBBFIO_ACCESS_FLAG_READ,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	result = libvsgpt_volume_initialize(
-	          &volume,
-	          &error );
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "volume",
-	 volume );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libvsgpt_internal_volume_open_read(
-	          (libvsgpt_internal_volume_t *) volume,
-	          file_io_handle,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libvsgpt_internal_volume_open_read(
-	          NULL,
-	          file_io_handle,
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          buffer,
+	          (size_t) file_size,
+	          0,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1402,9 +1477,11 @@ int vsgpt_test_internal_volume_open_read(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_internal_volume_open_read(
-	          (libvsgpt_internal_volume_t *) volume,
-	          NULL,
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          buffer,
+	          (size_t) file_size,
+	          LIBVSGPT_OPEN_WRITE,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1419,6 +1496,71 @@ int vsgpt_test_internal_volume_open_read(
 	libcerror_error_free(
 	 &error );
 
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_open_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 * after the volume was opened from the buffer
+	 */
+	vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = 1;
+
+	result = libvsgpt_volume_open_buffer(
+	          volume,
+	          buffer,
+	          (size_t) file_size,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Test if the volume was closed
+		 */
+		result = libvsgpt_volume_open_buffer(
+		          volume,
+		          buffer,
+		          (size_t) file_size,
+		          LIBVSGPT_OPEN_READ,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_volume_close(
+		          volume,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
 	/* Clean up
 	 */
 	result = libvsgpt_volume_free(
@@ -1438,35 +1580,8 @@ int vsgpt_test_internal_volume_open_read(
 	 "error",
 	 error );
 
-	result = libbfio_handle_close(
-	          file_io_handle,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-         "file_io_handle",
-         file_io_handle );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	memory_free(
+	 buffer );
 
 	return( 1 );
 
@@ -1476,37 +1591,50 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
 	if( volume != NULL )
 	{
 		libvsgpt_volume_free(
 		 &volume,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
+	if( buffer != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		memory_free(
+		 buffer );
 	}
 	return( 0 );
 }
 
-/* Tests the libvsgpt_internal_volume_read_partition_table_headers function
+/* Tests the libvsgpt_volume_open_with_layout function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_internal_volume_read_partition_table_headers(
-     const system_character_t *source )
+int vsgpt_test_volume_open_with_layout(
+     libbfio_handle_t *file_io_handle )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libvsgpt_volume_t *volume        = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	libcerror_error_t *error          = NULL;
+	libvsgpt_volume_t *volume         = NULL;
+	uint8_t *layout_data              = NULL;
+	size_t layout_size                = 0;
+	int expected_number_of_partitions = 0;
+	int number_of_partitions          = 0;
+	int result                        = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	vsgpt_volume_layout_partition_t *layout_partition = NULL;
+	uint64_t partition_size                           = 0;
+	uint32_t checksum                                 = 0;
+#endif
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
+	result = libvsgpt_volume_initialize(
+	          &volume,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1514,42 +1642,18 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	 result,
 	 1 );
 
-        VSGPT_TEST_ASSERT_IS_NOT_NULL(
-         "file_io_handle",
-         file_io_handle );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
 
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libbfio_handle_open(
+	result = libvsgpt_volume_open_file_io_handle(
+	          volume,
 	          file_io_handle,
-	          LIBBFIO_ACCESS_FLAG_READ,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1557,12 +1661,13 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	 result,
 	 1 );
 
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libvsgpt_volume_initialize(
-	          &volume,
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &expected_number_of_partitions,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1570,19 +1675,15 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	 result,
 	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "volume",
-	 volume );
-
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test export layout
 	 */
-	result = libvsgpt_internal_volume_read_partition_table_headers(
-	          (libvsgpt_internal_volume_t *) volume,
-	          file_io_handle,
+	result = libvsgpt_volume_get_layout_size(
+	          volume,
+	          &layout_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1594,10 +1695,22 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libvsgpt_partition_table_header_free(
-	          &( (libvsgpt_internal_volume_t *) volume )->partition_table_header,
+	VSGPT_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "layout_size",
+	 (ssize_t) layout_size,
+	 (ssize_t) 0 );
+
+	layout_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * layout_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_data",
+	 layout_data );
+
+	result = libvsgpt_volume_export_layout(
+	          volume,
+	          layout_data,
+	          layout_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1605,19 +1718,15 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	 result,
 	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "volume->partition_table_header",
-	 ( (libvsgpt_internal_volume_t *) volume )->partition_table_header );
-
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libvsgpt_internal_volume_read_partition_table_headers(
+	result = libvsgpt_volume_get_layout_size(
 	          NULL,
-	          file_io_handle,
+	          &layout_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1632,15 +1741,11 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	libcerror_error_free(
 	 &error );
 
-	( (libvsgpt_internal_volume_t *) volume )->partition_table_header = (libvsgpt_partition_table_header_t *) 0x12345678UL;
-
-	result = libvsgpt_internal_volume_read_partition_table_headers(
-	          (libvsgpt_internal_volume_t *) volume,
-	          file_io_handle,
+	result = libvsgpt_volume_get_layout_size(
+	          volume,
+	          NULL,
 	          &error );
 
-	( (libvsgpt_internal_volume_t *) volume )->partition_table_header = NULL;
-
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1653,9 +1758,10 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_internal_volume_read_partition_table_headers(
-	          (libvsgpt_internal_volume_t *) volume,
+	result = libvsgpt_volume_export_layout(
 	          NULL,
+	          layout_data,
+	          layout_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1670,97 +1776,77 @@ int vsgpt_test_internal_volume_read_partition_table_headers(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libvsgpt_volume_free(
-	          &volume,
+	result = libvsgpt_volume_export_layout(
+	          volume,
+	          NULL,
+	          layout_size,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "volume",
-	 volume );
+	 -1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_handle_close(
-	          file_io_handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_export_layout(
+	          volume,
+	          layout_data,
+	          layout_size - 1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_close(
+	          volume,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
-         "file_io_handle",
-         file_io_handle );
-
-        VSGPT_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( volume != NULL )
-	{
-		libvsgpt_volume_free(
-		 &volume,
-		 NULL );
-	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( 0 );
-}
+	 "error",
+	 error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+	/* Test open with layout
+	 */
+	result = libvsgpt_volume_open_with_layout(
+	          volume,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
 
-/* Tests the libvsgpt_volume_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int vsgpt_test_volume_signal_abort(
-     libvsgpt_volume_t *volume )
-{
-	libcerror_error_t *error        = NULL;
-	int result                      = 0;
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
-	libvsgpt_io_handle_t *io_handle = NULL;
-#endif
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libvsgpt_volume_signal_abort(
+	result = libvsgpt_volume_get_number_of_partitions(
 	          volume,
+	          &number_of_partitions,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1768,14 +1854,23 @@ int vsgpt_test_volume_signal_abort(
 	 result,
 	 1 );
 
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 expected_number_of_partitions );
+
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open with layout when already opened
 	 */
-	result = libvsgpt_volume_signal_abort(
-	          NULL,
+	result = libvsgpt_volume_open_with_layout(
+	          volume,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1790,17 +1885,32 @@ int vsgpt_test_volume_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	result = libvsgpt_volume_close(
+	          volume,
+	          &error );
 
-	io_handle = ( (libvsgpt_internal_volume_t *) volume )->io_handle;
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	( (libvsgpt_internal_volume_t *) volume )->io_handle = NULL;
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libvsgpt_volume_signal_abort(
+	/* Test open with layout with a corrupted layout
+	 */
+	layout_data[ layout_size - 1 ] ^= 0xff;
+
+	result = libvsgpt_volume_open_with_layout(
 	          volume,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
-	( (libvsgpt_internal_volume_t *) volume )->io_handle = io_handle;
+	layout_data[ layout_size - 1 ] ^= 0xff;
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1814,54 +1924,116 @@ int vsgpt_test_volume_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
 
-	return( 1 );
+	/* Test open with layout with a layout that does not match the volume
+	 */
+	layout_data[ 32 ] ^= 0xff;
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	result = libvsgpt_checksum_calculate_crc32(
+	          &checksum,
+	          layout_data,
+	          layout_size - 4,
+	          0,
+	          &error );
 
-/* Tests the libvsgpt_volume_get_bytes_per_sector function
- * Returns 1 if successful or 0 if not
- */
-int vsgpt_test_volume_get_bytes_per_sector(
-     libvsgpt_volume_t *volume )
-{
-	libcerror_error_t *error        = NULL;
-	uint32_t bytes_per_sector       = 0;
-	int result                      = 0;
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
-	libvsgpt_io_handle_t *io_handle = NULL;
-#endif
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libvsgpt_volume_get_bytes_per_sector(
+	byte_stream_copy_from_uint32_little_endian(
+	 &( layout_data[ layout_size - 4 ] ),
+	 checksum );
+
+	result = libvsgpt_volume_open_with_layout(
 	          volume,
-	          &bytes_per_sector,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	layout_data[ 32 ] ^= 0xff;
+
+	/* Test open with layout with a partition that exceeds the volume
+	 */
+	if( expected_number_of_partitions > 0 )
+	{
+		layout_partition = (vsgpt_volume_layout_partition_t *) &( layout_data[ sizeof( vsgpt_volume_layout_header_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 layout_partition->size,
+		 partition_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 layout_partition->size,
+		 (uint64_t) 0x4000000000000000ULL );
+
+		result = libvsgpt_checksum_calculate_crc32(
+		          &checksum,
+		          layout_data,
+		          layout_size - 4,
+		          0,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( layout_data[ layout_size - 4 ] ),
+		 checksum );
+
+		result = libvsgpt_volume_open_with_layout(
+		          volume,
+		          file_io_handle,
+		          layout_data,
+		          layout_size,
+		          LIBVSGPT_OPEN_READ,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 layout_partition->size,
+		 partition_size );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
 	/* Test error cases
 	 */
-	result = libvsgpt_volume_get_bytes_per_sector(
+	result = libvsgpt_volume_open_with_layout(
 	          NULL,
-	          &bytes_per_sector,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1876,9 +2048,12 @@ int vsgpt_test_volume_get_bytes_per_sector(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_volume_get_bytes_per_sector(
+	result = libvsgpt_volume_open_with_layout(
 	          volume,
 	          NULL,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -1893,19 +2068,34 @@ int vsgpt_test_volume_get_bytes_per_sector(
 	libcerror_error_free(
 	 &error );
 
-#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	result = libvsgpt_volume_open_with_layout(
+	          volume,
+	          file_io_handle,
+	          NULL,
+	          layout_size,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
 
-	io_handle = ( (libvsgpt_internal_volume_t *) volume )->io_handle;
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	( (libvsgpt_internal_volume_t *) volume )->io_handle = NULL;
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libvsgpt_volume_get_bytes_per_sector(
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_open_with_layout(
 	          volume,
-	          &bytes_per_sector,
+	          file_io_handle,
+	          layout_data,
+	          0,
+	          LIBVSGPT_OPEN_READ,
 	          &error );
 
-	( (libvsgpt_internal_volume_t *) volume )->io_handle = io_handle;
-
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1918,20 +2108,2775 @@ int vsgpt_test_volume_get_bytes_per_sector(
 	libcerror_error_free(
 	 &error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+	result = libvsgpt_volume_open_with_layout(
+	          volume,
+	          file_io_handle,
+	          layout_data,
+	          layout_size,
+	          LIBVSGPT_OPEN_WRITE,
+	          &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test libvsgpt_volume_get_bytes_per_sector with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libvsgpt_volume_get_bytes_per_sector(
-	          volume,
-	          &bytes_per_sector,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	/* Clean up
+	 */
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 layout_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( layout_data != NULL )
+	{
+		memory_free(
+		 layout_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_close function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_close(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_open and libvsgpt_volume_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error  = NULL;
+	libvsgpt_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libvsgpt_volume_open_wide(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
+#else
+	result = libvsgpt_volume_open(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
+#endif
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_close(
+	          volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libvsgpt_volume_open_wide(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
+#else
+	result = libvsgpt_volume_open(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          &error );
+#endif
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_close(
+	          volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+/* Tests the libvsgpt_internal_volume_open_read function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_volume_open_read(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsgpt_volume_t *volume        = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NOT_NULL(
+         "file_io_handle",
+         file_io_handle );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_internal_volume_open_read(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_internal_volume_open_read(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_internal_volume_open_read(
+	          (libvsgpt_internal_volume_t *) volume,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+         "file_io_handle",
+         file_io_handle );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_volume_read_partition_table_headers function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_volume_read_partition_table_headers(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libvsgpt_metadata_cache_t *metadata_cache = NULL;
+	libvsgpt_volume_t *volume                 = NULL;
+	size64_t volume_size                      = 0;
+	size_t string_length                      = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NOT_NULL(
+         "file_io_handle",
+         file_io_handle );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &volume_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libvsgpt_internal_volume_t *) volume )->size = volume_size;
+
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          volume_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_internal_volume_read_partition_table_headers(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_table_header_free(
+	          &( (libvsgpt_internal_volume_t *) volume )->partition_table_header,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume->partition_table_header",
+	 ( (libvsgpt_internal_volume_t *) volume )->partition_table_header );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_metadata_cache_initialize(
+	          &metadata_cache,
+	          volume_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_internal_volume_read_partition_table_headers(
+	          NULL,
+	          file_io_handle,
+	          metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header = (libvsgpt_partition_table_header_t *) 0x12345678UL;
+
+	result = libvsgpt_internal_volume_read_partition_table_headers(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          metadata_cache,
+	          &error );
+
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_internal_volume_read_partition_table_headers(
+	          (libvsgpt_internal_volume_t *) volume,
+	          NULL,
+	          metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_internal_volume_read_partition_table_headers(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+         "file_io_handle",
+         file_io_handle );
+
+        VSGPT_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libvsgpt_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_volume_read_partition_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_volume_read_partition_entries(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsgpt_volume_t *volume        = NULL;
+	uint8_t *data                    = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 524288;
+	int number_of_partitions         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 * The partition entries array spans multiple chunks and exceeds 32 sectors
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = (int) ( memory_set(
+	                  data,
+	                  0,
+	                  data_size ) != NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Partition entry 5 with start block number 600 and end block number 700
+	 */
+	data_offset = 1024 + ( 5 * 128 );
+
+	data[ data_offset ]      = 0xaf;
+	data[ data_offset + 32 ] = 0x58;
+	data[ data_offset + 33 ] = 0x02;
+	data[ data_offset + 40 ] = 0xbc;
+	data[ data_offset + 41 ] = 0x02;
+
+	/* Partition entry 1500 with start block number 800 and end block number 900
+	 */
+	data_offset = 1024 + ( 1500 * 128 );
+
+	data[ data_offset ]      = 0xaf;
+	data[ data_offset + 32 ] = 0x20;
+	data[ data_offset + 33 ] = 0x03;
+	data[ data_offset + 40 ] = 0x84;
+	data[ data_offset + 41 ] = 0x03;
+
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_table_header_initialize(
+	          &( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libvsgpt_internal_volume_t *) volume )->size                                                         = (size64_t) data_size;
+	( (libvsgpt_internal_volume_t *) volume )->io_handle->bytes_per_sector                                  = 512;
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header->partition_area_start_block_number = 516;
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header->number_of_partition_entries       = 2048;
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header->partition_entry_data_size         = 128;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_internal_volume_read_partition_entries(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          1024,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 2 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          volume,
+	          1500,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_internal_volume_read_partition_entries(
+	          NULL,
+	          file_io_handle,
+	          1024,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a partition entries array that exceeds the volume size
+	 */
+	( (libvsgpt_internal_volume_t *) volume )->partition_table_header->number_of_partition_entries = 4096;
+
+	result = libvsgpt_internal_volume_read_partition_entries(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          1024,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_table_header_free(
+	          &( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		if( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header != NULL )
+		{
+			libvsgpt_partition_table_header_free(
+			 &( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header ),
+			 NULL );
+		}
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_volume_read_backup_partition_table function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_volume_read_backup_partition_table(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsgpt_volume_t *volume        = NULL;
+	uint8_t *data                    = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 1048576;
+	size_t header_offset             = 1048576 - 512;
+	uint32_t checksum                = 0;
+	int number_of_partitions         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 * The volume contains a backup partition table header in block 2047
+	 * preceded by 128 partition entries in blocks 2015 to 2046
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = (int) ( memory_set(
+	                  data,
+	                  0,
+	                  data_size ) != NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Partition entry 3 with start block number 100 and end block number 199
+	 */
+	data_offset = ( 2015 * 512 ) + ( 3 * 128 );
+
+	data[ data_offset ]      = 0xaf;
+	data[ data_offset + 32 ] = 0x64;
+	data[ data_offset + 40 ] = 0xc7;
+
+	result = (int) ( memory_copy(
+	                  &( data[ header_offset ] ),
+	                  "EFI PART",
+	                  8 ) != NULL );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ header_offset + 10 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ header_offset + 12 ] ),
+	 92 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ header_offset + 24 ] ),
+	 2047 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ header_offset + 32 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ header_offset + 40 ] ),
+	 34 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ header_offset + 48 ] ),
+	 2014 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ header_offset + 72 ] ),
+	 2015 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ header_offset + 80 ] ),
+	 128 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ header_offset + 84 ] ),
+	 128 );
+
+	result = libvsgpt_checksum_calculate_crc32(
+	          &checksum,
+	          &( data[ header_offset ] ),
+	          92,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ header_offset + 16 ] ),
+	 checksum );
+
+	result = vsgpt_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libvsgpt_internal_volume_t *) volume )->size = (size64_t) data_size;
+
+	/* Test with a backup partition table header that does not match its checksum
+	 */
+	data[ header_offset + 48 ] ^= 0xff;
+
+	result = libvsgpt_internal_volume_read_backup_partition_table(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          &error );
+
+	data[ header_offset + 48 ] ^= 0xff;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume->partition_table_header",
+	 ( (libvsgpt_internal_volume_t *) volume )->partition_table_header );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_internal_volume_read_backup_partition_table(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume->partition_table_header",
+	 ( (libvsgpt_internal_volume_t *) volume )->partition_table_header );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_SIZE(
+	 "volume->io_handle->bytes_per_sector",
+	 ( (libvsgpt_internal_volume_t *) volume )->io_handle->bytes_per_sector,
+	 (size_t) 512 );
+
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          volume,
+	          3,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_internal_volume_read_backup_partition_table(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_internal_volume_read_backup_partition_table(
+	          (libvsgpt_internal_volume_t *) volume,
+	          file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsgpt_partition_table_header_free(
+	          &( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsgpt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		if( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header != NULL )
+		{
+			libvsgpt_partition_table_header_free(
+			 &( ( (libvsgpt_internal_volume_t *) volume )->partition_table_header ),
+			 NULL );
+		}
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_internal_volume_read_mbr_partition_entries function
+ * The time to read the chain of 256 extended partition records is printed
+ * if the VSGPT_TEST_BENCHMARK environment variable is set
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_internal_volume_read_mbr_partition_entries(
+     void )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libvsgpt_boot_record_t *master_boot_record = NULL;
+	libvsgpt_metadata_cache_t *metadata_cache  = NULL;
+	libvsgpt_volume_t *volume                  = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_offset                         = 0;
+	size_t data_size                           = 1048576;
+	int64_t duration                           = 0;
+	int number_of_links                        = 0;
+	int link_index                             = 0;
+	int print_timings                          = 0;
+	int result                                 = 0;
+	int test_index                             = 0;
+
+	/* Initialize test
+	 */
+	print_timings = ( getenv( "VSGPT_TEST_BENCHMARK" ) != NULL );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libvsgpt_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libvsgpt_internal_volume_t *) volume )->size = (size64_t) data_size;
+
+	/* Test a chain of 256 extended partition records, a chain of 257 extended partition records
+	 * and a chain of which the third extended partition record refers back to the first
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		if( test_index == 1 )
+		{
+			number_of_links = 257;
+		}
+		else
+		{
+			number_of_links = 256;
+		}
+		result = (int) ( memory_set(
+		                  data,
+		                  0,
+		                  data_size ) != NULL );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The master boot record contains an extended partition entry that refers to sector 1
+		 */
+		data[ 446 + 4 ] = 0x0f;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ 446 + 8 ] ),
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ 446 + 12 ] ),
+		 (uint32_t) ( number_of_links * 2 ) );
+
+		data[ 510 ] = 0x55;
+		data[ 511 ] = 0xaa;
+
+		/* Every extended partition record is followed by a logical partition of 1 sector
+		 */
+		for( link_index = 0;
+		     link_index < number_of_links;
+		     link_index++ )
+		{
+			data_offset = (size_t) ( 1 + ( link_index * 2 ) ) * 512;
+
+			data[ data_offset + 446 + 4 ] = 0x83;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 446 + 8 ] ),
+			 1 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 446 + 12 ] ),
+			 1 );
+
+			if( ( test_index == 2 )
+			 && ( link_index == 2 ) )
+			{
+				data[ data_offset + 462 + 4 ] = 0x05;
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset + 462 + 8 ] ),
+				 0 );
+			}
+			else if( link_index < ( number_of_links - 1 ) )
+			{
+				data[ data_offset + 462 + 4 ] = 0x05;
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset + 462 + 8 ] ),
+				 (uint32_t) ( ( link_index + 1 ) * 2 ) );
+			}
+			data[ data_offset + 510 ] = 0x55;
+			data[ data_offset + 511 ] = 0xaa;
+		}
+		result = vsgpt_test_open_file_io_handle(
+		          &file_io_handle,
+		          data,
+		          data_size,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_boot_record_initialize(
+		          &master_boot_record,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_boot_record_read_data(
+		          master_boot_record,
+		          data,
+		          512,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_metadata_cache_initialize(
+		          &metadata_cache,
+		          (size64_t) data_size,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		( (libvsgpt_internal_volume_t *) volume )->io_handle->bytes_per_sector = 512;
+
+		duration = libvsgpt_io_trace_get_current_time();
+
+		result = libvsgpt_internal_volume_read_mbr_partition_entries(
+		          (libvsgpt_internal_volume_t *) volume,
+		          file_io_handle,
+		          metadata_cache,
+		          master_boot_record,
+		          &error );
+
+		duration = libvsgpt_io_trace_get_current_time() - duration;
+
+		if( test_index == 0 )
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			VSGPT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The 256 extended partition records are stored in 4 metadata blocks
+			 */
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "metadata_cache->number_of_reads",
+			 metadata_cache->number_of_reads,
+			 4 );
+
+			if( print_timings != 0 )
+			{
+				fprintf(
+				 stdout,
+				 "\t%d extended partition records: %" PRIi64 " microseconds, %d metadata reads\n",
+				 number_of_links,
+				 duration,
+				 metadata_cache->number_of_reads );
+			}
+		}
+		else
+		{
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		/* Test error cases
+		 */
+		if( test_index == 0 )
+		{
+			result = libvsgpt_internal_volume_read_mbr_partition_entries(
+			          NULL,
+			          file_io_handle,
+			          metadata_cache,
+			          master_boot_record,
+			          &error );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libvsgpt_internal_volume_read_mbr_partition_entries(
+			          (libvsgpt_internal_volume_t *) volume,
+			          file_io_handle,
+			          metadata_cache,
+			          NULL,
+			          &error );
+
+			VSGPT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSGPT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		result = libvsgpt_metadata_cache_free(
+		          &metadata_cache,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_boot_record_free(
+		          &master_boot_record,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = vsgpt_test_close_file_io_handle(
+		          &file_io_handle,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libvsgpt_volume_free(
+	          &volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libvsgpt_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( master_boot_record != NULL )
+	{
+		libvsgpt_boot_record_free(
+		 &master_boot_record,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+/* Tests the libvsgpt_volume_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_signal_abort(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	libvsgpt_io_handle_t *io_handle = NULL;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_signal_abort(
+	          volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_signal_abort(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	io_handle = ( (libvsgpt_internal_volume_t *) volume )->io_handle;
+
+	( (libvsgpt_internal_volume_t *) volume )->io_handle = NULL;
+
+	result = libvsgpt_volume_signal_abort(
+	          volume,
+	          &error );
+
+	( (libvsgpt_internal_volume_t *) volume )->io_handle = io_handle;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Test trace callback function
+ */
+void vsgpt_test_volume_trace_callback(
+      int event_type VSGPT_TEST_ATTRIBUTE_UNUSED,
+      int phase VSGPT_TEST_ATTRIBUTE_UNUSED,
+      off64_t offset VSGPT_TEST_ATTRIBUTE_UNUSED,
+      size64_t size VSGPT_TEST_ATTRIBUTE_UNUSED,
+      uint64_t duration VSGPT_TEST_ATTRIBUTE_UNUSED,
+      void *user_data VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( event_type )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( phase )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( offset )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( size )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( duration )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( user_data )
+}
+
+/* Tests the libvsgpt_volume_set_trace_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_set_trace_callback(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_set_trace_callback(
+	          volume,
+	          &vsgpt_test_volume_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_set_trace_callback(
+	          volume,
+	          NULL,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_set_trace_callback(
+	          NULL,
+	          &vsgpt_test_volume_trace_callback,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_set_timeout function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_set_timeout(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_set_timeout(
+	          volume,
+	          60000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_set_timeout(
+	          volume,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_set_timeout(
+	          NULL,
+	          60000,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_set_recovery_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_set_recovery_mode(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_set_recovery_mode(
+	          volume,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_set_recovery_mode(
+	          volume,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_set_recovery_mode(
+	          NULL,
+	          1,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_is_corrupted function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_is_corrupted(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_is_corrupted(
+	          volume,
+	          &error );
+
+	VSGPT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_is_corrupted(
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_get_bytes_per_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_get_bytes_per_sector(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	uint32_t bytes_per_sector       = 0;
+	int result                      = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+	libvsgpt_io_handle_t *io_handle = NULL;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          volume,
+	          &bytes_per_sector,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          NULL,
+	          &bytes_per_sector,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          volume,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	io_handle = ( (libvsgpt_internal_volume_t *) volume )->io_handle;
+
+	( (libvsgpt_internal_volume_t *) volume )->io_handle = NULL;
+
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          volume,
+	          &bytes_per_sector,
+	          &error );
+
+	( (libvsgpt_internal_volume_t *) volume )->io_handle = io_handle;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_get_bytes_per_sector with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          volume,
+	          &bytes_per_sector,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_volume_get_bytes_per_sector with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_bytes_per_sector(
+	          volume,
+	          &bytes_per_sector,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_get_number_of_partitions function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_get_number_of_partitions(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_partitions = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_get_number_of_partitions(
+	          NULL,
+	          &number_of_partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_get_number_of_partitions with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_volume_get_number_of_partitions with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_get_partition_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_get_partition_by_index(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_get_partition_by_index(
+	          NULL,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          -1,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition = (libvsgpt_partition_t *) 0x12345678UL;
+
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	partition = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_get_partition_by_index with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_volume_get_partition_by_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_has_partition_with_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_has_partition_with_identifier(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          volume,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          volume,
+	          0xffffffffUL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          NULL,
+	          0,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_has_partition_with_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_has_partition_with_identifier(
+	          volume,
+	          0,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
 		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
@@ -1949,13 +4894,203 @@ int vsgpt_test_volume_get_bytes_per_sector(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libvsgpt_volume_get_bytes_per_sector with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libvsgpt_volume_has_partition_with_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libvsgpt_volume_get_bytes_per_sector(
+	result = libvsgpt_volume_has_partition_with_identifier(
 	          volume,
-	          &bytes_per_sector,
+	          0,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_get_partition_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_get_partition_by_identifier(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0xffffffffUL,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          NULL,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition = (libvsgpt_partition_t *) 0x12345678UL;
+
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	partition = NULL;
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
+
+	/* Test libvsgpt_volume_get_partition_by_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSGPT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libvsgpt_volume_get_partition_by_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libvsgpt_volume_get_partition_by_identifier(
+	          volume,
+	          0,
+	          &partition,
 	          &error );
 
 	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -1989,21 +5124,74 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvsgpt_volume_get_number_of_partitions function
+/* Tests the libvsgpt_volume_get_partition_index_by_volume_offset function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_volume_get_number_of_partitions(
+int vsgpt_test_volume_get_partition_index_by_volume_offset(
      libvsgpt_volume_t *volume )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_partitions = 0;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = NULL;
+	off64_t partition_offset        = 0;
+	off64_t volume_offset           = 0;
+	int partition_index             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_get_volume_offset(
+	          partition,
+	          &volume_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_volume_get_number_of_partitions(
+	result = libvsgpt_volume_get_partition_index_by_volume_offset(
 	          volume,
-	          &number_of_partitions,
+	          volume_offset + 1,
+	          &partition_index,
+	          &partition_offset,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2015,11 +5203,34 @@ int vsgpt_test_volume_get_number_of_partitions(
 	 "error",
 	 error );
 
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "partition_offset",
+	 (int64_t) partition_offset,
+	 (int64_t) 1 );
+
+	result = libvsgpt_volume_get_partition_index_by_volume_offset(
+	          volume,
+	          0,
+	          &partition_index,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libvsgpt_volume_get_number_of_partitions(
+	result = libvsgpt_volume_get_partition_index_by_volume_offset(
 	          NULL,
-	          &number_of_partitions,
+	          volume_offset,
+	          &partition_index,
+	          &partition_offset,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2034,11 +5245,232 @@ int vsgpt_test_volume_get_number_of_partitions(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_volume_get_number_of_partitions(
+	result = libvsgpt_volume_get_partition_index_by_volume_offset(
+	          volume,
+	          volume_offset,
+	          NULL,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_partition_index_by_volume_offset(
+	          volume,
+	          volume_offset,
+	          &partition_index,
+	          NULL,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsgpt_volume_get_partition_by_volume_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsgpt_test_volume_get_partition_by_volume_offset(
+     libvsgpt_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = NULL;
+	off64_t partition_offset        = 0;
+	off64_t volume_offset           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_volume_get_partition_by_index(
 	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_get_volume_offset(
+	          partition,
+	          &volume_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_partition_by_volume_offset(
+	          volume,
+	          volume_offset,
+	          &partition,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "partition_offset",
+	 (int64_t) partition_offset,
+	 (int64_t) 0 );
+
+	result = libvsgpt_partition_free(
+	          &partition,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsgpt_volume_get_partition_by_volume_offset(
+	          volume,
+	          0,
+	          &partition,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "partition",
+	 partition );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsgpt_volume_get_partition_by_volume_offset(
+	          NULL,
+	          volume_offset,
+	          &partition,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsgpt_volume_get_partition_by_volume_offset(
+	          volume,
+	          volume_offset,
 	          NULL,
+	          &partition_offset,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	partition = (libvsgpt_partition_t *) 0x12345678UL;
+
+	result = libvsgpt_volume_get_partition_by_volume_offset(
+	          volume,
+	          volume_offset,
+	          &partition,
+	          &partition_offset,
 	          &error );
 
+	partition = NULL;
+
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2051,64 +5483,6 @@ int vsgpt_test_volume_get_number_of_partitions(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_volume_get_number_of_partitions with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_get_number_of_partitions(
-	          volume,
-	          &number_of_partitions,
-	          &error );
-
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_volume_get_number_of_partitions with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_get_number_of_partitions(
-	          volume,
-	          &number_of_partitions,
-	          &error );
-
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
-
 	return( 1 );
 
 on_error:
@@ -2117,20 +5491,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libvsgpt_volume_get_partition_by_index function
+/* Tests the libvsgpt_volume_get_partition_indexes_by_volume_offsets function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_volume_get_partition_by_index(
+int vsgpt_test_volume_get_partition_indexes_by_volume_offsets(
      libvsgpt_volume_t *volume )
 {
+	off64_t partition_offsets[ 2 ]  = { 0, 0 };
+	off64_t volume_offsets[ 2 ]     = { 0, 0 };
+	int partition_indexes[ 2 ]      = { 0, 0 };
 	libcerror_error_t *error        = NULL;
-	libvsgpt_partition_t *partition = 0;
+	libvsgpt_partition_t *partition = NULL;
 	int result                      = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
 	result = libvsgpt_volume_get_partition_by_index(
 	          volume,
@@ -2143,13 +5526,27 @@ int vsgpt_test_volume_get_partition_by_index(
 	 result,
 	 1 );
 
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "partition",
+	 partition );
+
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition",
-	 partition );
+	result = libvsgpt_partition_get_volume_offset(
+	          partition,
+	          &( volume_offsets[ 1 ] ),
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libvsgpt_partition_free(
 	          &partition,
@@ -2164,12 +5561,48 @@ int vsgpt_test_volume_get_partition_by_index(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
+	          volume,
+	          volume_offsets,
+	          2,
+	          partition_indexes,
+	          partition_offsets,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_indexes[ 0 ]",
+	 partition_indexes[ 0 ],
+	 -1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "partition_indexes[ 1 ]",
+	 partition_indexes[ 1 ],
+	 0 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT64(
+	 "partition_offsets[ 1 ]",
+	 (int64_t) partition_offsets[ 1 ],
+	 (int64_t) 0 );
+
 	/* Test error cases
 	 */
-	result = libvsgpt_volume_get_partition_by_index(
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
 	          NULL,
-	          0,
-	          &partition,
+	          volume_offsets,
+	          2,
+	          partition_indexes,
+	          partition_offsets,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2184,10 +5617,12 @@ int vsgpt_test_volume_get_partition_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_volume_get_partition_by_index(
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
 	          volume,
-	          -1,
-	          &partition,
+	          NULL,
+	          2,
+	          partition_indexes,
+	          partition_offsets,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2202,10 +5637,12 @@ int vsgpt_test_volume_get_partition_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_volume_get_partition_by_index(
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
 	          volume,
-	          0,
-	          NULL,
+	          volume_offsets,
+	          -1,
+	          partition_indexes,
+	          partition_offsets,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2220,16 +5657,14 @@ int vsgpt_test_volume_get_partition_by_index(
 	libcerror_error_free(
 	 &error );
 
-	partition = (libvsgpt_partition_t *) 0x12345678UL;
-
-	result = libvsgpt_volume_get_partition_by_index(
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
 	          volume,
-	          0,
-	          &partition,
+	          volume_offsets,
+	          2,
+	          NULL,
+	          partition_offsets,
 	          &error );
 
-	partition = NULL;
-
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2242,91 +5677,200 @@ int vsgpt_test_volume_get_partition_by_index(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_volume_get_partition_by_index with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_get_partition_by_index(
+	result = libvsgpt_volume_get_partition_indexes_by_volume_offsets(
 	          volume,
-	          0,
-	          &partition,
+	          volume_offsets,
+	          2,
+	          partition_indexes,
+	          NULL,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_volume_get_partition_by_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libvsgpt_volume_get_partition_by_index(
-	          volume,
-	          0,
-	          &partition,
-	          &error );
+	return( 1 );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+on_error:
+	if( error != NULL )
 	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+		libcerror_error_free(
+		 &error );
 	}
-	else
+	if( partition != NULL )
 	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( 0 );
+}
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+/* Test partition chunk callback function that sums the chunk sizes
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_volume_sum_chunk_sizes_callback(
+     int partition_index,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *user_data,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
 
-		libcerror_error_free(
-		 &error );
+	if( ( partition_index < 0 )
+	 || ( offset < 0 )
+	 || ( data == NULL )
+	 || ( data_size == 0 )
+	 || ( user_data == NULL ) )
+	{
+		return( -1 );
 	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	*( (size64_t *) user_data ) += data_size;
 
 	return( 1 );
+}
 
-on_error:
-	if( error != NULL )
+/* Test partition chunk callback function that checks the chunk arguments
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_volume_check_chunk_callback(
+     int partition_index,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *user_data VSGPT_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( user_data )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( partition_index < 0 )
+	 || ( offset < 0 )
+	 || ( data == NULL )
+	 || ( data_size == 0 ) )
 	{
-		libcerror_error_free(
-		 &error );
+		return( -1 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
-/* Tests the libvsgpt_volume_has_partition_with_identifier function
+/* Test partition chunk callback function that fails
+ * Returns -1
+ */
+int vsgpt_test_volume_failing_chunk_callback(
+     int partition_index VSGPT_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset VSGPT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data VSGPT_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size VSGPT_TEST_ATTRIBUTE_UNUSED,
+     void *user_data VSGPT_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( partition_index )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( offset )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( data )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( data_size )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( user_data )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* Tests the libvsgpt_volume_for_each_partition_parallel function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_volume_has_partition_with_identifier(
+int vsgpt_test_volume_for_each_partition_parallel(
      libvsgpt_volume_t *volume )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = NULL;
+	size64_t expected_size          = 0;
+	size64_t partition_size         = 0;
+	size64_t processed_size         = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsgpt_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		result = libvsgpt_volume_get_partition_by_index(
+		          volume,
+		          partition_index,
+		          &partition,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsgpt_partition_get_size(
+		          partition,
+		          &partition_size,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_size += partition_size;
+
+		result = libvsgpt_partition_free(
+		          &partition,
+		          &error );
+
+		VSGPT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
+		VSGPT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test regular cases
 	 */
-	result = libvsgpt_volume_has_partition_with_identifier(
+	result = libvsgpt_volume_for_each_partition_parallel(
 	          volume,
-	          0,
+	          &vsgpt_test_volume_sum_chunk_sizes_callback,
+	          (void *) &processed_size,
+	          1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2334,19 +5878,26 @@ int vsgpt_test_volume_has_partition_with_identifier(
 	 result,
 	 1 );
 
+	VSGPT_TEST_ASSERT_EQUAL_UINT64(
+	 "processed_size",
+	 (uint64_t) processed_size,
+	 (uint64_t) expected_size );
+
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libvsgpt_volume_has_partition_with_identifier(
+	result = libvsgpt_volume_for_each_partition_parallel(
 	          volume,
-	          0xffffffffUL,
+	          &vsgpt_test_volume_check_chunk_callback,
+	          NULL,
+	          4,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2354,9 +5905,11 @@ int vsgpt_test_volume_has_partition_with_identifier(
 
 	/* Test error cases
 	 */
-	result = libvsgpt_volume_has_partition_with_identifier(
+	result = libvsgpt_volume_for_each_partition_parallel(
 	          NULL,
-	          0,
+	          &vsgpt_test_volume_check_chunk_callback,
+	          NULL,
+	          1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2371,50 +5924,53 @@ int vsgpt_test_volume_has_partition_with_identifier(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_volume_has_partition_with_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_has_partition_with_identifier(
+	result = libvsgpt_volume_for_each_partition_parallel(
 	          volume,
-	          0,
+	          NULL,
+	          NULL,
+	          1,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_volume_has_partition_with_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libvsgpt_volume_has_partition_with_identifier(
+	result = libvsgpt_volume_for_each_partition_parallel(
 	          volume,
+	          &vsgpt_test_volume_check_chunk_callback,
+	          NULL,
 	          0,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( expected_size > 0 )
 	{
+		result = libvsgpt_volume_for_each_partition_parallel(
+		          volume,
+		          &vsgpt_test_volume_failing_chunk_callback,
+		          NULL,
+		          4,
+		          &error );
+
 		VSGPT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
@@ -2427,8 +5983,6 @@ int vsgpt_test_volume_has_partition_with_identifier(
 		libcerror_error_free(
 		 &error );
 	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
-
 	return( 1 );
 
 on_error:
@@ -2437,25 +5991,59 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libvsgpt_volume_get_partition_by_identifier function
+/* Test compare callback function that counts the ranges of differing data
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpt_test_volume_count_ranges_callback(
+     int partition_index VSGPT_TEST_ATTRIBUTE_UNUSED,
+     int compare_partition_index VSGPT_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset VSGPT_TEST_ATTRIBUTE_UNUSED,
+     size64_t size VSGPT_TEST_ATTRIBUTE_UNUSED,
+     void *user_data,
+     libcerror_error_t **error VSGPT_TEST_ATTRIBUTE_UNUSED )
+{
+	VSGPT_TEST_UNREFERENCED_PARAMETER( partition_index )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( compare_partition_index )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( offset )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( size )
+	VSGPT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) user_data ) += 1;
+
+	return( 1 );
+}
+
+/* Tests the libvsgpt_volume_compare function
  * Returns 1 if successful or 0 if not
  */
-int vsgpt_test_volume_get_partition_by_identifier(
+int vsgpt_test_volume_compare(
      libvsgpt_volume_t *volume )
 {
-	libcerror_error_t *error        = NULL;
-	libvsgpt_partition_t *partition = 0;
-	int result                      = 0;
+	libcerror_error_t *error = NULL;
+	int number_of_ranges     = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          volume,
-	          0,
-	          &partition,
+	          volume,
+	          &vsgpt_test_volume_count_ranges_callback,
+	          (void *) &number_of_ranges,
+	          1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2463,36 +6051,31 @@ int vsgpt_test_volume_get_partition_by_identifier(
 	 result,
 	 1 );
 
-	VSGPT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	VSGPT_TEST_ASSERT_IS_NOT_NULL(
-	 "partition",
-	 partition );
-
-	result = libvsgpt_partition_free(
-	          &partition,
-	          &error );
-
 	VSGPT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          volume,
-	          0xffffffffUL,
-	          &partition,
+	          volume,
+	          &vsgpt_test_volume_count_ranges_callback,
+	          (void *) &number_of_ranges,
+	          4,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
+	 1 );
+
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
 	 0 );
 
 	VSGPT_TEST_ASSERT_IS_NULL(
@@ -2501,10 +6084,12 @@ int vsgpt_test_volume_get_partition_by_identifier(
 
 	/* Test error cases
 	 */
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          NULL,
-	          0,
-	          &partition,
+	          volume,
+	          &vsgpt_test_volume_count_ranges_callback,
+	          (void *) &number_of_ranges,
+	          1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2519,10 +6104,12 @@ int vsgpt_test_volume_get_partition_by_identifier(
 	libcerror_error_free(
 	 &error );
 
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          volume,
-	          0,
 	          NULL,
+	          &vsgpt_test_volume_count_ranges_callback,
+	          (void *) &number_of_ranges,
+	          1,
 	          &error );
 
 	VSGPT_TEST_ASSERT_EQUAL_INT(
@@ -2537,16 +6124,14 @@ int vsgpt_test_volume_get_partition_by_identifier(
 	libcerror_error_free(
 	 &error );
 
-	partition = (libvsgpt_partition_t *) 0x12345678UL;
-
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          volume,
-	          0,
-	          &partition,
+	          volume,
+	          NULL,
+	          NULL,
+	          1,
 	          &error );
 
-	partition = NULL;
-
 	VSGPT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2559,65 +6144,25 @@ int vsgpt_test_volume_get_partition_by_identifier(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_VSGPT_TEST_RWLOCK_HOOK )
-
-	/* Test libvsgpt_volume_get_partition_by_identifier with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_get_partition_by_identifier(
+	result = libvsgpt_volume_compare(
 	          volume,
-	          0,
-	          &partition,
-	          &error );
-
-	if( vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libvsgpt_volume_get_partition_by_identifier with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	result = libvsgpt_volume_get_partition_by_identifier(
 	          volume,
+	          &vsgpt_test_volume_count_ranges_callback,
+	          (void *) &number_of_ranges,
 	          0,
-	          &partition,
 	          &error );
 
-	if( vsgpt_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		vsgpt_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		VSGPT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSGPT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSGPT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSGPT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_VSGPT_TEST_RWLOCK_HOOK ) */
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -2687,6 +6232,22 @@ int main(
 	 "libvsgpt_volume_free",
 	 vsgpt_test_volume_free );
 
+#if defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT )
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_volume_read_partition_entries",
+	 vsgpt_test_internal_volume_read_partition_entries );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_volume_read_backup_partition_table",
+	 vsgpt_test_internal_volume_read_backup_partition_table );
+
+	VSGPT_TEST_RUN(
+	 "libvsgpt_internal_volume_read_mbr_partition_entries",
+	 vsgpt_test_internal_volume_read_mbr_partition_entries );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2766,6 +6327,16 @@ int main(
 		 vsgpt_test_volume_open_file_io_handle,
 		 source );
 
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_open_buffer",
+		 vsgpt_test_volume_open_buffer,
+		 file_io_handle );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_open_with_layout",
+		 vsgpt_test_volume_open_with_layout,
+		 file_io_handle );
+
 		VSGPT_TEST_RUN(
 		 "libvsgpt_volume_close",
 		 vsgpt_test_volume_close );
@@ -2787,10 +6358,6 @@ int main(
 		 vsgpt_test_internal_volume_read_partition_table_headers,
 		 source );
 
-		/* TODO add tests for libvsgpt_internal_volume_read_partition_entries */
-
-		/* TODO add tests for libvsgpt_internal_volume_read_mbr_partition_entries */
-
 #endif /* defined( __GNUC__ ) && !defined( LIBVSGPT_DLL_IMPORT ) */
 
 		/* Initialize volume for tests
@@ -2813,11 +6380,44 @@ int main(
 		 "error",
 		 error );
 
+		/* Run before the libvsgpt_volume_signal_abort test since
+		 * a signalled abort stops processing partitions
+		 */
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_for_each_partition_parallel",
+		 vsgpt_test_volume_for_each_partition_parallel,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_compare",
+		 vsgpt_test_volume_compare,
+		 volume );
+
 		VSGPT_TEST_RUN_WITH_ARGS(
 		 "libvsgpt_volume_signal_abort",
 		 vsgpt_test_volume_signal_abort,
 		 volume );
 
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_set_trace_callback",
+		 vsgpt_test_volume_set_trace_callback,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_set_timeout",
+		 vsgpt_test_volume_set_timeout,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_set_recovery_mode",
+		 vsgpt_test_volume_set_recovery_mode,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_is_corrupted",
+		 vsgpt_test_volume_is_corrupted,
+		 volume );
+
 		VSGPT_TEST_RUN_WITH_ARGS(
 		 "libvsgpt_volume_get_bytes_per_sector",
 		 vsgpt_test_volume_get_bytes_per_sector,
@@ -2847,6 +6447,21 @@ int main(
 		 vsgpt_test_volume_get_partition_by_identifier,
 		 volume );
 
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_get_partition_index_by_volume_offset",
+		 vsgpt_test_volume_get_partition_index_by_volume_offset,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_get_partition_by_volume_offset",
+		 vsgpt_test_volume_get_partition_by_volume_offset,
+		 volume );
+
+		VSGPT_TEST_RUN_WITH_ARGS(
+		 "libvsgpt_volume_get_partition_indexes_by_volume_offsets",
+		 vsgpt_test_volume_get_partition_indexes_by_volume_offsets,
+		 volume );
+
 		/* Clean up
 		 */
 		result = vsgpt_test_volume_close_source(
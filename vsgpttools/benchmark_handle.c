@@ -0,0 +1,1108 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#include <time.h>
+
+#include "benchmark_handle.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#define BENCHMARK_HANDLE_NOTIFY_STREAM	stdout
+
+/* The block sizes that are benchmarked
+ */
+static const size_t benchmark_handle_block_sizes[ BENCHMARK_HANDLE_NUMBER_OF_BLOCK_SIZES ] = {
+	512, 4096, 65536, BENCHMARK_HANDLE_MAXIMUM_BLOCK_SIZE };
+
+/* Creates a benchmark handle
+ * Make sure the value benchmark_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int benchmark_handle_initialize(
+     benchmark_handle_t **benchmark_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "benchmark_handle_initialize";
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *benchmark_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid benchmark handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*benchmark_handle = memory_allocate_structure(
+	                     benchmark_handle_t );
+
+	if( *benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create benchmark handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *benchmark_handle,
+	     0,
+	     sizeof( benchmark_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear benchmark handle.",
+		 function );
+
+		memory_free(
+		 *benchmark_handle );
+
+		*benchmark_handle = NULL;
+
+		return( -1 );
+	}
+	( *benchmark_handle )->buffer = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * BENCHMARK_HANDLE_MAXIMUM_BLOCK_SIZE );
+
+	if( ( *benchmark_handle )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_initialize(
+	     &( ( *benchmark_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *benchmark_handle )->notify_stream     = BENCHMARK_HANDLE_NOTIFY_STREAM;
+	( *benchmark_handle )->maximum_read_size = BENCHMARK_HANDLE_MAXIMUM_READ_SIZE;
+
+	/* A fixed seed makes the random offsets reproducible between runs
+	 */
+	( *benchmark_handle )->random_state = 0x9e3779b97f4a7c15ULL;
+
+	return( 1 );
+
+on_error:
+	if( *benchmark_handle != NULL )
+	{
+		if( ( *benchmark_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *benchmark_handle )->buffer );
+		}
+		memory_free(
+		 *benchmark_handle );
+
+		*benchmark_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a benchmark handle
+ * Returns 1 if successful or -1 on error
+ */
+int benchmark_handle_free(
+     benchmark_handle_t **benchmark_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "benchmark_handle_free";
+	int result            = 1;
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *benchmark_handle != NULL )
+	{
+		if( ( *benchmark_handle )->input_volume != NULL )
+		{
+			if( libvsgpt_volume_free(
+			     &( ( *benchmark_handle )->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *benchmark_handle )->buffer );
+
+		memory_free(
+		 *benchmark_handle );
+
+		*benchmark_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the benchmark handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int benchmark_handle_signal_abort(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "benchmark_handle_signal_abort";
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	benchmark_handle->abort = 1;
+
+	if( benchmark_handle->input_volume != NULL )
+	{
+		if( libvsgpt_volume_signal_abort(
+		     benchmark_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the input and measures the open time
+ * Returns 1 if successful or -1 on error
+ */
+int benchmark_handle_open_input(
+     benchmark_handle_t *benchmark_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "benchmark_handle_open_input";
+	int64_t start_time    = 0;
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = benchmark_handle_get_current_time();
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsgpt_volume_open_wide(
+	     benchmark_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsgpt_volume_open(
+	     benchmark_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		return( -1 );
+	}
+	benchmark_handle->open_time = benchmark_handle_get_current_time() - start_time;
+
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int benchmark_handle_close_input(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "benchmark_handle_close_input";
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_close(
+	     benchmark_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a string containing the description of an access type
+ * Returns a string
+ */
+const char *benchmark_handle_get_access_type_description(
+             int access_type )
+{
+	switch( access_type )
+	{
+		case BENCHMARK_ACCESS_TYPE_SEQUENTIAL:
+			return( "sequential" );
+
+		case BENCHMARK_ACCESS_TYPE_RANDOM:
+			return( "random" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Determines the number of sectors that contain the data of a read
+ * Returns the number of sectors
+ */
+uint64_t benchmark_handle_get_number_of_sectors(
+          off64_t offset,
+          size_t size,
+          size_t sector_size )
+{
+	uint64_t first_sector_index = 0;
+	uint64_t last_sector_index  = 0;
+
+	if( ( offset < 0 )
+	 || ( size == 0 )
+	 || ( sector_size == 0 ) )
+	{
+		return( 0 );
+	}
+	first_sector_index = (uint64_t) offset / sector_size;
+	last_sector_index  = ( (uint64_t) offset + size - 1 ) / sector_size;
+
+	return( last_sector_index - first_sector_index + 1 );
+}
+
+/* Determines a pseudo random offset of a block within the data
+ * The offset is a multiple of the block size
+ * Returns the offset or -1 if the data does not contain a block
+ */
+off64_t benchmark_handle_get_random_offset(
+         benchmark_handle_t *benchmark_handle,
+         size64_t data_size,
+         size_t block_size )
+{
+	uint64_t number_of_blocks = 0;
+	uint64_t random_value     = 0;
+
+	if( ( benchmark_handle == NULL )
+	 || ( block_size == 0 ) )
+	{
+		return( -1 );
+	}
+	number_of_blocks = data_size / block_size;
+
+	if( number_of_blocks == 0 )
+	{
+		return( -1 );
+	}
+	/* xorshift64
+	 */
+	random_value  = benchmark_handle->random_state;
+	random_value ^= random_value << 13;
+	random_value ^= random_value >> 7;
+	random_value ^= random_value << 17;
+
+	benchmark_handle->random_state = random_value;
+
+	return( (off64_t) ( ( random_value % number_of_blocks ) * block_size ) );
+}
+
+/* Reads the data of a partition and measures the read throughput
+ * A new partition is retrieved for every run so that the run starts with a cold sector cache
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int benchmark_handle_read_partition(
+     benchmark_handle_t *benchmark_handle,
+     int partition_index,
+     int access_type,
+     size_t block_size,
+     benchmark_result_t *benchmark_result,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_t *partition   = NULL;
+	static char *function             = "benchmark_handle_read_partition";
+	size64_t partition_size           = 0;
+	size64_t remaining_size           = 0;
+	size_t cache_sector_size          = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off64_t read_offset               = 0;
+	int64_t start_system_time         = 0;
+	int64_t start_time                = 0;
+	int64_t start_user_time           = 0;
+	int64_t system_time               = 0;
+	int64_t user_time                 = 0;
+	int number_of_deduplicated_misses = 0;
+	int number_of_sector_reads        = 0;
+	int result                        = 1;
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_type != BENCHMARK_ACCESS_TYPE_SEQUENTIAL )
+	 && ( access_type != BENCHMARK_ACCESS_TYPE_RANDOM ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > BENCHMARK_HANDLE_MAXIMUM_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( benchmark_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark result.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     benchmark_result,
+	     0,
+	     sizeof( benchmark_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear benchmark result.",
+		 function );
+
+		return( -1 );
+	}
+	benchmark_result->access_type = access_type;
+	benchmark_result->block_size  = block_size;
+
+	if( libvsgpt_volume_get_partition_by_index(
+	     benchmark_handle->input_volume,
+	     partition_index,
+	     &partition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_get_cache_statistics(
+	     partition,
+	     &cache_sector_size,
+	     &number_of_sector_reads,
+	     &number_of_deduplicated_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	benchmark_result->number_of_sector_reads        = (uint64_t) number_of_sector_reads;
+	benchmark_result->number_of_deduplicated_misses = (uint64_t) number_of_deduplicated_misses;
+
+	remaining_size = partition_size;
+
+	if( remaining_size > benchmark_handle->maximum_read_size )
+	{
+		remaining_size = benchmark_handle->maximum_read_size;
+	}
+	benchmark_handle_get_process_times(
+	 &start_user_time,
+	 &start_system_time );
+
+	start_time = benchmark_handle_get_current_time();
+
+	while( remaining_size > 0 )
+	{
+		if( benchmark_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		read_size = block_size;
+
+		if( access_type == BENCHMARK_ACCESS_TYPE_RANDOM )
+		{
+			/* At least 1 block is read if the remaining size is smaller than the block size
+			 */
+			if( ( (size64_t) read_size > remaining_size )
+			 && ( benchmark_result->number_of_reads > 0 ) )
+			{
+				break;
+			}
+			read_offset = benchmark_handle_get_random_offset(
+			               benchmark_handle,
+			               partition_size,
+			               block_size );
+
+			if( read_offset < 0 )
+			{
+				/* The partition is smaller than the block size
+				 */
+				break;
+			}
+		}
+		else if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libvsgpt_partition_read_buffer_at_offset(
+		              partition,
+		              benchmark_handle->buffer,
+		              read_size,
+		              read_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			if( benchmark_handle->abort != 0 )
+			{
+				libcerror_error_free(
+				 error );
+
+				result = 0;
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		benchmark_result->number_of_reads             += 1;
+		benchmark_result->read_size                   += read_size;
+		benchmark_result->number_of_requested_sectors += benchmark_handle_get_number_of_sectors(
+		                                                  read_offset,
+		                                                  read_size,
+		                                                  cache_sector_size );
+
+		if( access_type == BENCHMARK_ACCESS_TYPE_SEQUENTIAL )
+		{
+			read_offset += read_size;
+		}
+		if( (size64_t) read_size > remaining_size )
+		{
+			break;
+		}
+		remaining_size -= read_size;
+	}
+	benchmark_result->elapsed_time = benchmark_handle_get_current_time() - start_time;
+
+	benchmark_handle_get_process_times(
+	 &user_time,
+	 &system_time );
+
+	benchmark_result->user_time   = user_time - start_user_time;
+	benchmark_result->system_time = system_time - start_system_time;
+
+	if( libvsgpt_partition_get_cache_statistics(
+	     partition,
+	     &cache_sector_size,
+	     &number_of_sector_reads,
+	     &number_of_deduplicated_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	benchmark_result->number_of_sector_reads        = (uint64_t) number_of_sector_reads - benchmark_result->number_of_sector_reads;
+	benchmark_result->number_of_deduplicated_misses = (uint64_t) number_of_deduplicated_misses - benchmark_result->number_of_deduplicated_misses;
+
+	if( libvsgpt_partition_free(
+	     &partition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints a benchmark result
+ * For JSON the result is printed as an object, where result_index is used to separate the objects
+ */
+void benchmark_handle_result_fprint(
+      benchmark_handle_t *benchmark_handle,
+      benchmark_result_t *benchmark_result,
+      int result_index )
+{
+	double cache_hit_rate = 0.0;
+	double throughput     = 0.0;
+
+	if( ( benchmark_handle == NULL )
+	 || ( benchmark_result == NULL ) )
+	{
+		return;
+	}
+	if( benchmark_result->elapsed_time > 0 )
+	{
+		throughput = ( (double) benchmark_result->read_size * 1000000.0 ) / (double) benchmark_result->elapsed_time;
+	}
+	if( ( benchmark_result->number_of_requested_sectors > 0 )
+	 && ( benchmark_result->number_of_sector_reads < benchmark_result->number_of_requested_sectors ) )
+	{
+		cache_hit_rate = (double) ( benchmark_result->number_of_requested_sectors - benchmark_result->number_of_sector_reads )
+		               / (double) benchmark_result->number_of_requested_sectors;
+	}
+	if( benchmark_handle->output_json != 0 )
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "%s{\"access\":\"%s\",\"block_size\":%" PRIzu ",\"number_of_reads\":%" PRIu64 ",\"read_size\":%" PRIu64 ","
+		 "\"elapsed_time\":%" PRIi64 ",\"throughput\":%.0f,\"requested_sectors\":%" PRIu64 ",\"sector_reads\":%" PRIu64 ","
+		 "\"deduplicated_misses\":%" PRIu64 ",\"cache_hit_rate\":%.4f,\"user_time\":%" PRIi64 ",\"system_time\":%" PRIi64 "}",
+		 ( result_index > 0 ) ? "," : "",
+		 benchmark_handle_get_access_type_description(
+		  benchmark_result->access_type ),
+		 benchmark_result->block_size,
+		 benchmark_result->number_of_reads,
+		 benchmark_result->read_size,
+		 benchmark_result->elapsed_time,
+		 throughput,
+		 benchmark_result->number_of_requested_sectors,
+		 benchmark_result->number_of_sector_reads,
+		 benchmark_result->number_of_deduplicated_misses,
+		 cache_hit_rate,
+		 benchmark_result->user_time,
+		 benchmark_result->system_time );
+	}
+	else
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\t%-10s\t%10" PRIzu "\t%12" PRIu64 "\t%10" PRIi64 "\t%10.1f\t%7.2f%%\t%12" PRIu64 "\t%10" PRIi64 "\t%10" PRIi64 "\n",
+		 benchmark_handle_get_access_type_description(
+		  benchmark_result->access_type ),
+		 benchmark_result->block_size,
+		 benchmark_result->read_size,
+		 benchmark_result->elapsed_time,
+		 throughput / ( 1024.0 * 1024.0 ),
+		 cache_hit_rate * 100.0,
+		 benchmark_result->number_of_deduplicated_misses,
+		 benchmark_result->user_time,
+		 benchmark_result->system_time );
+	}
+}
+
+/* Benchmarks the reads of all partitions for every access type and block size
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int benchmark_handle_benchmark_partitions(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error )
+{
+	benchmark_result_t benchmark_result;
+
+	libvsgpt_partition_t *partition = NULL;
+	static char *function           = "benchmark_handle_benchmark_partitions";
+	size64_t partition_size         = 0;
+	int64_t start_system_time       = 0;
+	int64_t start_user_time         = 0;
+	int64_t system_time             = 0;
+	int64_t user_time               = 0;
+	int access_type                 = 0;
+	int block_size_index            = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int result                      = 1;
+	int result_index                = 0;
+
+	if( benchmark_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     benchmark_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	benchmark_handle_get_process_times(
+	 &start_user_time,
+	 &start_system_time );
+
+	if( benchmark_handle->output_json != 0 )
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "{\"open_time\":%" PRIi64 ",\"number_of_partitions\":%d,\"partitions\":[",
+		 benchmark_handle->open_time,
+		 number_of_partitions );
+	}
+	else
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "Read benchmark:\n" );
+
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\tOpen time\t\t: %" PRIi64 " us\n",
+		 benchmark_handle->open_time );
+
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\tNumber of partitions\t: %d\n",
+		 number_of_partitions );
+
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\n" );
+	}
+	for( partition_index = 0;
+	     ( result == 1 ) && ( partition_index < number_of_partitions );
+	     partition_index++ )
+	{
+		if( libvsgpt_volume_get_partition_by_index(
+		     benchmark_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_size(
+		     partition,
+		     &partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_free(
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( benchmark_handle->output_json != 0 )
+		{
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "%s{\"number\":%d,\"size\":%" PRIu64 ",\"results\":[",
+			 ( partition_index > 0 ) ? "," : "",
+			 partition_index + 1,
+			 partition_size );
+		}
+		else
+		{
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "Partition: %d\n",
+			 partition_index + 1 );
+
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "\tSize\t\t\t: %" PRIu64 "\n",
+			 partition_size );
+
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "\t%-10s\t%10s\t%12s\t%10s\t%10s\t%8s\t%12s\t%10s\t%10s\n",
+			 "Access",
+			 "Block size",
+			 "Bytes read",
+			 "Time (us)",
+			 "MiB/s",
+			 "Hit rate",
+			 "Dedup misses",
+			 "User (us)",
+			 "Sys (us)" );
+		}
+		result_index = 0;
+
+		for( access_type = BENCHMARK_ACCESS_TYPE_SEQUENTIAL;
+		     ( result == 1 ) && ( access_type <= BENCHMARK_ACCESS_TYPE_RANDOM );
+		     access_type++ )
+		{
+			for( block_size_index = 0;
+			     block_size_index < BENCHMARK_HANDLE_NUMBER_OF_BLOCK_SIZES;
+			     block_size_index++ )
+			{
+				result = benchmark_handle_read_partition(
+				          benchmark_handle,
+				          partition_index,
+				          access_type,
+				          benchmark_handle_block_sizes[ block_size_index ],
+				          &benchmark_result,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to benchmark partition: %d.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+				benchmark_handle_result_fprint(
+				 benchmark_handle,
+				 &benchmark_result,
+				 result_index );
+
+				result_index++;
+			}
+		}
+		if( benchmark_handle->output_json != 0 )
+		{
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "]}" );
+		}
+		else
+		{
+			fprintf(
+			 benchmark_handle->notify_stream,
+			 "\n" );
+		}
+	}
+	benchmark_handle_get_process_times(
+	 &user_time,
+	 &system_time );
+
+	if( benchmark_handle->output_json != 0 )
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "],\"user_time\":%" PRIi64 ",\"system_time\":%" PRIi64 "}\n",
+		 user_time - start_user_time,
+		 system_time - start_system_time );
+	}
+	else
+	{
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\tUser time\t\t: %" PRIi64 " us\n",
+		 user_time - start_user_time );
+
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\tSystem time\t\t: %" PRIi64 " us\n",
+		 system_time - start_system_time );
+
+		fprintf(
+		 benchmark_handle->notify_stream,
+		 "\n" );
+	}
+	return( result );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ * Returns the current time
+ */
+int64_t benchmark_handle_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( (int64_t) time( NULL ) * 1000000 );
+#endif
+}
+
+/* Retrieves the user and system time used by the process in microseconds
+ * Both are 0 if not supported on the platform
+ */
+void benchmark_handle_get_process_times(
+      int64_t *user_time,
+      int64_t *system_time )
+{
+#if defined( WINAPI )
+	FILETIME creation_time;
+	FILETIME exit_time;
+	FILETIME kernel_time;
+	FILETIME process_user_time;
+
+#elif defined( HAVE_GETRUSAGE ) && defined( HAVE_SYS_RESOURCE_H )
+	struct rusage resource_usage;
+#endif
+
+	if( ( user_time == NULL )
+	 || ( system_time == NULL ) )
+	{
+		return;
+	}
+	*user_time   = 0;
+	*system_time = 0;
+
+#if defined( WINAPI )
+	if( GetProcessTimes(
+	     GetCurrentProcess(),
+	     &creation_time,
+	     &exit_time,
+	     &kernel_time,
+	     &process_user_time ) != 0 )
+	{
+		/* The FILETIME values are in 100 nanosecond intervals
+		 */
+		*user_time   = (int64_t) ( ( ( (uint64_t) process_user_time.dwHighDateTime << 32 ) | process_user_time.dwLowDateTime ) / 10 );
+		*system_time = (int64_t) ( ( ( (uint64_t) kernel_time.dwHighDateTime << 32 ) | kernel_time.dwLowDateTime ) / 10 );
+	}
+#elif defined( HAVE_GETRUSAGE ) && defined( HAVE_SYS_RESOURCE_H )
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) == 0 )
+	{
+		*user_time   = ( (int64_t) resource_usage.ru_utime.tv_sec * 1000000 ) + (int64_t) resource_usage.ru_utime.tv_usec;
+		*system_time = ( (int64_t) resource_usage.ru_stime.tv_sec * 1000000 ) + (int64_t) resource_usage.ru_stime.tv_usec;
+	}
+#endif
+}
+
@@ -0,0 +1,200 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _BENCHMARK_HANDLE_H )
+#define _BENCHMARK_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of block sizes that are benchmarked
+ */
+#define BENCHMARK_HANDLE_NUMBER_OF_BLOCK_SIZES		4
+
+/* The largest block size that is benchmarked
+ */
+#define BENCHMARK_HANDLE_MAXIMUM_BLOCK_SIZE		( 1024 * 1024 )
+
+/* The maximum number of bytes read per partition, access type and block size
+ */
+#define BENCHMARK_HANDLE_MAXIMUM_READ_SIZE		( 64 * 1024 * 1024 )
+
+enum BENCHMARK_ACCESS_TYPES
+{
+	BENCHMARK_ACCESS_TYPE_SEQUENTIAL		= 0,
+	BENCHMARK_ACCESS_TYPE_RANDOM			= 1
+};
+
+typedef struct benchmark_result benchmark_result_t;
+
+struct benchmark_result
+{
+	/* The access type
+	 */
+	int access_type;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	size64_t read_size;
+
+	/* The elapsed time in microseconds
+	 */
+	int64_t elapsed_time;
+
+	/* The user time in microseconds
+	 */
+	int64_t user_time;
+
+	/* The system time in microseconds
+	 */
+	int64_t system_time;
+
+	/* The number of cache sectors that were requested
+	 */
+	uint64_t number_of_requested_sectors;
+
+	/* The number of cache sectors that were read from the file IO handle
+	 */
+	uint64_t number_of_sector_reads;
+
+	/* The number of cache misses that waited for a read of the same sector by another thread
+	 */
+	uint64_t number_of_deduplicated_misses;
+};
+
+typedef struct benchmark_handle benchmark_handle_t;
+
+struct benchmark_handle
+{
+	/* The libvsgpt input volume
+	 */
+	libvsgpt_volume_t *input_volume;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The maximum number of bytes read per partition, access type and block size
+	 */
+	size64_t maximum_read_size;
+
+	/* Value to indicate the results should be written as JSON
+	 */
+	uint8_t output_json;
+
+	/* The state of the pseudo random number generator for random offsets
+	 */
+	uint64_t random_state;
+
+	/* The open time in microseconds
+	 */
+	int64_t open_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int benchmark_handle_initialize(
+     benchmark_handle_t **benchmark_handle,
+     libcerror_error_t **error );
+
+int benchmark_handle_free(
+     benchmark_handle_t **benchmark_handle,
+     libcerror_error_t **error );
+
+int benchmark_handle_signal_abort(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error );
+
+int benchmark_handle_open_input(
+     benchmark_handle_t *benchmark_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int benchmark_handle_close_input(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error );
+
+const char *benchmark_handle_get_access_type_description(
+             int access_type );
+
+uint64_t benchmark_handle_get_number_of_sectors(
+          off64_t offset,
+          size_t size,
+          size_t sector_size );
+
+off64_t benchmark_handle_get_random_offset(
+         benchmark_handle_t *benchmark_handle,
+         size64_t data_size,
+         size_t block_size );
+
+int benchmark_handle_read_partition(
+     benchmark_handle_t *benchmark_handle,
+     int partition_index,
+     int access_type,
+     size_t block_size,
+     benchmark_result_t *benchmark_result,
+     libcerror_error_t **error );
+
+void benchmark_handle_result_fprint(
+      benchmark_handle_t *benchmark_handle,
+      benchmark_result_t *benchmark_result,
+      int result_index );
+
+int benchmark_handle_benchmark_partitions(
+     benchmark_handle_t *benchmark_handle,
+     libcerror_error_t **error );
+
+int64_t benchmark_handle_get_current_time(
+         void );
+
+void benchmark_handle_get_process_times(
+      int64_t *user_time,
+      int64_t *system_time );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCHMARK_HANDLE_H ) */
+
@@ -0,0 +1,875 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "carve_handle.h"
+#include "vsgpttools_libbfio.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libfguid.h"
+#include "vsgpttools_libvsgpt.h"
+
+#define CARVE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a carve handle
+ * Make sure the value carve_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_initialize";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_handle = memory_allocate_structure(
+	                 carve_handle_t );
+
+	if( *carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carve_handle,
+	     0,
+	     sizeof( carve_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->notify_stream = CARVE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *carve_handle != NULL )
+	{
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a carve handle
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_free";
+	int result            = 1;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		if( ( *carve_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *carve_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( result );
+}
+
+/* Parses an offset from a string
+ * The offset is either decimal or hexadecimal with a 0x prefix
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_parse_offset(
+     const system_character_t *string,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_parse_offset";
+	size_t string_index   = 0;
+	uint64_t base         = 10;
+	uint64_t digit        = 0;
+	uint64_t safe_offset  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string[ 0 ] == (system_character_t) '0' )
+	 && ( ( string[ 1 ] == (system_character_t) 'x' )
+	  || ( string[ 1 ] == (system_character_t) 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string[ string_index ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	while( string[ string_index ] != 0 )
+	{
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'a' )
+		      && ( string[ string_index ] <= (system_character_t) 'f' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) 'a' ) + 10;
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'A' )
+		      && ( string[ string_index ] <= (system_character_t) 'F' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) 'A' ) + 10;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		if( safe_offset > ( ( (uint64_t) INT64_MAX - digit ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_offset *= base;
+		safe_offset += digit;
+
+		string_index++;
+	}
+	*offset = (off64_t) safe_offset;
+
+	return( 1 );
+}
+
+/* Signals the carve handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_signal_abort";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "carve_handle_open_input";
+	size_t filename_length = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - input file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     &( carve_handle->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     carve_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     carve_handle->input_file_io_handle,
+	     &( carve_handle->input_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( carve_handle->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_close_input";
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     carve_handle->input_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( carve_handle->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	carve_handle->input_size = 0;
+
+	return( result );
+}
+
+/* Prints a partition table header that was found by the scan
+ * Callback function for libvsgpt_scan_for_headers_file_io_handle
+ * Returns 1 to continue, 0 to stop the scan if abort was signalled or -1 on error
+ */
+int carve_handle_header_callback(
+     off64_t offset,
+     uint64_t header_block_number,
+     uint32_t sector_size,
+     const uint8_t *disk_identifier,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	system_character_t guid_string[ 48 ];
+
+	libfguid_identifier_t *guid  = NULL;
+	carve_handle_t *carve_handle = NULL;
+	static char *function        = "carve_handle_header_callback";
+	int result                   = 0;
+
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle = (carve_handle_t *) user_data;
+
+	if( carve_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( disk_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     guid,
+	     disk_identifier,
+	     16,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfguid_identifier_copy_to_utf16_string(
+		  guid,
+		  (uint16_t *) guid_string,
+		  48,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#else
+	result = libfguid_identifier_copy_to_utf8_string(
+		  guid,
+		  (uint8_t *) guid_string,
+		  48,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	carve_handle->number_of_headers += 1;
+
+	fprintf(
+	 carve_handle->output_stream,
+	 "Partition table header: %d\n",
+	 carve_handle->number_of_headers );
+
+	fprintf(
+	 carve_handle->output_stream,
+	 "\tOffset\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+	 offset,
+	 offset );
+
+	fprintf(
+	 carve_handle->output_stream,
+	 "\tHeader block number\t: %" PRIu64 "\n",
+	 header_block_number );
+
+	if( sector_size == 0 )
+	{
+		fprintf(
+		 carve_handle->output_stream,
+		 "\tImplied sector size\t: unknown\n" );
+	}
+	else
+	{
+		fprintf(
+		 carve_handle->output_stream,
+		 "\tImplied sector size\t: %" PRIu32 " bytes\n",
+		 sector_size );
+	}
+	fprintf(
+	 carve_handle->output_stream,
+	 "\tDisk identifier\t\t: %" PRIs_SYSTEM "\n",
+	 guid_string );
+
+	fprintf(
+	 carve_handle->output_stream,
+	 "\n" );
+
+	if( carve_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the input for partition table headers
+ * The input is scanned in ranges, in between which the progress is printed
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int carve_handle_carve(
+     carve_handle_t *carve_handle,
+     off64_t start_offset,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_carve";
+	size64_t range_size   = 0;
+	off64_t range_offset  = 0;
+	int64_t start_time    = 0;
+	int percentage        = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( start_offset < 0 )
+	 || ( (size64_t) start_offset > carve_handle->input_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->output_stream     = stream;
+	carve_handle->last_percentage   = 0;
+	carve_handle->number_of_headers = 0;
+	carve_handle->scanned_size      = 0;
+
+	start_time   = carve_handle_get_current_time();
+	range_offset = start_offset;
+
+	while( (size64_t) range_offset < carve_handle->input_size )
+	{
+		if( carve_handle->abort != 0 )
+		{
+			break;
+		}
+		range_size = carve_handle->input_size - (size64_t) range_offset;
+
+		if( range_size > (size64_t) CARVE_HANDLE_RANGE_SIZE )
+		{
+			range_size = (size64_t) CARVE_HANDLE_RANGE_SIZE;
+		}
+		if( libvsgpt_scan_for_headers_file_io_handle(
+		     carve_handle->input_file_io_handle,
+		     range_offset,
+		     range_size,
+		     &carve_handle_header_callback,
+		     (void *) carve_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan for partition table headers at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 range_offset,
+			 range_offset );
+
+			goto on_error;
+		}
+		range_offset               += (off64_t) range_size;
+		carve_handle->scanned_size += range_size;
+
+		percentage = (int) ( ( (size64_t) range_offset * 100 ) / carve_handle->input_size );
+
+		if( percentage > carve_handle->last_percentage )
+		{
+			fprintf(
+			 carve_handle->notify_stream,
+			 "Status: scanned %d%%.\n",
+			 percentage );
+
+			carve_handle->last_percentage = percentage;
+		}
+	}
+	carve_handle->elapsed_time  = carve_handle_get_current_time() - start_time;
+	carve_handle->output_stream = NULL;
+
+	if( carve_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	carve_handle->output_stream = NULL;
+
+	return( -1 );
+}
+
+/* Prints a summary of the scan
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_summary_fprint(
+     carve_handle_t *carve_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_summary_fprint";
+	double throughput     = 0.0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->elapsed_time > 0 )
+	{
+		throughput = ( (double) carve_handle->scanned_size / ( 1024.0 * 1024.0 ) )
+		           / ( (double) carve_handle->elapsed_time / 1000000.0 );
+	}
+	fprintf(
+	 stream,
+	 "Carve summary:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of headers\t: %d\n",
+	 carve_handle->number_of_headers );
+
+	fprintf(
+	 stream,
+	 "\tScanned size\t\t: %" PRIu64 " bytes\n",
+	 carve_handle->scanned_size );
+
+	fprintf(
+	 stream,
+	 "\tElapsed time\t\t: %" PRIi64 ".%03" PRIi64 " seconds\n",
+	 carve_handle->elapsed_time / 1000000,
+	 ( carve_handle->elapsed_time % 1000000 ) / 1000 );
+
+	fprintf(
+	 stream,
+	 "\tThroughput\t\t: %.1f MiB/s\n",
+	 throughput );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ */
+int64_t carve_handle_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( (int64_t) time( NULL ) * 1000000 );
+#endif
+}
+
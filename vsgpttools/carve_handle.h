@@ -0,0 +1,137 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _CARVE_HANDLE_H )
+#define _CARVE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libbfio.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the ranges the input is scanned in, in between which
+ * the progress is printed and abort is checked
+ */
+#define CARVE_HANDLE_RANGE_SIZE		( 256 * 1024 * 1024 )
+
+typedef struct carve_handle carve_handle_t;
+
+struct carve_handle
+{
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The input size
+	 */
+	size64_t input_size;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The output stream of the headers that are found
+	 */
+	FILE *output_stream;
+
+	/* The last progress percentage that was printed
+	 */
+	int last_percentage;
+
+	/* The number of partition table headers found
+	 */
+	int number_of_headers;
+
+	/* The number of bytes scanned
+	 */
+	size64_t scanned_size;
+
+	/* The elapsed time in microseconds
+	 */
+	int64_t elapsed_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_parse_offset(
+     const system_character_t *string,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_header_callback(
+     off64_t offset,
+     uint64_t header_block_number,
+     uint32_t sector_size,
+     const uint8_t *disk_identifier,
+     void *user_data,
+     libcerror_error_t **error );
+
+int carve_handle_carve(
+     carve_handle_t *carve_handle,
+     off64_t start_offset,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int carve_handle_summary_fprint(
+     carve_handle_t *carve_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int64_t carve_handle_get_current_time(
+         void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CARVE_HANDLE_H ) */
+
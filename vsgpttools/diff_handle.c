@@ -0,0 +1,1094 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "diff_handle.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#define DIFF_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a diff handle
+ * Make sure the value diff_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_initialize";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > DIFF_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*diff_handle = memory_allocate_structure(
+	                diff_handle_t );
+
+	if( *diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *diff_handle,
+	     0,
+	     sizeof( diff_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff handle.",
+		 function );
+
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_initialize(
+	     &( ( *diff_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_initialize(
+	     &( ( *diff_handle )->compare_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize compare handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *diff_handle )->notify_stream     = DIFF_HANDLE_NOTIFY_STREAM;
+	( *diff_handle )->number_of_threads = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->input_volume != NULL )
+		{
+			libvsgpt_volume_free(
+			 &( ( *diff_handle )->input_volume ),
+			 NULL );
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a diff handle
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_free";
+	int result            = 1;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->compare_volume != NULL )
+		{
+			if( libvsgpt_volume_free(
+			     &( ( *diff_handle )->compare_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compare handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *diff_handle )->input_volume != NULL )
+		{
+			if( libvsgpt_volume_free(
+			     &( ( *diff_handle )->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *diff_handle )->ranges != NULL )
+		{
+			memory_free(
+			 ( *diff_handle )->ranges );
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( result );
+}
+
+/* Parses a number of threads from a string
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function      = "diff_handle_parse_number_of_threads";
+	size_t string_index        = 0;
+	int safe_number_of_threads = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_number_of_threads *= 10;
+		safe_number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_number_of_threads > DIFF_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			break;
+		}
+	}
+	if( ( safe_number_of_threads <= 0 )
+	 || ( safe_number_of_threads > DIFF_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = safe_number_of_threads;
+
+	return( 1 );
+}
+
+/* Signals the diff handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_signal_abort";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->abort = 1;
+
+	/* The comparison is aborted by the input volume, the compare volume
+	 * is signalled as well in case it is used by another operation
+	 */
+	if( diff_handle->input_volume != NULL )
+	{
+		if( libvsgpt_volume_signal_abort(
+		     diff_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( diff_handle->compare_volume != NULL )
+	{
+		if( libvsgpt_volume_signal_abort(
+		     diff_handle->compare_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal compare handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the input and the compare input
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *filename,
+     const system_character_t *compare_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_open_input";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsgpt_volume_open_wide(
+	     diff_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsgpt_volume_open(
+	     diff_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsgpt_volume_open_wide(
+	     diff_handle->compare_volume,
+	     compare_filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsgpt_volume_open(
+	     diff_handle->compare_volume,
+	     compare_filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open compare handle.",
+		 function );
+
+		libvsgpt_volume_close(
+		 diff_handle->input_volume,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input and the compare input
+ * Returns the 0 if successful or -1 on error
+ */
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_close_input";
+	int result            = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_close(
+	     diff_handle->compare_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close compare handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libvsgpt_volume_close(
+	     diff_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Appends a range of differing data
+ * The ranges are kept sorted by partition and offset, and overlapping or adjacent ranges
+ * of the same partitions are merged. Since the ranges are mostly reported in order,
+ * the position of a range is searched for from the end
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_append_range(
+     diff_handle_t *diff_handle,
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	diff_range_t *range            = NULL;
+	diff_range_t *ranges           = NULL;
+	static char *function          = "diff_handle_append_range";
+	size64_t range_end             = 0;
+	int move_index                 = 0;
+	int number_of_allocated_ranges = 0;
+	int range_index                = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	range_end = (size64_t) offset + size;
+
+	for( range_index = diff_handle->number_of_ranges;
+	     range_index > 0;
+	     range_index-- )
+	{
+		range = &( diff_handle->ranges[ range_index - 1 ] );
+
+		if( range->partition_index < partition_index )
+		{
+			break;
+		}
+		if( ( range->partition_index == partition_index )
+		 && ( range->compare_partition_index < compare_partition_index ) )
+		{
+			break;
+		}
+		if( ( range->partition_index == partition_index )
+		 && ( range->compare_partition_index == compare_partition_index )
+		 && ( range->offset <= offset ) )
+		{
+			break;
+		}
+	}
+	range = NULL;
+
+	if( range_index > 0 )
+	{
+		range = &( diff_handle->ranges[ range_index - 1 ] );
+
+		if( ( range->partition_index != partition_index )
+		 || ( range->compare_partition_index != compare_partition_index )
+		 || ( ( (size64_t) range->offset + range->size ) < (size64_t) offset ) )
+		{
+			range = NULL;
+		}
+	}
+	if( range != NULL )
+	{
+		/* Merge the range with the preceding range
+		 */
+		if( range_end > ( (size64_t) range->offset + range->size ) )
+		{
+			range->size = range_end - (size64_t) range->offset;
+		}
+		range_index -= 1;
+	}
+	else
+	{
+		if( diff_handle->number_of_ranges >= diff_handle->number_of_allocated_ranges )
+		{
+			number_of_allocated_ranges = diff_handle->number_of_allocated_ranges + DIFF_HANDLE_RANGES_ALLOCATION_INCREMENT;
+
+			if( ( number_of_allocated_ranges < diff_handle->number_of_allocated_ranges )
+			 || ( (size_t) number_of_allocated_ranges > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( diff_range_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of ranges value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			ranges = (diff_range_t *) memory_reallocate(
+			                           diff_handle->ranges,
+			                           sizeof( diff_range_t ) * number_of_allocated_ranges );
+
+			if( ranges == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize ranges.",
+				 function );
+
+				return( -1 );
+			}
+			diff_handle->ranges                     = ranges;
+			diff_handle->number_of_allocated_ranges = number_of_allocated_ranges;
+		}
+		for( move_index = diff_handle->number_of_ranges;
+		     move_index > range_index;
+		     move_index-- )
+		{
+			diff_handle->ranges[ move_index ] = diff_handle->ranges[ move_index - 1 ];
+		}
+		range = &( diff_handle->ranges[ range_index ] );
+
+		range->partition_index         = partition_index;
+		range->compare_partition_index = compare_partition_index;
+		range->offset                  = offset;
+		range->size                    = size;
+
+		diff_handle->number_of_ranges += 1;
+	}
+	/* Merge the succeeding ranges that overlap with or are adjacent to the range
+	 */
+	while( ( range_index + 1 ) < diff_handle->number_of_ranges )
+	{
+		range = &( diff_handle->ranges[ range_index ] );
+
+		if( ( range[ 1 ].partition_index != range->partition_index )
+		 || ( range[ 1 ].compare_partition_index != range->compare_partition_index )
+		 || ( (size64_t) range[ 1 ].offset > ( (size64_t) range->offset + range->size ) ) )
+		{
+			break;
+		}
+		range_end = (size64_t) range[ 1 ].offset + range[ 1 ].size;
+
+		if( range_end > ( (size64_t) range->offset + range->size ) )
+		{
+			range->size = range_end - (size64_t) range->offset;
+		}
+		for( move_index = range_index + 1;
+		     ( move_index + 1 ) < diff_handle->number_of_ranges;
+		     move_index++ )
+		{
+			diff_handle->ranges[ move_index ] = diff_handle->ranges[ move_index + 1 ];
+		}
+		diff_handle->number_of_ranges -= 1;
+	}
+	return( 1 );
+}
+
+/* Callback function for the ranges of differing data
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_range_callback(
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_range_callback";
+
+	if( diff_handle_append_range(
+	     (diff_handle_t *) user_data,
+	     partition_index,
+	     compare_partition_index,
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the partitions of the input volume
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_get_input_size(
+     diff_handle_t *diff_handle,
+     size64_t *input_size,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_t *partition = NULL;
+	static char *function           = "diff_handle_get_input_size";
+	size64_t partition_size         = 0;
+	size64_t safe_input_size        = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     diff_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsgpt_volume_get_partition_by_index(
+		     diff_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_size(
+		     partition,
+		     &partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		safe_input_size += partition_size;
+
+		if( libvsgpt_partition_free(
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	*input_size = safe_input_size;
+
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the partitions of the input with those of the compare input
+ * Returns 1 if the partitions are identical, 0 if they differ or -1 on error
+ */
+int diff_handle_diff(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_diff";
+	int64_t start_time    = 0;
+	int range_index       = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle_get_input_size(
+	     diff_handle,
+	     &( diff_handle->input_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input size.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->number_of_ranges = 0;
+	diff_handle->differing_size   = 0;
+
+	start_time = diff_handle_get_current_time();
+
+	/* The partition data is read and compared in chunks by multiple threads,
+	 * so that reading from the input and the compare input overlaps with comparing
+	 */
+	if( libvsgpt_volume_compare(
+	     diff_handle->input_volume,
+	     diff_handle->compare_volume,
+	     &diff_handle_range_callback,
+	     (void *) diff_handle,
+	     diff_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare volumes.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->elapsed_time = diff_handle_get_current_time() - start_time;
+
+	for( range_index = 0;
+	     range_index < diff_handle->number_of_ranges;
+	     range_index++ )
+	{
+		diff_handle->differing_size += diff_handle->ranges[ range_index ].size;
+	}
+	if( diff_handle->number_of_ranges != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Prints the ranges of differing data
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_ranges_fprint(
+     diff_handle_t *diff_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	diff_range_t *range   = NULL;
+	static char *function = "diff_handle_ranges_fprint";
+	int range_index       = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < diff_handle->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( diff_handle->ranges[ range_index ] );
+
+		fprintf(
+		 stream,
+		 "Differing range: %d\n",
+		 range_index + 1 );
+
+		if( range->partition_index == -1 )
+		{
+			fprintf(
+			 stream,
+			 "\tPartition\t\t: N/A\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\tPartition\t\t: %d\n",
+			 range->partition_index + 1 );
+		}
+		if( range->compare_partition_index == -1 )
+		{
+			fprintf(
+			 stream,
+			 "\tCompare partition\t: N/A\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\tCompare partition\t: %d\n",
+			 range->compare_partition_index + 1 );
+		}
+		fprintf(
+		 stream,
+		 "\tOffset\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 range->offset,
+		 range->offset );
+
+		fprintf(
+		 stream,
+		 "\tSize\t\t\t: %" PRIu64 " bytes\n",
+		 range->size );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Prints a summary of the diff
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_summary_fprint(
+     diff_handle_t *diff_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_summary_fprint";
+	double throughput     = 0.0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle->elapsed_time > 0 )
+	{
+		throughput = ( (double) diff_handle->input_size / ( 1024.0 * 1024.0 ) )
+		           / ( (double) diff_handle->elapsed_time / 1000000.0 );
+	}
+	fprintf(
+	 stream,
+	 "Diff summary:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of differing ranges\t: %d\n",
+	 diff_handle->number_of_ranges );
+
+	fprintf(
+	 stream,
+	 "\tDiffering size\t\t\t: %" PRIu64 " bytes\n",
+	 diff_handle->differing_size );
+
+	fprintf(
+	 stream,
+	 "\tInput size\t\t\t: %" PRIu64 " bytes\n",
+	 diff_handle->input_size );
+
+	fprintf(
+	 stream,
+	 "\tElapsed time\t\t\t: %" PRIi64 ".%03" PRIi64 " seconds\n",
+	 diff_handle->elapsed_time / 1000000,
+	 ( diff_handle->elapsed_time % 1000000 ) / 1000 );
+
+	fprintf(
+	 stream,
+	 "\tThroughput\t\t\t: %.1f MiB/s\n",
+	 throughput );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ * Returns the current time
+ */
+int64_t diff_handle_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( (int64_t) time( NULL ) * 1000000 );
+#endif
+}
+
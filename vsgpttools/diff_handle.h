@@ -0,0 +1,189 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIFF_HANDLE_H )
+#define _DIFF_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of threads
+ */
+#define DIFF_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+
+/* The maximum number of threads
+ */
+#define DIFF_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The number of ranges the ranges array is grown with
+ */
+#define DIFF_HANDLE_RANGES_ALLOCATION_INCREMENT		1024
+
+typedef struct diff_range diff_range_t;
+
+struct diff_range
+{
+	/* The index of the partition in the input volume, where -1 represents none
+	 */
+	int partition_index;
+
+	/* The index of the partition in the compare volume, where -1 represents none
+	 */
+	int compare_partition_index;
+
+	/* The offset relative to the start of the partition
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+typedef struct diff_handle diff_handle_t;
+
+struct diff_handle
+{
+	/* The libvsgpt input volume
+	 */
+	libvsgpt_volume_t *input_volume;
+
+	/* The libvsgpt compare volume
+	 */
+	libvsgpt_volume_t *compare_volume;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The differing ranges, sorted by partition and offset
+	 */
+	diff_range_t *ranges;
+
+	/* The number of differing ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated ranges
+	 */
+	int number_of_allocated_ranges;
+
+	/* The number of bytes that differ
+	 */
+	size64_t differing_size;
+
+	/* The number of bytes of the input partitions
+	 */
+	size64_t input_size;
+
+	/* The elapsed time in microseconds
+	 */
+	int64_t elapsed_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *filename,
+     const system_character_t *compare_filename,
+     libcerror_error_t **error );
+
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_append_range(
+     diff_handle_t *diff_handle,
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int diff_handle_range_callback(
+     int partition_index,
+     int compare_partition_index,
+     off64_t offset,
+     size64_t size,
+     void *user_data,
+     libcerror_error_t **error );
+
+int diff_handle_get_input_size(
+     diff_handle_t *diff_handle,
+     size64_t *input_size,
+     libcerror_error_t **error );
+
+int diff_handle_diff(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_ranges_fprint(
+     diff_handle_t *diff_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int diff_handle_summary_fprint(
+     diff_handle_t *diff_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int64_t diff_handle_get_current_time(
+         void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIFF_HANDLE_H ) */
+
@@ -0,0 +1,2935 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "export_handle.h"
+#include "vsgpttools_checksum.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libvsgpt.h"
+
+#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+
+#if defined( WINAPI )
+#define EXPORT_HANDLE_OPEN_READ_WRITE	"r+b"
+#else
+#define EXPORT_HANDLE_OPEN_READ_WRITE	"r+"
+#endif
+
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+#define export_handle_seek_offset( stream, offset ) \
+	_fseeki64( stream, (__int64) offset, SEEK_SET )
+#else
+#define export_handle_seek_offset( stream, offset ) \
+	file_stream_seek_offset( stream, (off_t) offset, SEEK_SET )
+#endif
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define export_handle_open_file( filename, mode ) \
+	file_stream_open_wide( filename, _SYSTEM_STRING( mode ) )
+#define export_handle_remove_file( filename ) \
+	_wremove( filename )
+#else
+#define export_handle_open_file( filename, mode ) \
+	file_stream_open( filename, mode )
+#define export_handle_remove_file( filename ) \
+	remove( filename )
+#endif
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_initialize(
+	     &( ( *export_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_handle )->buffers_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *export_handle )->buffers_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create buffers condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The CRC-32 table is computed here since the table is not protected
+	 * against concurrent initialization
+	 */
+	if( vsgpttools_checksum_crc32_table_computed == 0 )
+	{
+		vsgpttools_checksum_initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->number_of_threads = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_handle )->buffers_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *export_handle )->buffers_mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *export_handle )->input_volume != NULL )
+		{
+			libvsgpt_volume_free(
+			 &( ( *export_handle )->input_volume ),
+			 NULL );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( export_handle_free_buffers(
+		     *export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffers.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *export_handle )->read_error ) );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *export_handle )->buffers_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffers condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *export_handle )->buffers_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffers mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *export_handle )->input_volume != NULL )
+		{
+			if( libvsgpt_volume_free(
+			     &( ( *export_handle )->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Parses a number of threads from a string
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_parse_number_of_threads";
+	size_t string_index        = 0;
+	int safe_number_of_threads = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_number_of_threads *= 10;
+		safe_number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			break;
+		}
+	}
+	if( ( safe_number_of_threads <= 0 )
+	 || ( safe_number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = safe_number_of_threads;
+
+	return( 1 );
+}
+
+/* Parses a partition number from a string
+ * The partition number is 1-based, "all" is represented by 0
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_parse_partition_number(
+     const system_character_t *string,
+     int *partition_number,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_parse_partition_number";
+	size_t string_index       = 0;
+	int safe_partition_number = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string[ 0 ] == (system_character_t) 'a' )
+	 && ( string[ 1 ] == (system_character_t) 'l' )
+	 && ( string[ 2 ] == (system_character_t) 'l' )
+	 && ( string[ 3 ] == 0 ) )
+	{
+		*partition_number = 0;
+
+		return( 1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_partition_number *= 10;
+		safe_partition_number += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_partition_number > (int) UINT16_MAX )
+		{
+			break;
+		}
+	}
+	if( ( safe_partition_number <= 0 )
+	 || ( safe_partition_number > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_number = safe_partition_number;
+
+	return( 1 );
+}
+
+/* Signals the export handle to abort
+ * The chunks written so far are recorded in the checkpoint, so that the export can be resumed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	if( export_handle->input_volume != NULL )
+	{
+		if( libvsgpt_volume_signal_abort(
+		     export_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsgpt_volume_open_wide(
+	     export_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsgpt_volume_open(
+	     export_handle->input_volume,
+	     filename,
+	     LIBVSGPT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_close(
+	     export_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a target filename
+ * If partition number is not 0 ".p" and the partition number are appended to the target,
+ * followed by the suffix if not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_target_filename(
+     const system_character_t *target,
+     int partition_number,
+     const char *suffix,
+     system_character_t **filename,
+     libcerror_error_t **error )
+{
+	char suffix_string[ 64 ];
+
+	static char *function = "export_handle_get_target_filename";
+	size_t filename_size  = 0;
+	size_t string_index   = 0;
+	size_t suffix_length  = 0;
+	size_t target_length  = 0;
+	int print_count       = 0;
+
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_number < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid partition number value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( suffix == NULL )
+	{
+		suffix = "";
+	}
+	if( partition_number > 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               suffix_string,
+		               64,
+		               ".p%d%s",
+		               partition_number,
+		               suffix );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               suffix_string,
+		               64,
+		               "%s",
+		               suffix );
+	}
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set suffix string.",
+		 function );
+
+		return( -1 );
+	}
+	suffix_length = (size_t) print_count;
+	target_length = system_string_length(
+	                 target );
+
+	filename_size = target_length + suffix_length + 1;
+
+	*filename = system_string_allocate(
+	             filename_size );
+
+	if( *filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     *filename,
+	     target,
+	     target_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy target to filename.",
+		 function );
+
+		memory_free(
+		 *filename );
+
+		*filename = NULL;
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < suffix_length;
+	     string_index++ )
+	{
+		( *filename )[ target_length + string_index ] = (system_character_t) suffix_string[ string_index ];
+	}
+	( *filename )[ filename_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Determines if data only contains 0-byte values
+ * Returns 1 if the data only contains 0-byte values or 0 if not
+ */
+int export_handle_data_is_zero(
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	/* Compare in 64-bit values where possible since zero chunks are common
+	 */
+	while( ( data_offset < data_size )
+	    && ( ( (intptr_t) &( data[ data_offset ] ) % sizeof( uint64_t ) ) != 0 ) )
+	{
+		if( data[ data_offset ] != 0 )
+		{
+			return( 0 );
+		}
+		data_offset++;
+	}
+	while( ( data_offset + sizeof( uint64_t ) ) <= data_size )
+	{
+		if( *( (uint64_t *) &( data[ data_offset ] ) ) != 0 )
+		{
+			return( 0 );
+		}
+		data_offset += sizeof( uint64_t );
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] != 0 )
+		{
+			return( 0 );
+		}
+		data_offset++;
+	}
+	return( 1 );
+}
+
+/* Reads a checkpoint
+ * Returns 1 if successful, 0 if the stream does not contain a checkpoint or -1 on error
+ */
+int export_handle_read_checkpoint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     uint64_t *offset,
+     uint32_t *crc32,
+     libcerror_error_t **error )
+{
+	char line[ 64 ];
+
+	static char *function = "export_handle_read_checkpoint";
+	size_t line_index     = 0;
+	uint64_t safe_offset  = 0;
+	uint32_t safe_crc32   = 0;
+	uint8_t byte_value    = 0;
+	int has_crc32         = 0;
+	int has_offset        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        64 ) != NULL )
+	{
+		if( narrow_string_compare(
+		     line,
+		     "offset: ",
+		     8 ) == 0 )
+		{
+			safe_offset = 0;
+
+			for( line_index = 8;
+			     ( line[ line_index ] >= '0' ) && ( line[ line_index ] <= '9' );
+			     line_index++ )
+			{
+				if( safe_offset > ( (uint64_t) INT64_MAX / 10 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				safe_offset *= 10;
+				safe_offset += (uint64_t) ( line[ line_index ] - '0' );
+			}
+			has_offset = ( line_index > 8 );
+		}
+		else if( narrow_string_compare(
+		          line,
+		          "crc32: 0x",
+		          9 ) == 0 )
+		{
+			safe_crc32 = 0;
+
+			for( line_index = 9;
+			     line_index < 17;
+			     line_index++ )
+			{
+				if( ( line[ line_index ] >= '0' )
+				 && ( line[ line_index ] <= '9' ) )
+				{
+					byte_value = (uint8_t) ( line[ line_index ] - '0' );
+				}
+				else if( ( line[ line_index ] >= 'a' )
+				      && ( line[ line_index ] <= 'f' ) )
+				{
+					byte_value = (uint8_t) ( line[ line_index ] - 'a' + 10 );
+				}
+				else
+				{
+					break;
+				}
+				safe_crc32 <<= 4;
+				safe_crc32  |= byte_value;
+			}
+			has_crc32 = ( line_index == 17 );
+		}
+	}
+	if( ( has_offset == 0 )
+	 || ( has_crc32 == 0 ) )
+	{
+		return( 0 );
+	}
+	*offset = safe_offset;
+	*crc32  = safe_crc32;
+
+	return( 1 );
+}
+
+/* Writes a checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_checkpoint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     uint64_t offset,
+     uint32_t crc32,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_checkpoint";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( fprintf(
+	     stream,
+	     "vsgptexport checkpoint\noffset: %" PRIu64 "\ncrc32: 0x%08" PRIx32 "\n",
+	     offset,
+	     crc32 ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the checkpoint file with the chunks that were written so far
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_update_checkpoint(
+     export_handle_t *export_handle,
+     FILE *output_stream,
+     const system_character_t *checkpoint_filename,
+     libcerror_error_t **error )
+{
+	FILE *checkpoint_stream = NULL;
+	static char *function   = "export_handle_update_checkpoint";
+	uint64_t offset         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the chunks are written before they are recorded in the checkpoint
+	 */
+	if( fflush(
+	     output_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output stream.",
+		 function );
+
+		return( -1 );
+	}
+	offset = export_handle->next_write_chunk_index * EXPORT_HANDLE_CHUNK_SIZE;
+
+	if( offset > (uint64_t) export_handle->partition_size )
+	{
+		offset = (uint64_t) export_handle->partition_size;
+	}
+	checkpoint_stream = export_handle_open_file(
+	                     checkpoint_filename,
+	                     FILE_STREAM_OPEN_WRITE );
+
+	if( checkpoint_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_checkpoint(
+	     export_handle,
+	     checkpoint_stream,
+	     offset,
+	     export_handle->crc32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint.",
+		 function );
+
+		file_stream_close(
+		 checkpoint_stream );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     checkpoint_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Allocates the chunk buffers
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_allocate_buffers(
+     export_handle_t *export_handle,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	export_buffer_t *export_buffer = NULL;
+	static char *function          = "export_handle_allocate_buffers";
+	size_t alignment_size          = 0;
+	int buffer_index               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - buffers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers <= 0 )
+	 || ( number_of_buffers > ( 2 * EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->buffers = (export_buffer_t *) memory_allocate(
+	                                              sizeof( export_buffer_t ) * number_of_buffers );
+
+	if( export_handle->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     export_handle->buffers,
+	     0,
+	     sizeof( export_buffer_t ) * number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		memory_free(
+		 export_handle->buffers );
+
+		export_handle->buffers = NULL;
+
+		return( -1 );
+	}
+	export_handle->number_of_buffers = number_of_buffers;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		export_buffer = &( export_handle->buffers[ buffer_index ] );
+
+		/* The buffer is over allocated so that the data can be aligned
+		 */
+		export_buffer->allocated_data = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * ( EXPORT_HANDLE_CHUNK_SIZE + EXPORT_HANDLE_BUFFER_ALIGNMENT ) );
+
+		if( export_buffer->allocated_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d data.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		alignment_size = (size_t) ( (intptr_t) export_buffer->allocated_data % EXPORT_HANDLE_BUFFER_ALIGNMENT );
+
+		if( alignment_size != 0 )
+		{
+			alignment_size = EXPORT_HANDLE_BUFFER_ALIGNMENT - alignment_size;
+		}
+		export_buffer->data = &( export_buffer->allocated_data[ alignment_size ] );
+	}
+	return( 1 );
+
+on_error:
+	export_handle_free_buffers(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the chunk buffers
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_buffers(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free_buffers";
+	int buffer_index      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffers != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < export_handle->number_of_buffers;
+		     buffer_index++ )
+		{
+			if( export_handle->buffers[ buffer_index ].allocated_data != NULL )
+			{
+				memory_free(
+				 export_handle->buffers[ buffer_index ].allocated_data );
+			}
+		}
+		memory_free(
+		 export_handle->buffers );
+
+		export_handle->buffers = NULL;
+	}
+	export_handle->number_of_buffers = 0;
+
+	return( 1 );
+}
+
+/* Stops the export of a partition
+ * The first read error is retained, read_error can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_stop(
+     export_handle_t *export_handle,
+     libcerror_error_t **read_error,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_stop";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_handle->is_stopped = 1;
+
+	if( ( read_error != NULL )
+	 && ( *read_error != NULL ) )
+	{
+		if( export_handle->read_error == NULL )
+		{
+			export_handle->read_error = *read_error;
+		}
+		else
+		{
+			libcerror_error_free(
+			 read_error );
+		}
+		*read_error = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     export_handle->buffers_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast buffers condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 export_handle->buffers_mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a buffer to read the next chunk into
+ * Waits until a buffer is available, which bounds the number of chunks that are read ahead
+ * Returns 1 if successful, 0 if no more chunks are to be read or -1 on error
+ */
+int export_handle_get_read_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error )
+{
+	export_buffer_t *safe_export_buffer = NULL;
+	static char *function               = "export_handle_get_read_buffer";
+	uint64_t chunk_offset               = 0;
+	int result                          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		if( export_handle->abort != 0 )
+		{
+			/* Stop the writer as well since it could be waiting for a chunk
+			 * that will no longer be read
+			 */
+			export_handle->is_stopped = 1;
+		}
+		if( ( export_handle->is_stopped != 0 )
+		 || ( export_handle->next_read_chunk_index >= export_handle->number_of_chunks ) )
+		{
+			break;
+		}
+		/* The buffer of chunk N is reused for chunk N + number of buffers
+		 * once chunk N has been written
+		 */
+		if( export_handle->next_read_chunk_index < ( export_handle->next_write_chunk_index + export_handle->number_of_buffers ) )
+		{
+			safe_export_buffer = &( export_handle->buffers[ export_handle->next_read_chunk_index % export_handle->number_of_buffers ] );
+
+			chunk_offset = export_handle->next_read_chunk_index * EXPORT_HANDLE_CHUNK_SIZE;
+
+			safe_export_buffer->chunk_index = export_handle->next_read_chunk_index;
+			safe_export_buffer->data_size   = EXPORT_HANDLE_CHUNK_SIZE;
+			safe_export_buffer->is_filled   = 0;
+
+			if( safe_export_buffer->data_size > ( export_handle->partition_size - chunk_offset ) )
+			{
+				safe_export_buffer->data_size = (size_t) ( export_handle->partition_size - chunk_offset );
+			}
+			export_handle->next_read_chunk_index += 1;
+
+			result = 1;
+
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_wait(
+		     export_handle->buffers_condition,
+		     export_handle->buffers_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for buffers condition.",
+			 function );
+
+			result = -1;
+		}
+#else
+		break;
+#endif
+	}
+	while( result == 0 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( result == 0 )
+	 && ( export_handle->is_stopped != 0 ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     export_handle->buffers_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast buffers condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*export_buffer = safe_export_buffer;
+	}
+	return( result );
+}
+
+/* Releases a buffer the chunk was read into
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_release_read_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_release_read_buffer";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_buffer->is_filled = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     export_handle->buffers_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast buffers condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the buffer of the next chunk to write
+ * Waits until the chunk has been read, so that chunks are written in order
+ * Returns 1 if successful, 0 if the export was stopped or -1 on error
+ */
+int export_handle_get_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error )
+{
+	export_buffer_t *safe_export_buffer = NULL;
+	static char *function               = "export_handle_get_write_buffer";
+	int result                          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		if( export_handle->abort != 0 )
+		{
+			export_handle->is_stopped = 1;
+		}
+		if( ( export_handle->is_stopped != 0 )
+		 || ( export_handle->next_write_chunk_index >= export_handle->number_of_chunks ) )
+		{
+			break;
+		}
+		safe_export_buffer = &( export_handle->buffers[ export_handle->next_write_chunk_index % export_handle->number_of_buffers ] );
+
+		if( ( safe_export_buffer->is_filled != 0 )
+		 && ( safe_export_buffer->chunk_index == export_handle->next_write_chunk_index ) )
+		{
+			result = 1;
+
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_wait(
+		     export_handle->buffers_condition,
+		     export_handle->buffers_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for buffers condition.",
+			 function );
+
+			result = -1;
+		}
+#else
+		break;
+#endif
+	}
+	while( result == 0 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*export_buffer = safe_export_buffer;
+	}
+	return( result );
+}
+
+/* Releases the buffer of a chunk that was written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_release_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_release_write_buffer";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_buffer->is_filled = 0;
+
+	export_handle->next_write_chunk_index += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     export_handle->buffers_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast buffers condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads chunks in a separate thread
+ * Callback function for the read threads
+ * Every read thread uses its own partition, which reads using its own file IO handle
+ * An error is retained in the export handle and stops the export
+ * Returns 1
+ */
+int export_handle_read_thread(
+     export_handle_t *export_handle )
+{
+	export_buffer_t *export_buffer  = NULL;
+	libcerror_error_t *error        = NULL;
+	libvsgpt_partition_t *partition = NULL;
+	static char *function           = "export_handle_read_thread";
+	ssize_t read_count              = 0;
+	off64_t chunk_offset            = 0;
+	int result                      = 0;
+
+	if( export_handle == NULL )
+	{
+		return( 1 );
+	}
+	if( libvsgpt_volume_get_partition_by_index(
+	     export_handle->input_volume,
+	     export_handle->partition_index,
+	     &partition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 export_handle->partition_index );
+	}
+	while( error == NULL )
+	{
+		result = export_handle_get_read_buffer(
+		          export_handle,
+		          &export_buffer,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		chunk_offset = (off64_t) ( export_buffer->chunk_index * EXPORT_HANDLE_CHUNK_SIZE );
+
+		read_count = libvsgpt_partition_read_buffer_at_offset(
+		              partition,
+		              export_buffer->data,
+		              export_buffer->data_size,
+		              chunk_offset,
+		              &error );
+
+		if( read_count != (ssize_t) export_buffer->data_size )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			break;
+		}
+		export_handle_release_read_buffer(
+		 export_handle,
+		 export_buffer,
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		if( export_handle_stop(
+		     export_handle,
+		     &error,
+		     NULL ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the chunk in a buffer to the output
+ * Chunks that only contain 0-byte values are skipped so that they become holes in a sparse file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_buffer";
+	uint64_t chunk_offset = 0;
+	int percentage        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_chunks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = export_buffer->chunk_index * EXPORT_HANDLE_CHUNK_SIZE;
+
+	if( export_handle_data_is_zero(
+	     export_buffer->data,
+	     export_buffer->data_size ) != 0 )
+	{
+		export_handle->sparse_size         += export_buffer->data_size;
+		export_handle->last_chunk_is_sparse = 1;
+	}
+	else
+	{
+		/* The output is positioned explicitly since the previous chunk could have been a hole
+		 */
+		if( export_handle_seek_offset(
+		     output_stream,
+		     chunk_offset ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIu64 " (0x%08" PRIx64 ") in output.",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			return( -1 );
+		}
+		if( file_stream_write(
+		     output_stream,
+		     export_buffer->data,
+		     export_buffer->data_size ) != export_buffer->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk at offset: %" PRIu64 " (0x%08" PRIx64 ") to output.",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			return( -1 );
+		}
+		export_handle->last_chunk_is_sparse = 0;
+	}
+	if( export_handle->calculate_crc32 != 0 )
+	{
+		if( vsgpttools_checksum_calculate_crc32(
+		     &( export_handle->crc32 ),
+		     export_buffer->data,
+		     export_buffer->data_size,
+		     export_handle->crc32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_handle->exported_size += export_buffer->data_size;
+
+	percentage = (int) ( ( ( export_buffer->chunk_index + 1 ) * 100 ) / export_handle->number_of_chunks );
+	percentage = ( percentage / 10 ) * 10;
+
+	if( percentage > export_handle->last_percentage )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Status: exported %d%%.\n",
+		 percentage );
+
+		export_handle->last_percentage = percentage;
+	}
+	return( 1 );
+}
+
+/* Exports the chunks of a partition, starting at the next write chunk index
+ * With multiple read threads chunks are read ahead concurrently while
+ * the calling thread writes them to the output in order
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_chunks(
+     export_handle_t *export_handle,
+     libvsgpt_partition_t *partition,
+     FILE *output_stream,
+     const system_character_t *checkpoint_filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ];
+
+	int number_of_threads          = 0;
+	int thread_index               = 0;
+#endif
+	export_buffer_t *export_buffer = NULL;
+	static char *function          = "export_handle_export_chunks";
+	ssize_t read_count             = 0;
+	off64_t chunk_offset           = 0;
+	int number_of_buffers          = 1;
+	int result                     = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		number_of_threads = export_handle->number_of_threads;
+
+		/* Two buffers per read thread so that a thread can read the next chunk
+		 * while its previous chunk is waiting to be written
+		 */
+		number_of_buffers = 2 * number_of_threads;
+	}
+#endif
+	export_handle->next_read_chunk_index = export_handle->next_write_chunk_index;
+	export_handle->is_stopped            = 0;
+
+	if( export_handle_allocate_buffers(
+	     export_handle,
+	     number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate buffers.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &export_handle_read_thread,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			number_of_threads = thread_index;
+			result            = -1;
+
+			break;
+		}
+	}
+#endif
+	while( result == 1 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads == 0 )
+#endif
+		{
+			result = export_handle_get_read_buffer(
+			          export_handle,
+			          &export_buffer,
+			          error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+			chunk_offset = (off64_t) ( export_buffer->chunk_index * EXPORT_HANDLE_CHUNK_SIZE );
+
+			read_count = libvsgpt_partition_read_buffer_at_offset(
+			              partition,
+			              export_buffer->data,
+			              export_buffer->data_size,
+			              chunk_offset,
+			              error );
+
+			if( read_count != (ssize_t) export_buffer->data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				result = -1;
+
+				break;
+			}
+			if( export_handle_release_read_buffer(
+			     export_handle,
+			     export_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read buffer.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		result = export_handle_get_write_buffer(
+		          export_handle,
+		          &export_buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		if( export_handle_write_buffer(
+		     export_handle,
+		     export_buffer,
+		     output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( export_handle_release_write_buffer(
+		     export_handle,
+		     export_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release write buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		/* The next write chunk index is only changed by the calling thread
+		 */
+		if( ( export_handle->next_write_chunk_index % EXPORT_HANDLE_CHECKPOINT_INTERVAL ) == 0 )
+		{
+			if( export_handle_update_checkpoint(
+			     export_handle,
+			     output_stream,
+			     checkpoint_filename,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to update checkpoint.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 0 )
+	{
+		if( export_handle_stop(
+		     export_handle,
+		     NULL,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			result = -1;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				if( result != -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread: %d.",
+					 function,
+					 thread_index );
+				}
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( export_handle->read_error != NULL )
+	{
+		/* A read that failed due to an abort is not reported as an error
+		 */
+		if( ( result == -1 )
+		 || ( export_handle->abort != 0 )
+		 || ( error == NULL ) )
+		{
+			libcerror_error_free(
+			 &( export_handle->read_error ) );
+		}
+		else
+		{
+			*error = export_handle->read_error;
+
+			export_handle->read_error = NULL;
+		}
+		if( export_handle->abort == 0 )
+		{
+			result = -1;
+		}
+	}
+	if( ( result == 0 )
+	 && ( export_handle->abort == 0 )
+	 && ( export_handle->next_write_chunk_index >= export_handle->number_of_chunks ) )
+	{
+		result = 1;
+	}
+	if( export_handle_free_buffers(
+	     export_handle,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		if( result != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffers.",
+			 function );
+		}
+		result = -1;
+	}
+	return( result );
+}
+
+/* Exports a partition to a target file
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_partition(
+     export_handle_t *export_handle,
+     int partition_index,
+     const system_character_t *target_filename,
+     libcerror_error_t **error )
+{
+	uint8_t zero_byte                       = 0;
+	libvsgpt_partition_t *partition         = NULL;
+	system_character_t *checkpoint_filename = NULL;
+	FILE *checkpoint_stream                 = NULL;
+	FILE *output_stream                     = NULL;
+	static char *function                   = "export_handle_export_partition";
+	uint64_t checkpoint_offset              = 0;
+	uint32_t checkpoint_crc32               = 0;
+	int result                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_get_partition_by_index(
+	     export_handle->input_volume,
+	     partition_index,
+	     &partition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( libvsgpt_partition_get_size(
+	     partition,
+	     &( export_handle->partition_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d size.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( export_handle_get_target_filename(
+	     target_filename,
+	     0,
+	     ".checkpoint",
+	     &checkpoint_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->partition_index        = partition_index;
+	export_handle->number_of_chunks       = ( export_handle->partition_size + EXPORT_HANDLE_CHUNK_SIZE - 1 ) / EXPORT_HANDLE_CHUNK_SIZE;
+	export_handle->next_write_chunk_index = 0;
+	export_handle->crc32                  = 0;
+	export_handle->last_chunk_is_sparse   = 0;
+	export_handle->last_percentage        = 0;
+
+	if( export_handle->resume != 0 )
+	{
+		checkpoint_stream = export_handle_open_file(
+		                     checkpoint_filename,
+		                     FILE_STREAM_OPEN_READ );
+
+		if( checkpoint_stream != NULL )
+		{
+			result = export_handle_read_checkpoint(
+			          export_handle,
+			          checkpoint_stream,
+			          &checkpoint_offset,
+			          &checkpoint_crc32,
+			          error );
+
+			file_stream_close(
+			 checkpoint_stream );
+
+			checkpoint_stream = NULL;
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( ( checkpoint_offset > (uint64_t) export_handle->partition_size )
+				 || ( ( ( checkpoint_offset % EXPORT_HANDLE_CHUNK_SIZE ) != 0 )
+				  && ( checkpoint_offset != (uint64_t) export_handle->partition_size ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid checkpoint offset value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				/* A checkpoint without the output it refers to cannot be resumed
+				 */
+				output_stream = export_handle_open_file(
+				                 target_filename,
+				                 EXPORT_HANDLE_OPEN_READ_WRITE );
+
+				if( output_stream != NULL )
+				{
+					export_handle->next_write_chunk_index = ( checkpoint_offset + EXPORT_HANDLE_CHUNK_SIZE - 1 ) / EXPORT_HANDLE_CHUNK_SIZE;
+					export_handle->crc32                  = checkpoint_crc32;
+
+					fprintf(
+					 export_handle->notify_stream,
+					 "Resuming export of partition: %d at offset: %" PRIu64 " (0x%08" PRIx64 ").\n",
+					 partition_index + 1,
+					 checkpoint_offset,
+					 checkpoint_offset );
+				}
+			}
+		}
+	}
+	if( output_stream == NULL )
+	{
+		output_stream = export_handle_open_file(
+		                 target_filename,
+		                 FILE_STREAM_BINARY_OPEN_WRITE );
+
+		if( output_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open target: %" PRIs_SYSTEM ".",
+			 function,
+			 target_filename );
+
+			goto on_error;
+		}
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Exporting partition: %d to: %" PRIs_SYSTEM ".\n",
+	 partition_index + 1,
+	 target_filename );
+
+	result = export_handle_export_chunks(
+	          export_handle,
+	          partition,
+	          output_stream,
+	          checkpoint_filename,
+	          error );
+
+	if( result != 1 )
+	{
+		/* Record how far the export got so that it can be resumed
+		 */
+		if( export_handle_update_checkpoint(
+		     export_handle,
+		     output_stream,
+		     checkpoint_filename,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			if( result != -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to update checkpoint.",
+				 function );
+			}
+			result = -1;
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	else if( export_handle->last_chunk_is_sparse != 0 )
+	{
+		/* Write the last byte so that the size of the output matches
+		 * that of the partition if the output ends in a hole
+		 */
+		if( export_handle_seek_offset(
+		     output_stream,
+		     export_handle->partition_size - 1 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek end of output.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_stream_write(
+		     output_stream,
+		     &zero_byte,
+		     1 ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of output.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     output_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close target: %" PRIs_SYSTEM ".",
+		 function,
+		 target_filename );
+
+		output_stream = NULL;
+
+		goto on_error;
+	}
+	output_stream = NULL;
+
+	if( result == 1 )
+	{
+		/* The checkpoint is no longer needed once the export has completed
+		 */
+		export_handle_remove_file(
+		 checkpoint_filename );
+
+		if( export_handle->calculate_crc32 != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "CRC-32 of partition: %d\t: 0x%08" PRIx32 "\n",
+			 partition_index + 1,
+			 export_handle->crc32 );
+		}
+		export_handle->number_of_exported_partitions += 1;
+	}
+	memory_free(
+	 checkpoint_filename );
+
+	checkpoint_filename = NULL;
+
+	if( libvsgpt_partition_free(
+	     &partition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( checkpoint_filename != NULL )
+	{
+		memory_free(
+		 checkpoint_filename );
+	}
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports partitions to target files
+ * If partition number is 0 all partitions are exported, to the target with
+ * ".p" and the partition number appended, otherwise the partition is exported to the target
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_partitions(
+     export_handle_t *export_handle,
+     int partition_number,
+     const system_character_t *target,
+     libcerror_error_t **error )
+{
+	system_character_t *target_filename = NULL;
+	static char *function               = "export_handle_export_partitions";
+	int64_t start_time                  = 0;
+	int number_of_partitions            = 0;
+	int partition_index                 = 0;
+	int result                          = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     export_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_number < 0 )
+	 || ( partition_number > number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = export_handle_get_current_time();
+
+	if( partition_number != 0 )
+	{
+		result = export_handle_export_partition(
+		          export_handle,
+		          partition_number - 1,
+		          target,
+		          error );
+	}
+	else
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			if( export_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			if( export_handle_get_target_filename(
+			     target,
+			     partition_index + 1,
+			     NULL,
+			     &target_filename,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve target filename of partition: %d.",
+				 function,
+				 partition_index );
+
+				result = -1;
+
+				break;
+			}
+			result = export_handle_export_partition(
+			          export_handle,
+			          partition_index,
+			          target_filename,
+			          error );
+
+			memory_free(
+			 target_filename );
+
+			target_filename = NULL;
+
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+	}
+	export_handle->elapsed_time += export_handle_get_current_time() - start_time;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export partitions.",
+		 function );
+	}
+	return( result );
+}
+
+/* Prints a summary of the export
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_summary_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_summary_fprint";
+	double throughput     = 0.0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->elapsed_time > 0 )
+	{
+		throughput = ( (double) export_handle->exported_size / ( 1024.0 * 1024.0 ) )
+		           / ( (double) export_handle->elapsed_time / 1000000.0 );
+	}
+	fprintf(
+	 stream,
+	 "Export summary:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of exported partitions\t: %d\n",
+	 export_handle->number_of_exported_partitions );
+
+	fprintf(
+	 stream,
+	 "\tExported size\t\t\t: %" PRIu64 " bytes\n",
+	 export_handle->exported_size );
+
+	fprintf(
+	 stream,
+	 "\tSparse size\t\t\t: %" PRIu64 " bytes\n",
+	 export_handle->sparse_size );
+
+	fprintf(
+	 stream,
+	 "\tElapsed time\t\t\t: %" PRIi64 ".%03" PRIi64 " seconds\n",
+	 export_handle->elapsed_time / 1000000,
+	 ( export_handle->elapsed_time % 1000000 ) / 1000 );
+
+	fprintf(
+	 stream,
+	 "\tThroughput\t\t\t: %.1f MiB/s\n",
+	 throughput );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ * Returns the current time
+ */
+int64_t export_handle_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( (int64_t) time( NULL ) * 1000000 );
+#endif
+}
+
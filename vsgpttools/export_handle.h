@@ -0,0 +1,323 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of read threads
+ */
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+
+/* The maximum number of read threads
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The size of the chunks the partition data is read and written in
+ */
+#define EXPORT_HANDLE_CHUNK_SIZE			( 4 * 1024 * 1024 )
+
+/* The alignment of the chunk buffers
+ */
+#define EXPORT_HANDLE_BUFFER_ALIGNMENT			4096
+
+/* The number of chunks after which the checkpoint is updated
+ */
+#define EXPORT_HANDLE_CHECKPOINT_INTERVAL		64
+
+typedef struct export_buffer export_buffer_t;
+
+struct export_buffer
+{
+	/* The allocated data
+	 */
+	uint8_t *allocated_data;
+
+	/* The data, aligned to EXPORT_HANDLE_BUFFER_ALIGNMENT
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The index of the chunk stored in the buffer
+	 */
+	uint64_t chunk_index;
+
+	/* Value to indicate the buffer contains the data of the chunk
+	 */
+	uint8_t is_filled;
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The libvsgpt input volume
+	 */
+	libvsgpt_volume_t *input_volume;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The number of read threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate a CRC-32 of the exported data should be calculated
+	 */
+	uint8_t calculate_crc32;
+
+	/* Value to indicate an interrupted export should be resumed from its checkpoint
+	 */
+	uint8_t resume;
+
+	/* The chunk buffers
+	 */
+	export_buffer_t *buffers;
+
+	/* The number of chunk buffers
+	 */
+	int number_of_buffers;
+
+	/* The index of the partition that is exported
+	 */
+	int partition_index;
+
+	/* The size of the partition that is exported
+	 */
+	size64_t partition_size;
+
+	/* The number of chunks of the partition that is exported
+	 */
+	uint64_t number_of_chunks;
+
+	/* The index of the next chunk to read
+	 */
+	uint64_t next_read_chunk_index;
+
+	/* The index of the next chunk to write
+	 */
+	uint64_t next_write_chunk_index;
+
+	/* Value to indicate the export of the partition has stopped
+	 */
+	uint8_t is_stopped;
+
+	/* The error of the first read that failed
+	 */
+	libcerror_error_t *read_error;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The buffers mutex
+	 */
+	libcthreads_mutex_t *buffers_mutex;
+
+	/* The buffers condition
+	 */
+	libcthreads_condition_t *buffers_condition;
+#endif
+
+	/* The CRC-32 of the data written so far
+	 */
+	uint32_t crc32;
+
+	/* Value to indicate the last chunk written was a hole
+	 */
+	uint8_t last_chunk_is_sparse;
+
+	/* The last progress percentage that was printed
+	 */
+	int last_percentage;
+
+	/* The number of exported partitions
+	 */
+	int number_of_exported_partitions;
+
+	/* The number of bytes exported
+	 */
+	size64_t exported_size;
+
+	/* The number of bytes that were zero and written as holes
+	 */
+	size64_t sparse_size;
+
+	/* The elapsed time in microseconds
+	 */
+	int64_t elapsed_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int export_handle_parse_partition_number(
+     const system_character_t *string,
+     int *partition_number,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_target_filename(
+     const system_character_t *target,
+     int partition_number,
+     const char *suffix,
+     system_character_t **filename,
+     libcerror_error_t **error );
+
+int export_handle_data_is_zero(
+     const uint8_t *data,
+     size_t data_size );
+
+int export_handle_read_checkpoint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     uint64_t *offset,
+     uint32_t *crc32,
+     libcerror_error_t **error );
+
+int export_handle_write_checkpoint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     uint64_t offset,
+     uint32_t crc32,
+     libcerror_error_t **error );
+
+int export_handle_update_checkpoint(
+     export_handle_t *export_handle,
+     FILE *output_stream,
+     const system_character_t *checkpoint_filename,
+     libcerror_error_t **error );
+
+int export_handle_allocate_buffers(
+     export_handle_t *export_handle,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+int export_handle_free_buffers(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_stop(
+     export_handle_t *export_handle,
+     libcerror_error_t **read_error,
+     libcerror_error_t **error );
+
+int export_handle_get_read_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error );
+
+int export_handle_release_read_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error );
+
+int export_handle_get_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error );
+
+int export_handle_release_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error );
+
+int export_handle_read_thread(
+     export_handle_t *export_handle );
+
+int export_handle_write_buffer(
+     export_handle_t *export_handle,
+     export_buffer_t *export_buffer,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int export_handle_export_chunks(
+     export_handle_t *export_handle,
+     libvsgpt_partition_t *partition,
+     FILE *output_stream,
+     const system_character_t *checkpoint_filename,
+     libcerror_error_t **error );
+
+int export_handle_export_partition(
+     export_handle_t *export_handle,
+     int partition_index,
+     const system_character_t *target_filename,
+     libcerror_error_t **error );
+
+int export_handle_export_partitions(
+     export_handle_t *export_handle,
+     int partition_number,
+     const system_character_t *target,
+     libcerror_error_t **error );
+
+int export_handle_summary_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int64_t export_handle_get_current_time(
+         void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -29,12 +29,32 @@
 
 #include "vsgpttools_libcerror.h"
 #include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
 #include "vsgpttools_libfguid.h"
 #include "vsgpttools_libvsgpt.h"
 #include "info_handle.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define info_handle_file_stream_get_string( stream, string, size ) \
+	file_stream_get_string_wide( stream, string, size )
+#else
+#define info_handle_file_stream_get_string( stream, string, size ) \
+	file_stream_get_string( stream, string, size )
+#endif
+
+/* The lower case hexadecimal digits
+ */
+static const char info_handle_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+/* The order in which the bytes of a GUID are formatted, where -1 represents a separator
+ * The first 3 values of the GUID are stored in little-endian
+ */
+static const int info_handle_guid_byte_order[ 20 ] = {
+	3, 2, 1, 0, -1, 5, 4, -1, 7, 6, -1, 8, 9, -1, 10, 11, 12, 13, 14, 15 };
+
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -211,6 +231,77 @@ int info_handle_signal_abort(
 	return( 1 );
 }
 
+/* Retrieves a description of an open phase
+ * Returns a string containing the description
+ */
+const char *info_handle_get_open_phase_description(
+             int phase )
+{
+	switch( phase )
+	{
+		case LIBVSGPT_OPEN_PHASE_PARTITION_TABLE_HEADER:
+			return( "partition table header" );
+
+		case LIBVSGPT_OPEN_PHASE_BACKUP_PARTITION_TABLE_HEADER:
+			return( "backup partition table header" );
+
+		case LIBVSGPT_OPEN_PHASE_PARTITION_ENTRIES:
+			return( "partition entries" );
+
+		case LIBVSGPT_OPEN_PHASE_BOOT_RECORDS:
+			return( "boot records" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Prints a trace event of the reads done when opening the input
+ */
+void info_handle_trace_callback(
+      int event_type,
+      int phase,
+      off64_t offset,
+      size64_t size,
+      uint64_t duration,
+      void *user_data )
+{
+	info_handle_t *info_handle = NULL;
+
+	if( user_data == NULL )
+	{
+		return;
+	}
+	info_handle = (info_handle_t *) user_data;
+
+	if( event_type == LIBVSGPT_TRACE_EVENT_TYPE_READ )
+	{
+		info_handle->number_of_traced_reads += 1;
+		info_handle->traced_read_size       += size;
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "Read at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 " in %" PRIu64 " us (%s)\n",
+		 offset,
+		 offset,
+		 size,
+		 duration,
+		 info_handle_get_open_phase_description(
+		  phase ) );
+	}
+	else if( event_type == LIBVSGPT_TRACE_EVENT_TYPE_PHASE )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Phase: %s read %" PRIu64 " bytes in %" PRIu64 " us\n",
+		 info_handle_get_open_phase_description(
+		  phase ),
+		 size,
+		 duration );
+	}
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -232,6 +323,27 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	if( info_handle->trace_io != 0 )
+	{
+		info_handle->number_of_traced_reads = 0;
+		info_handle->traced_read_size       = 0;
+
+		if( libvsgpt_volume_set_trace_callback(
+		     info_handle->input_volume,
+		     &info_handle_trace_callback,
+		     (void *) info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set trace callback.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libvsgpt_volume_open_wide(
 	     info_handle->input_volume,
@@ -255,6 +367,14 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	if( info_handle->trace_io != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Number of reads: %" PRIu64 " (%" PRIu64 " bytes)\n\n",
+		 info_handle->number_of_traced_reads,
+		 info_handle->traced_read_size );
+	}
 	return( 1 );
 }
 
@@ -406,394 +526,315 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the partition type
- * Returns 1 if successful or -1 on error
+/* Retrieves a description of a partition type
+ * Returns a string containing the description or NULL if not available
  */
-int info_handle_partition_type_fprint(
-     info_handle_t *info_handle,
-     uint8_t partition_type,
-     libcerror_error_t **error )
+const char *info_handle_get_partition_type_description(
+             uint8_t partition_type )
 {
-	const char *description = NULL;
-	static char *function   = "info_handle_partition_type_fprint";
-
-	if( info_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
-		 function );
-
-		return( -1 );
-	}
 	switch( partition_type )
 	{
 		case 0x00:
-			description = "Empty";
-			break;
+			return( "Empty" );
 
 		case 0x01:
-			description = "FAT12 (CHS)";
-			break;
+			return( "FAT12 (CHS)" );
 
 		case 0x02:
-			description = "XENIX root";
-			break;
+			return( "XENIX root" );
 
 		case 0x03:
-			description = "XENIX user";
-			break;
+			return( "XENIX user" );
 
 		case 0x04:
-			description = "FAT16 < 32 MiB (CHS)";
-			break;
+			return( "FAT16 < 32 MiB (CHS)" );
 
 		case 0x05:
-			description = "Extended (CHS)";
-			break;
+			return( "Extended (CHS)" );
 
 		case 0x06:
-			description = "FAT16 (CHS)";
-			break;
+			return( "FAT16 (CHS)" );
 
 		case 0x07:
-			description = "HPFS/NTFS";
-			break;
+			return( "HPFS/NTFS" );
 
 		case 0x08:
-			description = "AIX";
-			break;
+			return( "AIX" );
 
 		case 0x09:
-			description = "AIX bootable";
-			break;
+			return( "AIX bootable" );
 
 		case 0x0a:
-			description = "OS/2 Boot Manager";
-			break;
+			return( "OS/2 Boot Manager" );
 
 		case 0x0b:
-			description = "FAT32 (CHS)";
-			break;
+			return( "FAT32 (CHS)" );
 
 		case 0x0c:
-			description = "FAT32 (LBA)";
-			break;
+			return( "FAT32 (LBA)" );
 
 		case 0x0e:
-			description = "FAT16 (LBA)";
-			break;
+			return( "FAT16 (LBA)" );
 
 		case 0x0f:
-			description = "Extended (LBA)";
-			break;
+			return( "Extended (LBA)" );
 
 		case 0x10:
-			description = "OPUS";
-			break;
+			return( "OPUS" );
 
 		case 0x11:
-			description = "Hidden FAT12 (CHS)";
-			break;
+			return( "Hidden FAT12 (CHS)" );
 
 		case 0x12:
-			description = "Compaq diagnostics";
-			break;
+			return( "Compaq diagnostics" );
 
 		case 0x14:
-			description = "Hidden FAT16 < 32 MiB (CHS)";
-			break;
+			return( "Hidden FAT16 < 32 MiB (CHS)" );
 
 		case 0x16:
-			description = "Hidden FAT16 (CHS)";
-			break;
+			return( "Hidden FAT16 (CHS)" );
 
 		case 0x17:
-			description = "Hidden HPFS/NTFS";
-			break;
+			return( "Hidden HPFS/NTFS" );
 
 		case 0x18:
-			description = "AST SmartSleep";
-			break;
+			return( "AST SmartSleep" );
 
 		case 0x1b:
-			description = "Hidden FAT32 (CHS)";
-			break;
+			return( "Hidden FAT32 (CHS)" );
 
 		case 0x1c:
-			description = "Hidden FAT32 (LBA)";
-			break;
+			return( "Hidden FAT32 (LBA)" );
 
 		case 0x1e:
-			description = "Hidden FAT16 (LBA)";
-			break;
+			return( "Hidden FAT16 (LBA)" );
 
 		case 0x24:
-			description = "NEC DOS";
-			break;
+			return( "NEC DOS" );
 
 		case 0x39:
-			description = "Plan 9";
-			break;
+			return( "Plan 9" );
 
 		case 0x3c:
-			description = "PartitionMagic recovery";
-			break;
+			return( "PartitionMagic recovery" );
 
 		case 0x40:
-			description = "Venix 80286";
-			break;
+			return( "Venix 80286" );
 
 		case 0x41:
-			description = "PPC PReP Boot";
-			break;
+			return( "PPC PReP Boot" );
 
 		case 0x42:
-			description = "SFS / MS LDM";
-			break;
+			return( "SFS / MS LDM" );
 
 		case 0x4d:
-			description = "QNX4.x";
-			break;
+			return( "QNX4.x" );
 
 		case 0x4e:
-			description = "QNX4.x 2nd part";
-			break;
+			return( "QNX4.x 2nd part" );
 
 		case 0x4f:
-			description = "QNX4.x 3rd part";
-			break;
+			return( "QNX4.x 3rd part" );
 
 		case 0x50:
-			description = "OnTrack DM";
-			break;
+			return( "OnTrack DM" );
 
 		case 0x51:
-			description = "OnTrack DM6 Aux1";
-			break;
+			return( "OnTrack DM6 Aux1" );
 
 		case 0x52:
-			description = "CP/M";
-			break;
+			return( "CP/M" );
 
 		case 0x53:
-			description = "OnTrack DM6 Aux3";
-			break;
+			return( "OnTrack DM6 Aux3" );
 
 		case 0x54:
-			description = "OnTrackDM6";
-			break;
+			return( "OnTrackDM6" );
 
 		case 0x55:
-			description = "EZ-Drive";
-			break;
+			return( "EZ-Drive" );
 
 		case 0x56:
-			description = "Golden Bow";
-			break;
+			return( "Golden Bow" );
 
 		case 0x5c:
-			description = "Priam Edisk";
-			break;
+			return( "Priam Edisk" );
 
 		case 0x61:
-			description = "SpeedStor";
-			break;
+			return( "SpeedStor" );
 
 		case 0x63:
-			description = "GNU HURD or SysV";
-			break;
+			return( "GNU HURD or SysV" );
 
 		case 0x64:
-			description = "Novell Netware 286";
-			break;
+			return( "Novell Netware 286" );
 
 		case 0x65:
-			description = "Novell Netware 386";
-			break;
+			return( "Novell Netware 386" );
 
 		case 0x70:
-			description = "DiskSecure Multi-Boot";
-			break;
+			return( "DiskSecure Multi-Boot" );
 
 		case 0x75:
-			description = "PC/IX";
-			break;
+			return( "PC/IX" );
 
 		case 0x78:
-			description = "XOSL";
-			break;
+			return( "XOSL" );
 
 		case 0x80:
-			description = "Old Minix";
-			break;
+			return( "Old Minix" );
 
 		case 0x81:
-			description = "Minix / old Linux";
-			break;
+			return( "Minix / old Linux" );
 
 		case 0x82:
-			description = "Linux swap / Solaris";
-			break;
+			return( "Linux swap / Solaris" );
 
 		case 0x83:
-			description = "Linux";
-			break;
+			return( "Linux" );
 
 		case 0x84:
-			description = "OS/2 hidden C: drive";
-			break;
+			return( "OS/2 hidden C: drive" );
 
 		case 0x85:
-			description = "Linux extended";
-			break;
+			return( "Linux extended" );
 
 		case 0x86:
-			description = "NTFS partition set";
-			break;
+			return( "NTFS partition set" );
 
 		case 0x87:
-			description = "NTFS partition set";
-			break;
+			return( "NTFS partition set" );
 
 		case 0x8e:
-			description = "Linux LVM";
-			break;
+			return( "Linux LVM" );
 
 		case 0x93:
-			description = "Amoeba";
-			break;
+			return( "Amoeba" );
 
 		case 0x94:
-			description = "Amoeba BBT";
-			break;
+			return( "Amoeba BBT" );
 
 		case 0x9f:
-			description = "BSD/OS";
-			break;
+			return( "BSD/OS" );
 
 		case 0xa0:
-			description = "IBM Thinkpad hibernation";
-			break;
+			return( "IBM Thinkpad hibernation" );
 
 		case 0xa5:
-			description = "FreeBSD";
-			break;
+			return( "FreeBSD" );
 
 		case 0xa6:
-			description = "OpenBSD";
-			break;
+			return( "OpenBSD" );
 
 		case 0xa7:
-			description = "NeXTSTEP";
-			break;
+			return( "NeXTSTEP" );
 
 		case 0xa9:
-			description = "NetBSD";
-			break;
+			return( "NetBSD" );
 
 		case 0xaf:
-			description = "MacOS-X";
-			break;
+			return( "MacOS-X" );
 
 		case 0xb7:
-			description = "BSDI fs";
-			break;
+			return( "BSDI fs" );
 
 		case 0xb8:
-			description = "BSDI swap";
-			break;
+			return( "BSDI swap" );
 
 		case 0xbb:
-			description = "Boot Wizard hidden";
-			break;
+			return( "Boot Wizard hidden" );
 
 		case 0xc1:
-			description = "DRDOS/sec (FAT-12)";
-			break;
+			return( "DRDOS/sec (FAT-12)" );
 
 		case 0xc4:
-			description = "DRDOS/sec (FAT-16 < 32 MiB)";
-			break;
+			return( "DRDOS/sec (FAT-16 < 32 MiB)" );
 
 		case 0xc6:
-			description = "DRDOS/sec (FAT-16)";
-			break;
+			return( "DRDOS/sec (FAT-16)" );
 
 		case 0xc7:
-			description = "Syrinx";
-			break;
+			return( "Syrinx" );
 
 		case 0xda:
-			description = "Non-FS data";
-			break;
+			return( "Non-FS data" );
 
 		case 0xdb:
-			description = "CP/M / CTOS / ...";
-			break;
+			return( "CP/M / CTOS / ..." );
 
 		case 0xde:
-			description = "Dell Utility";
-			break;
+			return( "Dell Utility" );
 
 		case 0xdf:
-			description = "BootIt";
-			break;
+			return( "BootIt" );
 
 		case 0xe1:
-			description = "DOS access";
-			break;
+			return( "DOS access" );
 
 		case 0xe3:
-			description = "DOS R/O";
-			break;
+			return( "DOS R/O" );
 
 		case 0xe4:
-			description = "SpeedStor";
-			break;
+			return( "SpeedStor" );
 
 		case 0xeb:
-			description = "BeOS fs";
-			break;
+			return( "BeOS fs" );
 
 		case 0xee:
-			description = "EFI GPT protective";
-			break;
+			return( "EFI GPT protective" );
 
 		case 0xef:
-			description = "EFI System (FAT)";
-			break;
+			return( "EFI System (FAT)" );
 
 		case 0xf0:
-			description = "Linux/PA-RISC boot";
-			break;
+			return( "Linux/PA-RISC boot" );
 
 		case 0xf1:
-			description = "SpeedStor";
-			break;
+			return( "SpeedStor" );
 
 		case 0xf4:
-			description = "SpeedStor";
-			break;
+			return( "SpeedStor" );
 
 		case 0xf2:
-			description = "DOS secondary";
-			break;
+			return( "DOS secondary" );
 
 		case 0xfd:
-			description = "Linux raid autodetect";
-			break;
+			return( "Linux raid autodetect" );
 
 		case 0xfe:
-			description = "LANstep";
-			break;
+			return( "LANstep" );
 
 		case 0xff:
-			description = "BBT";
-			break;
+			return( "BBT" );
+	}
+	return( NULL );
+}
+
+/* Prints the partition type
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_partition_type_fprint(
+     info_handle_t *info_handle,
+     uint8_t partition_type,
+     libcerror_error_t **error )
+{
+	const char *description = NULL;
+	static char *function   = "info_handle_partition_type_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
 	}
+	description = info_handle_get_partition_type_description(
+	               partition_type );
+
 	fprintf(
 	 info_handle->notify_stream,
 	 "\tType\t\t\t: 0x%02" PRIx8 "",
@@ -1166,3 +1207,1406 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_CSV;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "json" ),
+		     4 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSON;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+			result                     = 1;
+		}
+	}
+	return( result );
+}
+
+/* Flushes the output buffer to the notification output stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_flush(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_flush";
+	size_t write_count    = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = fwrite(
+	               info_handle->output_buffer,
+	               1,
+	               info_handle->output_buffer_offset,
+	               info_handle->notify_stream );
+
+	if( write_count != info_handle->output_buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->output_buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Writes data to the output buffer
+ * The output buffer is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write(
+     info_handle_t *info_handle,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_write";
+	size_t data_offset    = 0;
+	size_t write_size     = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( info_handle->output_buffer_offset >= INFO_HANDLE_OUTPUT_BUFFER_SIZE )
+		{
+			if( info_handle_output_flush(
+			     info_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		write_size = INFO_HANDLE_OUTPUT_BUFFER_SIZE - info_handle->output_buffer_offset;
+
+		if( write_size > ( data_size - data_offset ) )
+		{
+			write_size = data_size - data_offset;
+		}
+		if( memory_copy(
+		     &( info_handle->output_buffer[ info_handle->output_buffer_offset ] ),
+		     &( data[ data_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		info_handle->output_buffer_offset += write_size;
+		data_offset                       += write_size;
+	}
+	return( 1 );
+}
+
+/* Writes a string to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_string(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned integer value as a decimal to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_decimal(
+     info_handle_t *info_handle,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	char digits[ 20 ];
+
+	static char *function = "info_handle_output_write_decimal";
+	size_t digit_index    = 20;
+
+	do
+	{
+		digit_index -= 1;
+
+		digits[ digit_index ] = (char) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( info_handle_output_write(
+	     info_handle,
+	     &( digits[ digit_index ] ),
+	     20 - digit_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write decimal value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a GUID to the output buffer
+ * The GUID is formatted directly from the byte stream in lower case
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_guid(
+     info_handle_t *info_handle,
+     const uint8_t *guid_data,
+     libcerror_error_t **error )
+{
+	char guid_string[ 36 ];
+
+	static char *function = "info_handle_output_write_guid";
+	size_t string_index   = 0;
+	int byte_index        = 0;
+	int order_index       = 0;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	for( order_index = 0;
+	     order_index < 20;
+	     order_index++ )
+	{
+		byte_index = info_handle_guid_byte_order[ order_index ];
+
+		if( byte_index == -1 )
+		{
+			guid_string[ string_index++ ] = '-';
+		}
+		else
+		{
+			guid_string[ string_index++ ] = info_handle_hexadecimal_digits[ guid_data[ byte_index ] >> 4 ];
+			guid_string[ string_index++ ] = info_handle_hexadecimal_digits[ guid_data[ byte_index ] & 0x0f ];
+		}
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     guid_string,
+	     36,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write GUID.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a quoted string to the output buffer
+ * The string is escaped according to the output format, for JSON characters
+ * outside the ASCII range of a wide string are written as \u escape sequences
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_quoted_string(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	char escaped_character[ 6 ];
+
+	static char *function     = "info_handle_output_write_quoted_string";
+	size_t escaped_size       = 0;
+	size_t string_index       = 0;
+	uint16_t character_value  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( string[ string_index ] != 0 )
+	{
+		character_value = (uint16_t) string[ string_index++ ];
+
+		escaped_character[ 0 ] = (char) character_value;
+		escaped_size           = 1;
+
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			/* A quote is escaped by doubling it
+			 */
+			if( character_value == (uint16_t) '"' )
+			{
+				escaped_character[ 1 ] = '"';
+				escaped_size           = 2;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			else if( character_value >= 0x80 )
+			{
+				escaped_character[ 0 ] = '?';
+			}
+#endif
+		}
+		else if( ( character_value == (uint16_t) '"' )
+		      || ( character_value == (uint16_t) '\\' ) )
+		{
+			escaped_character[ 0 ] = '\\';
+			escaped_character[ 1 ] = (char) character_value;
+			escaped_size           = 2;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		else if( ( character_value < 0x20 )
+		      || ( character_value >= 0x80 ) )
+#else
+		else if( character_value < 0x20 )
+#endif
+		{
+			escaped_character[ 0 ] = '\\';
+			escaped_character[ 1 ] = 'u';
+			escaped_character[ 2 ] = info_handle_hexadecimal_digits[ ( character_value >> 12 ) & 0x0f ];
+			escaped_character[ 3 ] = info_handle_hexadecimal_digits[ ( character_value >> 8 ) & 0x0f ];
+			escaped_character[ 4 ] = info_handle_hexadecimal_digits[ ( character_value >> 4 ) & 0x0f ];
+			escaped_character[ 5 ] = info_handle_hexadecimal_digits[ character_value & 0x0f ];
+			escaped_size           = 6;
+		}
+		if( info_handle_output_write(
+		     info_handle,
+		     escaped_character,
+		     escaped_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write quoted string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the output header
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_header_write(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *header    = NULL;
+	static char *function = "info_handle_output_header_write";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_records = 0;
+
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		header = "source,disk_identifier,bytes_per_sector,number_of_partitions,"
+		         "partition_number,partition_identifier,partition_type_identifier,"
+		         "partition_type,partition_offset,partition_size\n";
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		header = "[\n";
+	}
+	if( header != NULL )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the output footer and flushes the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_footer_write(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_footer_write";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     ( info_handle->number_of_records > 0 ) ? "\n]\n" : "]\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write footer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_handle_output_flush(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the partition fields of a record
+ * For JSON the fields are written as an object, for CSV as the partition columns
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_partition_record_write(
+     info_handle_t *info_handle,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error )
+{
+	uint8_t guid_data[ 16 ];
+	uint8_t type_guid_data[ 16 ];
+
+	const char *type_description = NULL;
+	static char *function        = "info_handle_partition_record_write";
+	size64_t size                = 0;
+	off64_t volume_offset        = 0;
+	uint32_t entry_index         = 0;
+	uint8_t is_csv               = 0;
+	uint8_t type                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_entry_index(
+	     partition,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_identifier(
+	     partition,
+	     guid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_type_identifier(
+	     partition,
+	     type_guid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_type(
+	     partition,
+	     &type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_volume_offset(
+	     partition,
+	     &volume_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_partition_get_size(
+	     partition,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		return( -1 );
+	}
+	is_csv = (uint8_t) ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "" : "{\"number\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) entry_index + 1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"identifier\":\"",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_guid(
+	     info_handle,
+	     guid_data,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : "\",\"type_identifier\":\"",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_guid(
+	     info_handle,
+	     type_guid_data,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : "\",\"type\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) type,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( is_csv == 0 )
+	{
+		type_description = info_handle_get_partition_type_description(
+		                    type );
+
+		if( info_handle_output_write_string(
+		     info_handle,
+		     ",\"type_description\":",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( type_description == NULL )
+		{
+			if( info_handle_output_write_string(
+			     info_handle,
+			     "null",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* The descriptions are ASCII strings without characters that need escaping
+			 */
+			if( info_handle_output_write_string(
+			     info_handle,
+			     "\"",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( info_handle_output_write_string(
+			     info_handle,
+			     type_description,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( info_handle_output_write_string(
+			     info_handle,
+			     "\"",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"offset\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) volume_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"size\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "" : "}",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write partition record.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the volume fields of a record
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_fields_write(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     const uint8_t *disk_guid_data,
+     uint32_t bytes_per_sector,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_volume_fields_write";
+	uint8_t is_csv        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	is_csv = (uint8_t) ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "" : "{\"source\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_quoted_string(
+	     info_handle,
+	     source,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"disk_identifier\":\"",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_guid(
+	     info_handle,
+	     disk_guid_data,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : "\",\"bytes_per_sector\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) bytes_per_sector,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"number_of_partitions\":",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_decimal(
+	     info_handle,
+	     (uint64_t) number_of_partitions,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     is_csv ? "," : ",\"partitions\":[",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write volume fields.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the record of the volume
+ * For JSON and JSON lines a single record is written per volume, for CSV a row
+ * is written per partition, or a row without partition columns if the volume has no partitions
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_record_write(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	uint8_t disk_guid_data[ 16 ];
+
+	libvsgpt_partition_t *partition = NULL;
+	static char *function           = "info_handle_volume_record_write";
+	uint32_t bytes_per_sector       = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	 && ( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	 && ( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported output format.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsgpt_volume_get_disk_identifier(
+	     info_handle->input_volume,
+	     disk_guid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve disk identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_get_bytes_per_sector(
+	     info_handle->input_volume,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes per sector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     info_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	 && ( info_handle->number_of_records > 0 ) )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     ",\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		if( info_handle_volume_fields_write(
+		     info_handle,
+		     source,
+		     disk_guid_data,
+		     bytes_per_sector,
+		     number_of_partitions,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else if( number_of_partitions == 0 )
+	{
+		if( info_handle_volume_fields_write(
+		     info_handle,
+		     source,
+		     disk_guid_data,
+		     bytes_per_sector,
+		     number_of_partitions,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( info_handle_output_write_string(
+		     info_handle,
+		     ",,,,,\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsgpt_volume_get_partition_by_index(
+		     info_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			if( info_handle_volume_fields_write(
+			     info_handle,
+			     source,
+			     disk_guid_data,
+			     bytes_per_sector,
+			     number_of_partitions,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		else if( partition_index > 0 )
+		{
+			if( info_handle_output_write_string(
+			     info_handle,
+			     ",",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( info_handle_partition_record_write(
+		     info_handle,
+		     partition,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			if( info_handle_output_write_string(
+			     info_handle,
+			     "\n",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( libvsgpt_partition_free(
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "]}",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "]}\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	info_handle->number_of_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Processes a source
+ * Opens the source, prints or writes its information and closes it
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_process_source(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_process_source";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_open_input(
+	     info_handle,
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		result = info_handle_partitions_fprint(
+		          info_handle,
+		          error );
+	}
+	else
+	{
+		result = info_handle_volume_record_write(
+		          info_handle,
+		          source,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print partitions information.",
+		 function );
+	}
+	if( info_handle_close_input(
+	     info_handle,
+	     ( result == 1 ) ? error : NULL ) != 0 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source.",
+			 function );
+		}
+		result = -1;
+	}
+	return( result );
+}
+
+/* Processes the sources in a file list stream
+ * The file list contains a source per line, empty lines are ignored.
+ * A source that cannot be processed is reported and skipped
+ * Returns 1 if all sources were processed, 0 if one or more sources could not be processed or -1 on error
+ */
+int info_handle_process_file_list_stream(
+     info_handle_t *info_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t source[ INFO_HANDLE_MAXIMUM_SOURCE_LENGTH ];
+
+	libcerror_error_t *source_error = NULL;
+	static char *function           = "info_handle_process_file_list_stream";
+	size_t source_length            = 0;
+	int result                      = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( info_handle_file_stream_get_string(
+	        stream,
+	        source,
+	        INFO_HANDLE_MAXIMUM_SOURCE_LENGTH ) != NULL )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		source_length = system_string_length(
+		                 source );
+
+		if( ( source_length > 0 )
+		 && ( source[ source_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end(
+		       stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid source value exceeds maximum length.",
+			 function );
+
+			return( -1 );
+		}
+		while( ( source_length > 0 )
+		    && ( ( source[ source_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( source[ source_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			source_length--;
+		}
+		if( source_length == 0 )
+		{
+			continue;
+		}
+		source[ source_length ] = 0;
+
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "Source: %" PRIs_SYSTEM "\n\n",
+			 source );
+		}
+		if( info_handle_process_source(
+		     info_handle,
+		     source,
+		     &source_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process source: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			libcnotify_print_error_backtrace(
+			 source_error );
+			libcerror_error_free(
+			 &source_error );
+
+			result = 0;
+		}
+	}
+	return( result );
+}
+
@@ -33,6 +33,22 @@
 extern "C" {
 #endif
 
+/* The size of the output buffer of the machine-readable output formats
+ */
+#define INFO_HANDLE_OUTPUT_BUFFER_SIZE		65536
+
+/* The maximum length of a source in a file list
+ */
+#define INFO_HANDLE_MAXIMUM_SOURCE_LENGTH	4096
+
+enum INFO_HANDLE_OUTPUT_FORMATS
+{
+	INFO_HANDLE_OUTPUT_FORMAT_TEXT		= 0,
+	INFO_HANDLE_OUTPUT_FORMAT_CSV		= 1,
+	INFO_HANDLE_OUTPUT_FORMAT_JSON		= 2,
+	INFO_HANDLE_OUTPUT_FORMAT_JSONL		= 3
+};
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -45,6 +61,34 @@ struct info_handle
 	 */
 	FILE *notify_stream;
 
+	/* Value to indicate if the reads done when opening the input should be traced
+	 */
+	int trace_io;
+
+	/* The number of traced reads
+	 */
+	uint64_t number_of_traced_reads;
+
+	/* The number of bytes of the traced reads
+	 */
+	size64_t traced_read_size;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The output buffer of the machine-readable output formats
+	 */
+	char output_buffer[ INFO_HANDLE_OUTPUT_BUFFER_SIZE ];
+
+	/* The number of bytes in the output buffer
+	 */
+	size_t output_buffer_offset;
+
+	/* The number of records written
+	 */
+	uint64_t number_of_records;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -62,6 +106,17 @@ int info_handle_signal_abort(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+const char *info_handle_get_open_phase_description(
+             int phase );
+
+void info_handle_trace_callback(
+      int event_type,
+      int phase,
+      off64_t offset,
+      size64_t size,
+      uint64_t duration,
+      void *user_data );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -77,6 +132,9 @@ int info_handle_guid_value_fprint(
      const uint8_t *guid_data,
      libcerror_error_t **error );
 
+const char *info_handle_get_partition_type_description(
+             uint8_t partition_type );
+
 int info_handle_partition_type_fprint(
      info_handle_t *info_handle,
      uint8_t partition_type,
@@ -91,6 +149,77 @@ int info_handle_partitions_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_output_flush(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_write(
+     info_handle_t *info_handle,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int info_handle_output_write_string(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error );
+
+int info_handle_output_write_decimal(
+     info_handle_t *info_handle,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int info_handle_output_write_guid(
+     info_handle_t *info_handle,
+     const uint8_t *guid_data,
+     libcerror_error_t **error );
+
+int info_handle_output_write_quoted_string(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_output_header_write(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_footer_write(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_partition_record_write(
+     info_handle_t *info_handle,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error );
+
+int info_handle_volume_fields_write(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     const uint8_t *disk_guid_data,
+     uint32_t bytes_per_sector,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+int info_handle_volume_record_write(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int info_handle_process_source(
+     info_handle_t *info_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int info_handle_process_file_list_stream(
+     info_handle_t *info_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1257 @@
+/*
+ * Mount file entry
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "mount_file_entry.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libvsgpt.h"
+
+/* Creates a file entry
+ * Make sure the value file_entry is referencing, is set to NULL
+ * The file entry takes over management of the partition, a file entry without partition is the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_initialize(
+     mount_file_entry_t **file_entry,
+     const system_character_t *name,
+     size_t name_length,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_initialize";
+	int slot_index        = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*file_entry = memory_allocate_structure(
+	               mount_file_entry_t );
+
+	if( *file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_entry,
+	     0,
+	     sizeof( mount_file_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entry.",
+		 function );
+
+		memory_free(
+		 *file_entry );
+
+		*file_entry = NULL;
+
+		return( -1 );
+	}
+	( *file_entry )->name = system_string_allocate(
+	                         name_length + 1 );
+
+	if( ( *file_entry )->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name string.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_length > 0 )
+	{
+		if( system_string_copy(
+		     ( *file_entry )->name,
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *file_entry )->name[ name_length ] = 0;
+
+	( *file_entry )->name_size = name_length + 1;
+
+	if( partition != NULL )
+	{
+		if( libvsgpt_partition_get_size(
+		     partition,
+		     &( ( *file_entry )->size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( slot_index = 0;
+	     slot_index < MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS;
+	     slot_index++ )
+	{
+		( *file_entry )->read_ahead_slots[ slot_index ].data_offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_entry )->read_ahead_slots_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead slots mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *file_entry )->read_ahead_slots_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead slots condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *file_entry )->partition = partition;
+
+	return( 1 );
+
+on_error:
+	if( *file_entry != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *file_entry )->read_ahead_slots_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *file_entry )->read_ahead_slots_mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *file_entry )->name != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->name );
+		}
+		memory_free(
+		 *file_entry );
+
+		*file_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_free(
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_free";
+	int result                               = 1;
+	int slot_index                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		for( slot_index = 0;
+		     slot_index < MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS;
+		     slot_index++ )
+		{
+			read_ahead_slot = &( ( *file_entry )->read_ahead_slots[ slot_index ] );
+
+			if( read_ahead_slot->partition_cursor != NULL )
+			{
+				if( libvsgpt_partition_cursor_free(
+				     &( read_ahead_slot->partition_cursor ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition cursor of read-ahead slot: %d.",
+					 function,
+					 slot_index );
+
+					result = -1;
+				}
+			}
+			if( read_ahead_slot->data != NULL )
+			{
+				memory_free(
+				 read_ahead_slot->data );
+			}
+		}
+		/* The partition cursors must be freed before the partition
+		 */
+		if( ( *file_entry )->partition != NULL )
+		{
+			if( libvsgpt_partition_free(
+			     &( ( *file_entry )->partition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *file_entry )->read_ahead_slots_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead slots condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *file_entry )->read_ahead_slots_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead slots mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *file_entry )->name != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->name );
+		}
+		memory_free(
+		 *file_entry );
+
+		*file_entry = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_name_size(
+     mount_file_entry_t *file_entry,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_name_size";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = file_entry->name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_name(
+     mount_file_entry_t *file_entry,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_name";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < file_entry->name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     string,
+	     file_entry->name,
+	     file_entry->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the file entry is a directory
+ * Returns 1 if a directory, 0 if not or -1 on error
+ */
+int mount_file_entry_is_directory(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_is_directory";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->partition == NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_size(
+     mount_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_size";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = file_entry->size;
+
+	return( 1 );
+}
+
+/* Grabs the read-ahead slot of a block
+ * If a slot contains the data of the block it is shared with other readers,
+ * otherwise the least recently used free slot is reserved to be filled by the caller.
+ * If the block is being filled by another reader this function waits for it
+ * instead of reading the same data again.
+ * Every slot that was grabbed must be released by mount_file_entry_release_read_ahead_slot
+ * and a reserved slot must first be completed by mount_file_entry_complete_read_ahead_slot
+ * Returns 1 if the slot contains the data, 0 if the slot was reserved to be filled or -1 on error
+ */
+int mount_file_entry_grab_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     off64_t block_offset,
+     int *slot_index,
+     libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_grab_read_ahead_slot";
+	int free_slot_index                      = 0;
+	int is_filling                           = 0;
+	int result                               = 0;
+	int safe_slot_index                      = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_offset < 0 )
+	 || ( ( block_offset % MOUNT_FILE_ENTRY_READ_AHEAD_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		free_slot_index = -1;
+		is_filling      = 0;
+		result          = -1;
+
+		for( safe_slot_index = 0;
+		     safe_slot_index < MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS;
+		     safe_slot_index++ )
+		{
+			read_ahead_slot = &( file_entry->read_ahead_slots[ safe_slot_index ] );
+
+			if( read_ahead_slot->data_offset == block_offset )
+			{
+				if( read_ahead_slot->is_filling != 0 )
+				{
+					is_filling = 1;
+				}
+				else
+				{
+					read_ahead_slot->number_of_readers += 1;
+
+					result = 1;
+				}
+				break;
+			}
+			if( ( read_ahead_slot->is_filling == 0 )
+			 && ( read_ahead_slot->number_of_readers == 0 ) )
+			{
+				if( ( free_slot_index == -1 )
+				 || ( read_ahead_slot->last_used < file_entry->read_ahead_slots[ free_slot_index ].last_used ) )
+				{
+					free_slot_index = safe_slot_index;
+				}
+			}
+		}
+		if( ( result == -1 )
+		 && ( is_filling == 0 )
+		 && ( free_slot_index != -1 ) )
+		{
+			safe_slot_index = free_slot_index;
+			read_ahead_slot = &( file_entry->read_ahead_slots[ safe_slot_index ] );
+
+			read_ahead_slot->data_offset = block_offset;
+			read_ahead_slot->data_size   = 0;
+			read_ahead_slot->is_filling  = 1;
+
+			result = 0;
+		}
+		if( result == -1 )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			/* Wait until the block was filled by another reader or a slot was released
+			 */
+			if( libcthreads_condition_wait(
+			     file_entry->read_ahead_slots_condition,
+			     file_entry->read_ahead_slots_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for read-ahead slots condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 file_entry->read_ahead_slots_mutex,
+				 NULL );
+
+				return( -1 );
+			}
+#else
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing free read-ahead slot.",
+			 function );
+
+			return( -1 );
+#endif
+		}
+	}
+	while( result == -1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*slot_index = safe_slot_index;
+
+	return( result );
+}
+
+/* Completes filling a reserved read-ahead slot
+ * If the read count is 0 or less the slot is made available again without data,
+ * otherwise the caller becomes a reader of the slot
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_complete_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     int slot_index,
+     ssize_t read_count,
+     libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_complete_read_ahead_slot";
+	int result                               = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count > (ssize_t) MOUNT_FILE_ENTRY_READ_AHEAD_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead_slot = &( file_entry->read_ahead_slots[ slot_index ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_ahead_slot->is_filling == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead slot: %d - not reserved to be filled.",
+		 function,
+		 slot_index );
+
+		result = -1;
+	}
+	else
+	{
+		read_ahead_slot->is_filling = 0;
+
+		if( read_count <= 0 )
+		{
+			/* An empty slot is reused before slots that contain data
+			 */
+			read_ahead_slot->data_offset = -1;
+			read_ahead_slot->data_size   = 0;
+			read_ahead_slot->last_used   = 0;
+		}
+		else
+		{
+			read_ahead_slot->data_size         = (size_t) read_count;
+			read_ahead_slot->number_of_readers = 1;
+
+			file_entry->usage_counter += 1;
+
+			read_ahead_slot->last_used = file_entry->usage_counter;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( result == 1 )
+	{
+		if( libcthreads_condition_broadcast(
+		     file_entry->read_ahead_slots_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast read-ahead slots condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a read-ahead slot
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_release_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_release_read_ahead_slot";
+	int result                               = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead_slot = &( file_entry->read_ahead_slots[ slot_index ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_ahead_slot->number_of_readers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead slot: %d - missing readers.",
+		 function,
+		 slot_index );
+
+		result = -1;
+	}
+	else
+	{
+		read_ahead_slot->number_of_readers -= 1;
+
+		file_entry->usage_counter += 1;
+
+		read_ahead_slot->last_used = file_entry->usage_counter;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* A reader could be waiting for a free slot
+	 */
+	if( ( result == 1 )
+	 && ( read_ahead_slot->number_of_readers == 0 ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     file_entry->read_ahead_slots_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast read-ahead slots condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     file_entry->read_ahead_slots_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead slots mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Fills a reserved read-ahead slot with the partition data of its block
+ * The slot is only accessed by the caller while it is reserved, every slot has
+ * its own partition cursor so that slots can be filled concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_file_entry_fill_read_ahead_slot(
+         mount_file_entry_t *file_entry,
+         int slot_index,
+         libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_fill_read_ahead_slot";
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead_slot = &( file_entry->read_ahead_slots[ slot_index ] );
+
+	if( ( read_ahead_slot->is_filling == 0 )
+	 || ( read_ahead_slot->data_offset < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead slot: %d - not reserved to be filled.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	if( (size64_t) read_ahead_slot->data_offset >= file_entry->size )
+	{
+		return( 0 );
+	}
+	if( read_ahead_slot->data == NULL )
+	{
+		read_ahead_slot->data = (uint8_t *) memory_allocate(
+		                                     sizeof( uint8_t ) * MOUNT_FILE_ENTRY_READ_AHEAD_SIZE );
+
+		if( read_ahead_slot->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data of read-ahead slot: %d.",
+			 function,
+			 slot_index );
+
+			return( -1 );
+		}
+	}
+	if( read_ahead_slot->partition_cursor == NULL )
+	{
+		if( libvsgpt_partition_cursor_initialize(
+		     &( read_ahead_slot->partition_cursor ),
+		     file_entry->partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition cursor of read-ahead slot: %d.",
+			 function,
+			 slot_index );
+
+			return( -1 );
+		}
+	}
+	read_size = MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+
+	if( (size64_t) read_size > ( file_entry->size - read_ahead_slot->data_offset ) )
+	{
+		read_size = (size_t) ( file_entry->size - read_ahead_slot->data_offset );
+	}
+	read_count = libvsgpt_partition_cursor_read_buffer_at_offset(
+	              read_ahead_slot->partition_cursor,
+	              read_ahead_slot->data,
+	              read_size,
+	              read_ahead_slot->data_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_ahead_slot->data_offset,
+		 read_ahead_slot->data_offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * The data is read in blocks of MOUNT_FILE_ENTRY_READ_AHEAD_SIZE that are kept
+ * in the read-ahead slots for subsequent reads
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_file_entry_read_buffer_at_offset(
+         mount_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	mount_read_ahead_slot_t *read_ahead_slot = NULL;
+	static char *function                    = "mount_file_entry_read_buffer_at_offset";
+	size_t buffer_offset                     = 0;
+	size_t data_offset                       = 0;
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+	off64_t block_offset                     = 0;
+	int result                               = 0;
+	int slot_index                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( buffer_offset < buffer_size )
+	    && ( (size64_t) offset < file_entry->size ) )
+	{
+		block_offset = offset - ( offset % MOUNT_FILE_ENTRY_READ_AHEAD_SIZE );
+
+		result = mount_file_entry_grab_read_ahead_slot(
+		          file_entry,
+		          block_offset,
+		          &slot_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab read-ahead slot for block at offset: %" PRIi64 ".",
+			 function,
+			 block_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			read_count = mount_file_entry_fill_read_ahead_slot(
+			              file_entry,
+			              slot_index,
+			              error );
+
+			if( mount_file_entry_complete_read_ahead_slot(
+			     file_entry,
+			     slot_index,
+			     read_count,
+			     ( read_count < 0 ) ? NULL : error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to complete read-ahead slot: %d.",
+				 function,
+				 slot_index );
+
+				return( -1 );
+			}
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to fill read-ahead slot: %d.",
+				 function,
+				 slot_index );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
+		}
+		/* The data of the slot is not changed while the slot has readers
+		 */
+		read_ahead_slot = &( file_entry->read_ahead_slots[ slot_index ] );
+
+		data_offset = (size_t) ( offset - block_offset );
+		read_size   = 0;
+
+		if( data_offset < read_ahead_slot->data_size )
+		{
+			read_size = read_ahead_slot->data_size - data_offset;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     &( read_ahead_slot->data[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data of read-ahead slot: %d.",
+				 function,
+				 slot_index );
+
+				mount_file_entry_release_read_ahead_slot(
+				 file_entry,
+				 slot_index,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( mount_file_entry_release_read_ahead_slot(
+		     file_entry,
+		     slot_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read-ahead slot: %d.",
+			 function,
+			 slot_index );
+
+			return( -1 );
+		}
+		if( read_size == 0 )
+		{
+			break;
+		}
+		buffer_offset += read_size;
+		offset        += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
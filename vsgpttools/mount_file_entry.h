@@ -0,0 +1,187 @@
+/*
+ * Mount file entry
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FILE_ENTRY_H )
+#define _MOUNT_FILE_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the FUSE read requests
+ */
+#define MOUNT_FILE_ENTRY_REQUEST_SIZE			( 128 * 1024 )
+
+/* The size of a read-ahead block, which covers 4 consecutive read requests
+ */
+#define MOUNT_FILE_ENTRY_READ_AHEAD_SIZE		( 4 * MOUNT_FILE_ENTRY_REQUEST_SIZE )
+
+/* The number of read-ahead slots per file entry, which determines the number of
+ * readers that can fill a read-ahead block concurrently and the size of the cache
+ */
+#define MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS	8
+
+typedef struct mount_read_ahead_slot mount_read_ahead_slot_t;
+
+struct mount_read_ahead_slot
+{
+	/* The partition cursor used to fill the slot
+	 */
+	libvsgpt_partition_cursor_t *partition_cursor;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The offset of the data, which is aligned to MOUNT_FILE_ENTRY_READ_AHEAD_SIZE
+	 * or -1 if the slot does not contain data
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of readers that are copying data from the slot
+	 */
+	int number_of_readers;
+
+	/* Value to indicate the slot is being filled
+	 */
+	uint8_t is_filling;
+
+	/* The value of the usage counter when the slot was last used
+	 */
+	uint64_t last_used;
+};
+
+typedef struct mount_file_entry mount_file_entry_t;
+
+struct mount_file_entry
+{
+	/* The name
+	 */
+	system_character_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The partition or NULL if the file entry is the root directory
+	 */
+	libvsgpt_partition_t *partition;
+
+	/* The size of the partition data
+	 */
+	size64_t size;
+
+	/* The read-ahead slots
+	 */
+	mount_read_ahead_slot_t read_ahead_slots[ MOUNT_FILE_ENTRY_NUMBER_OF_READ_AHEAD_SLOTS ];
+
+	/* The usage counter of the read-ahead slots
+	 */
+	uint64_t usage_counter;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read-ahead slots mutex
+	 */
+	libcthreads_mutex_t *read_ahead_slots_mutex;
+
+	/* The read-ahead slots condition
+	 */
+	libcthreads_condition_t *read_ahead_slots_condition;
+#endif
+};
+
+int mount_file_entry_initialize(
+     mount_file_entry_t **file_entry,
+     const system_character_t *name,
+     size_t name_length,
+     libvsgpt_partition_t *partition,
+     libcerror_error_t **error );
+
+int mount_file_entry_free(
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_name_size(
+     mount_file_entry_t *file_entry,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_name(
+     mount_file_entry_t *file_entry,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int mount_file_entry_is_directory(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_size(
+     mount_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int mount_file_entry_grab_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     off64_t block_offset,
+     int *slot_index,
+     libcerror_error_t **error );
+
+int mount_file_entry_complete_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     int slot_index,
+     ssize_t read_count,
+     libcerror_error_t **error );
+
+int mount_file_entry_release_read_ahead_slot(
+     mount_file_entry_t *file_entry,
+     int slot_index,
+     libcerror_error_t **error );
+
+ssize_t mount_file_entry_fill_read_ahead_slot(
+         mount_file_entry_t *file_entry,
+         int slot_index,
+         libcerror_error_t **error );
+
+ssize_t mount_file_entry_read_buffer_at_offset(
+         mount_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_FILE_ENTRY_H ) */
+
@@ -0,0 +1,728 @@
+/*
+ * Mount file system
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "mount_file_entry.h"
+#include "mount_file_system.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+/* Creates a file system
+ * Make sure the value file_system is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_initialize(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_initialize";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_system = memory_allocate_structure(
+	                mount_file_system_t );
+
+	if( *file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file system.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_system,
+	     0,
+	     sizeof( mount_file_system_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file system.",
+		 function );
+
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+
+		return( -1 );
+	}
+	if( mount_file_entry_initialize(
+	     &( ( *file_system )->root_file_entry ),
+	     _SYSTEM_STRING( "" ),
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_system != NULL )
+	{
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the partition file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_free_partition_file_entries(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_free_partition_file_entries";
+	int partition_index   = 0;
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->partition_file_entries != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < file_system->number_of_partitions;
+		     partition_index++ )
+		{
+			if( mount_file_entry_free(
+			     &( file_system->partition_file_entries[ partition_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition: %d file entry.",
+				 function,
+				 partition_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 file_system->partition_file_entries );
+
+		file_system->partition_file_entries = NULL;
+	}
+	file_system->number_of_partitions = 0;
+
+	return( result );
+}
+
+/* Frees a file system
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_free(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_free";
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_system != NULL )
+	{
+		/* The volume is not managed by the file system
+		 */
+		if( mount_file_system_free_partition_file_entries(
+		     *file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition file entries.",
+			 function );
+
+			result = -1;
+		}
+		if( mount_file_entry_free(
+		     &( ( *file_system )->root_file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root file entry.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *file_system );
+
+		*file_system = NULL;
+	}
+	return( result );
+}
+
+/* Signals the file system to abort
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_signal_abort(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_signal_abort";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->volume != NULL )
+	{
+		if( libvsgpt_volume_signal_abort(
+		     file_system->volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume
+ * Creates a file entry for every partition of the volume, a NULL volume removes the file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_volume(
+     mount_file_system_t *file_system,
+     libvsgpt_volume_t *volume,
+     libcerror_error_t **error )
+{
+	system_character_t name[ 32 ];
+
+	libvsgpt_partition_t *partition = NULL;
+	static char *function           = "mount_file_system_set_volume";
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int print_count                 = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_free_partition_file_entries(
+	     file_system,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition file entries.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->volume = volume;
+
+	if( volume == NULL )
+	{
+		return( 1 );
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_partitions < 0 )
+	 || ( number_of_partitions > MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_PARTITIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of partitions value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_partitions == 0 )
+	{
+		return( 1 );
+	}
+	file_system->partition_file_entries = (mount_file_entry_t **) memory_allocate(
+	                                                               sizeof( mount_file_entry_t * ) * number_of_partitions );
+
+	if( file_system->partition_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_system->partition_file_entries,
+	     0,
+	     sizeof( mount_file_entry_t * ) * number_of_partitions ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition file entries.",
+		 function );
+
+		memory_free(
+		 file_system->partition_file_entries );
+
+		file_system->partition_file_entries = NULL;
+
+		goto on_error;
+	}
+	file_system->number_of_partitions = number_of_partitions;
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsgpt_volume_get_partition_by_index(
+		     volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		print_count = system_string_sprintf(
+		               name,
+		               32,
+		               _SYSTEM_STRING( "%s%d" ),
+		               _SYSTEM_STRING( MOUNT_FILE_SYSTEM_PARTITION_NAME_PREFIX ),
+		               partition_index + 1 );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name of partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		/* The file entry takes over management of the partition
+		 */
+		if( mount_file_entry_initialize(
+		     &( file_system->partition_file_entries[ partition_index ] ),
+		     name,
+		     (size_t) print_count,
+		     partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition: %d file entry.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	mount_file_system_free_partition_file_entries(
+	 file_system,
+	 NULL );
+
+	file_system->volume = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the number of partitions
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_number_of_partitions(
+     mount_file_system_t *file_system,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_number_of_partitions";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_partitions = file_system->number_of_partitions;
+
+	return( 1 );
+}
+
+/* Retrieves a specific partition file entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_partition_file_entry_by_index(
+     mount_file_system_t *file_system,
+     int partition_index,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_partition_file_entry_by_index";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_index < 0 )
+	 || ( partition_index >= file_system->number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	*file_entry = file_system->partition_file_entries[ partition_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the partition index from a path
+ * The path is expected to be formatted as: /vsgpt#, where # is the 1-based partition number
+ * Returns 1 if successful, 0 if the path does not refer to a partition or -1 on error
+ */
+int mount_file_system_get_partition_index_from_path(
+     const system_character_t *path,
+     size_t path_length,
+     int *partition_index,
+     libcerror_error_t **error )
+{
+	static char *function     = "mount_file_system_get_partition_index_from_path";
+	size_t path_index         = 0;
+	size_t prefix_length      = 0;
+	int safe_partition_number = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition index.",
+		 function );
+
+		return( -1 );
+	}
+	prefix_length = 1 + ( sizeof( MOUNT_FILE_SYSTEM_PARTITION_NAME_PREFIX ) - 1 );
+
+	if( ( path_length <= prefix_length )
+	 || ( path[ 0 ] != (system_character_t) '/' ) )
+	{
+		return( 0 );
+	}
+	if( system_string_compare(
+	     &( path[ 1 ] ),
+	     _SYSTEM_STRING( MOUNT_FILE_SYSTEM_PARTITION_NAME_PREFIX ),
+	     prefix_length - 1 ) != 0 )
+	{
+		return( 0 );
+	}
+	/* The partition number cannot start with a 0
+	 */
+	if( path[ prefix_length ] == (system_character_t) '0' )
+	{
+		return( 0 );
+	}
+	for( path_index = prefix_length;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( ( path[ path_index ] < (system_character_t) '0' )
+		 || ( path[ path_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		safe_partition_number *= 10;
+		safe_partition_number += (int) ( path[ path_index ] - (system_character_t) '0' );
+
+		if( safe_partition_number > MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_PARTITIONS )
+		{
+			return( 0 );
+		}
+	}
+	*partition_index = safe_partition_number - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the file entry for a specific path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_file_system_get_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_file_entry_by_path";
+	int partition_index   = 0;
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 1 )
+	 && ( path[ 0 ] == (system_character_t) '/' ) )
+	{
+		*file_entry = file_system->root_file_entry;
+
+		return( 1 );
+	}
+	result = mount_file_system_get_partition_index_from_path(
+	          path,
+	          path_length,
+	          &partition_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition index from path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( partition_index >= file_system->number_of_partitions )
+	{
+		return( 0 );
+	}
+	*file_entry = file_system->partition_file_entries[ partition_index ];
+
+	return( 1 );
+}
+
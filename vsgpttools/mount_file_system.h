@@ -0,0 +1,115 @@
+/*
+ * Mount file system
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FILE_SYSTEM_H )
+#define _MOUNT_FILE_SYSTEM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "mount_file_entry.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The prefix of the names of the partition file entries
+ */
+#define MOUNT_FILE_SYSTEM_PARTITION_NAME_PREFIX		"vsgpt"
+
+/* The maximum number of partitions that are exposed
+ */
+#define MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_PARTITIONS	4096
+
+typedef struct mount_file_system mount_file_system_t;
+
+struct mount_file_system
+{
+	/* The volume
+	 */
+	libvsgpt_volume_t *volume;
+
+	/* The root directory file entry
+	 */
+	mount_file_entry_t *root_file_entry;
+
+	/* The partition file entries
+	 */
+	mount_file_entry_t **partition_file_entries;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+};
+
+int mount_file_system_initialize(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_free(
+     mount_file_system_t **file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_free_partition_file_entries(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_signal_abort(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_set_volume(
+     mount_file_system_t *file_system,
+     libvsgpt_volume_t *volume,
+     libcerror_error_t **error );
+
+int mount_file_system_get_number_of_partitions(
+     mount_file_system_t *file_system,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+int mount_file_system_get_partition_file_entry_by_index(
+     mount_file_system_t *file_system,
+     int partition_index,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int mount_file_system_get_partition_index_from_path(
+     const system_character_t *path,
+     size_t path_length,
+     int *partition_index,
+     libcerror_error_t **error );
+
+int mount_file_system_get_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_FILE_SYSTEM_H ) */
+
@@ -0,0 +1,2532 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include <time.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( WINAPI )
+#include <io.h>
+#endif
+
+#include "scan_handle.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libfguid.h"
+#include "vsgpttools_libvsgpt.h"
+
+#define SCAN_HANDLE_NOTIFY_STREAM	stderr
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_SCAN_HANDLE_DIRECTORY_SUPPORT
+#endif
+
+/* Creates a scan handle
+ * Make sure the value scan_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_initialize";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_handle = memory_allocate_structure(
+	                scan_handle_t );
+
+	if( *scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_handle,
+	     0,
+	     sizeof( scan_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan handle.",
+		 function );
+
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scan_handle )->output_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *scan_handle )->output_stream     = stdout;
+	( *scan_handle )->notify_stream     = SCAN_HANDLE_NOTIFY_STREAM;
+	( *scan_handle )->number_of_threads = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( *scan_handle != NULL )
+	{
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Parses a number of threads from a string
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function      = "scan_handle_parse_number_of_threads";
+	size_t string_index        = 0;
+	int safe_number_of_threads = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_number_of_threads *= 10;
+		safe_number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_number_of_threads > SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			break;
+		}
+	}
+	if( ( safe_number_of_threads <= 0 )
+	 || ( safe_number_of_threads > SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = safe_number_of_threads;
+
+	return( 1 );
+}
+
+/* Frees a scan handle
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free";
+	int source_index      = 0;
+	int result            = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan_handle )->scan_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *scan_handle )->scan_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join scan thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *scan_handle )->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *scan_handle )->completed_sources != NULL )
+		{
+			for( source_index = 0;
+			     source_index < ( *scan_handle )->number_of_completed_sources;
+			     source_index++ )
+			{
+				memory_free(
+				 ( *scan_handle )->completed_sources[ source_index ] );
+			}
+			memory_free(
+			 ( *scan_handle )->completed_sources );
+		}
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the scan handle to abort
+ * Sources that were not scanned yet are skipped, so that a resumed scan picks them up
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_signal_abort";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the output
+ * If filename is NULL the records are written to stdout
+ * If resume is set, the sources in an existing output file are considered completed
+ * and new records are appended to the output file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_open_output(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     uint8_t resume,
+     libcerror_error_t **error )
+{
+	FILE *resume_stream        = NULL;
+	static char *function      = "scan_handle_open_output";
+	size64_t records_data_size = 0;
+	uint8_t truncate_output    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->output_stream_opened != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - output stream already opened.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		if( resume != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: resume requires an output file.",
+			 function );
+
+			return( -1 );
+		}
+		scan_handle->output_stream = stdout;
+
+		return( 1 );
+	}
+	if( resume != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		resume_stream = file_stream_open_wide(
+		                 filename,
+		                 _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+		resume_stream = file_stream_open(
+		                 filename,
+		                 FILE_STREAM_OPEN_READ );
+#endif
+		/* A missing output file is not an error, the scan starts from the beginning
+		 */
+		if( resume_stream != NULL )
+		{
+			if( scan_handle_read_completed_sources(
+			     scan_handle,
+			     resume_stream,
+			     &records_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read completed sources.",
+				 function );
+
+				goto on_error;
+			}
+			file_stream_close(
+			 resume_stream );
+
+			resume_stream   = NULL;
+			truncate_output = 1;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( resume != 0 )
+	{
+		scan_handle->output_stream = file_stream_open_wide(
+		                              filename,
+		                              _SYSTEM_STRING( FILE_STREAM_OPEN_APPEND ) );
+	}
+	else
+	{
+		scan_handle->output_stream = file_stream_open_wide(
+		                              filename,
+		                              _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+	}
+#else
+	if( resume != 0 )
+	{
+		scan_handle->output_stream = file_stream_open(
+		                              filename,
+		                              FILE_STREAM_OPEN_APPEND );
+	}
+	else
+	{
+		scan_handle->output_stream = file_stream_open(
+		                              filename,
+		                              FILE_STREAM_OPEN_WRITE );
+	}
+#endif
+	if( scan_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	scan_handle->output_stream_opened = 1;
+
+	/* Remove the record that a previous scan was interrupted while writing,
+	 * so that the appended records continue a valid JSON Lines output
+	 */
+	if( truncate_output != 0 )
+	{
+#if defined( WINAPI )
+		if( _chsize_s(
+		     _fileno( scan_handle->output_stream ),
+		     (__int64) records_data_size ) != 0 )
+#else
+		if( ftruncate(
+		     fileno( scan_handle->output_stream ),
+		     (off_t) records_data_size ) != 0 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to truncate output file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( resume_stream != NULL )
+	{
+		file_stream_close(
+		 resume_stream );
+	}
+	if( scan_handle->output_stream_opened != 0 )
+	{
+		file_stream_close(
+		 scan_handle->output_stream );
+
+		scan_handle->output_stream_opened = 0;
+	}
+	scan_handle->output_stream = stdout;
+
+	return( -1 );
+}
+
+/* Closes the output
+ * Returns the 0 if successful or -1 on error
+ */
+int scan_handle_close_output(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_close_output";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->output_stream_opened != 0 )
+	{
+		if( file_stream_close(
+		     scan_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file.",
+			 function );
+
+			return( -1 );
+		}
+		scan_handle->output_stream_opened = 0;
+	}
+	scan_handle->output_stream = stdout;
+
+	return( 0 );
+}
+
+/* Compares two completed sources
+ * Callback function for qsort and bsearch
+ * Returns a value less than, equal to or greater than 0
+ */
+int scan_handle_compare_completed_sources(
+     const void *first_source,
+     const void *second_source )
+{
+	size_t compare_size = 0;
+
+	/* The end-of-string characters are compared so that a source does not match
+	 * a longer source it is a prefix of, without reading beyond the shortest one
+	 */
+	compare_size = narrow_string_length(
+	                *( (char * const *) first_source ) );
+
+	if( compare_size > narrow_string_length( *( (char * const *) second_source ) ) )
+	{
+		compare_size = narrow_string_length(
+		                *( (char * const *) second_source ) );
+	}
+	return( narrow_string_compare(
+	         *( (char * const *) first_source ),
+	         *( (char * const *) second_source ),
+	         compare_size + 1 ) );
+}
+
+/* Reads the completed sources from the output of a previous scan
+ * Only records that were completely written and did not fail are considered completed
+ * The records data size is the size of the output up to the end of the last
+ * completely written record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_read_completed_sources(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     size64_t *records_data_size,
+     libcerror_error_t **error )
+{
+	char line[ 4096 ];
+
+	char **completed_sources         = NULL;
+	char *pending_source             = NULL;
+	static char *function            = "scan_handle_read_completed_sources";
+	size64_t data_size               = 0;
+	size_t line_length               = 0;
+	size_t line_index                = 0;
+	size_t source_length             = 0;
+	uint8_t at_line_start            = 1;
+	uint8_t pending_source_is_error  = 0;
+	uint8_t source_is_completed      = 0;
+	int maximum_number_of_sources    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data size.",
+		 function );
+
+		return( -1 );
+	}
+	*records_data_size        = 0;
+	maximum_number_of_sources = scan_handle->number_of_completed_sources;
+
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        4096 ) != NULL )
+	{
+		line_length = narrow_string_length(
+		               line );
+
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		data_size += line_length;
+
+		/* The source is the first value of a record
+		 */
+		if( ( at_line_start != 0 )
+		 && ( line_length > 12 )
+		 && ( narrow_string_compare(
+		       line,
+		       "{\"source\": \"",
+		       12 ) == 0 ) )
+		{
+			for( line_index = 12;
+			     line_index < line_length;
+			     line_index++ )
+			{
+				if( line[ line_index ] == '\\' )
+				{
+					line_index++;
+				}
+				else if( line[ line_index ] == '"' )
+				{
+					break;
+				}
+			}
+			if( line_index < line_length )
+			{
+				source_length = line_index - 12;
+
+				if( pending_source != NULL )
+				{
+					memory_free(
+					 pending_source );
+				}
+				pending_source = narrow_string_allocate(
+				                  source_length + 1 );
+
+				if( pending_source == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create source.",
+					 function );
+
+					goto on_error;
+				}
+				if( narrow_string_copy(
+				     pending_source,
+				     &( line[ 12 ] ),
+				     source_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy source.",
+					 function );
+
+					goto on_error;
+				}
+				pending_source[ source_length ] = 0;
+
+				/* Sources that failed are scanned again
+				 */
+				pending_source_is_error = 0;
+
+				if( ( ( line_index + 20 ) <= line_length )
+				 && ( narrow_string_compare(
+				       &( line[ line_index + 1 ] ),
+				       ", \"status\": \"error\"",
+				       19 ) == 0 ) )
+				{
+					pending_source_is_error = 1;
+				}
+			}
+		}
+		at_line_start = (uint8_t) ( line[ line_length - 1 ] == '\n' );
+
+		if( ( at_line_start != 0 )
+		 && ( pending_source != NULL ) )
+		{
+			/* A record was completely written if it ends with }
+			 */
+			source_is_completed = 0;
+
+			if( ( line_length >= 2 )
+			 && ( line[ line_length - 2 ] == '}' ) )
+			{
+				*records_data_size  = data_size;
+				source_is_completed = (uint8_t) ( pending_source_is_error == 0 );
+			}
+			if( source_is_completed != 0 )
+			{
+				if( scan_handle->number_of_completed_sources >= maximum_number_of_sources )
+				{
+					if( maximum_number_of_sources == 0 )
+					{
+						maximum_number_of_sources = 1024;
+					}
+					else if( maximum_number_of_sources < ( INT_MAX / 2 ) )
+					{
+						maximum_number_of_sources *= 2;
+					}
+					else
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid number of completed sources value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					completed_sources = (char **) memory_reallocate(
+					                               scan_handle->completed_sources,
+					                               sizeof( char * ) * maximum_number_of_sources );
+
+					if( completed_sources == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize completed sources.",
+						 function );
+
+						goto on_error;
+					}
+					scan_handle->completed_sources = completed_sources;
+				}
+				scan_handle->completed_sources[ scan_handle->number_of_completed_sources++ ] = pending_source;
+			}
+			else
+			{
+				memory_free(
+				 pending_source );
+			}
+			pending_source = NULL;
+		}
+	}
+	if( pending_source != NULL )
+	{
+		memory_free(
+		 pending_source );
+
+		pending_source = NULL;
+	}
+	if( scan_handle->number_of_completed_sources > 1 )
+	{
+		qsort(
+		 scan_handle->completed_sources,
+		 (size_t) scan_handle->number_of_completed_sources,
+		 sizeof( char * ),
+		 &scan_handle_compare_completed_sources );
+	}
+	return( 1 );
+
+on_error:
+	if( pending_source != NULL )
+	{
+		memory_free(
+		 pending_source );
+	}
+	return( -1 );
+}
+
+/* Determines if a source was completed by a previous scan
+ * Returns 1 if completed, 0 if not or -1 on error
+ */
+int scan_handle_is_completed_source(
+     scan_handle_t *scan_handle,
+     const char *escaped_source,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_is_completed_source";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( escaped_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid escaped source.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->number_of_completed_sources == 0 )
+	{
+		return( 0 );
+	}
+	if( bsearch(
+	     &escaped_source,
+	     scan_handle->completed_sources,
+	     (size_t) scan_handle->number_of_completed_sources,
+	     sizeof( char * ),
+	     &scan_handle_compare_completed_sources ) == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Starts the scan threads
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_start(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_start";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->scan_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - scan thread pool already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->number_of_threads > 1 )
+	{
+		/* The size of the queue bounds the number of sources that are pending
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( scan_handle->scan_thread_pool ),
+		     NULL,
+		     scan_handle->number_of_threads,
+		     scan_handle->number_of_threads * 2,
+		     (int (*)(intptr_t *, void *)) &scan_handle_scan_source_callback,
+		     (void *) scan_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Stops the scan threads after the pending sources have been scanned
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_stop(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_stop";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->scan_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( scan_handle->scan_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join scan thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Scans a path
+ * A directory is scanned recursively if directory support is available
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_path(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SCAN_HANDLE_DIRECTORY_SUPPORT )
+	struct stat file_statistics;
+
+	struct dirent *directory_entry = NULL;
+	DIR *directory                 = NULL;
+	char *entry_path               = NULL;
+	size_t entry_name_length       = 0;
+	size_t entry_path_size         = 0;
+	size_t path_length             = 0;
+#endif
+	static char *function          = "scan_handle_scan_path";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > SCAN_HANDLE_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_SCAN_HANDLE_DIRECTORY_SUPPORT )
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine file statistics of: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	if( S_ISDIR( file_statistics.st_mode ) )
+	{
+		directory = opendir(
+		             path );
+
+		if( directory == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open directory: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		path_length = narrow_string_length(
+		               path );
+
+		while( scan_handle->abort == 0 )
+		{
+			directory_entry = readdir(
+			                   directory );
+
+			if( directory_entry == NULL )
+			{
+				break;
+			}
+			if( ( narrow_string_compare(
+			       directory_entry->d_name,
+			       ".",
+			       2 ) == 0 )
+			 || ( narrow_string_compare(
+			       directory_entry->d_name,
+			       "..",
+			       3 ) == 0 ) )
+			{
+				continue;
+			}
+			entry_name_length = narrow_string_length(
+			                     directory_entry->d_name );
+
+			entry_path_size = path_length + entry_name_length + 2;
+
+			entry_path = narrow_string_allocate(
+			              entry_path_size );
+
+			if( entry_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entry path.",
+				 function );
+
+				goto on_error;
+			}
+			if( narrow_string_snprintf(
+			     entry_path,
+			     entry_path_size,
+			     "%s/%s",
+			     path,
+			     directory_entry->d_name ) < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entry path.",
+				 function );
+
+				goto on_error;
+			}
+			if( scan_handle_scan_path(
+			     scan_handle,
+			     entry_path,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan path: %s.",
+				 function,
+				 entry_path );
+
+				goto on_error;
+			}
+			memory_free(
+			 entry_path );
+
+			entry_path = NULL;
+		}
+		if( closedir(
+		     directory ) != 0 )
+		{
+			directory = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close directory: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* Only regular files and block devices can contain a volume system
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 && !S_ISBLK( file_statistics.st_mode ) )
+	{
+		return( 1 );
+	}
+#endif /* defined( HAVE_SCAN_HANDLE_DIRECTORY_SUPPORT ) */
+
+	if( scan_handle_push_source(
+	     scan_handle,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_SCAN_HANDLE_DIRECTORY_SUPPORT )
+on_error:
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	return( -1 );
+#endif
+}
+
+/* Scans the sources in a file, which contains a path per line
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_sources_file(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ 4096 ];
+
+	FILE *stream          = NULL;
+	static char *function = "scan_handle_scan_sources_file";
+	size_t line_length    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sources file.",
+		 function );
+
+		goto on_error;
+	}
+	while( scan_handle->abort == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     stream,
+		     line,
+		     4096 ) == NULL )
+#else
+		if( file_stream_get_string(
+		     stream,
+		     line,
+		     4096 ) == NULL )
+#endif
+		{
+			break;
+		}
+		line_length = system_string_length(
+		               line );
+
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		line[ line_length ] = 0;
+
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		if( scan_handle_scan_path(
+		     scan_handle,
+		     line,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan path: %" PRIs_SYSTEM ".",
+			 function,
+			 line );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close sources file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Pushes a source to be scanned
+ * The source is scanned directly if no scan threads are used
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_push_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	system_character_t *source_copy = NULL;
+	size_t source_size              = 0;
+#endif
+
+	char *escaped_source            = NULL;
+	static char *function           = "scan_handle_push_source";
+	int result                      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle_escape_source(
+	     source,
+	     &escaped_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to escape source.",
+		 function );
+
+		goto on_error;
+	}
+	result = scan_handle_is_completed_source(
+	          scan_handle,
+	          escaped_source,
+	          error );
+
+	memory_free(
+	 escaped_source );
+
+	escaped_source = NULL;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if source was completed.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		scan_handle->number_of_skipped_sources += 1;
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->scan_thread_pool != NULL )
+	{
+		source_size = system_string_length(
+		               source ) + 1;
+
+		source_copy = system_string_allocate(
+		               source_size );
+
+		if( source_copy == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source copy.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     source_copy,
+		     source,
+		     source_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source.",
+			 function );
+
+			goto on_error;
+		}
+		/* The push blocks while the queue is full, which bounds the number of pending sources
+		 */
+		if( libcthreads_thread_pool_push(
+		     scan_handle->scan_thread_pool,
+		     (intptr_t *) source_copy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push source onto scan thread pool queue.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( scan_handle_scan_source(
+	     scan_handle,
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan source.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( source_copy != NULL )
+	{
+		memory_free(
+		 source_copy );
+	}
+#endif
+	return( -1 );
+}
+
+/* Scans a source
+ * Callback function for the scan thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_source_callback(
+     system_character_t *source,
+     scan_handle_t *scan_handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 1;
+
+	if( source == NULL )
+	{
+		return( -1 );
+	}
+	if( scan_handle_scan_source(
+	     scan_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	memory_free(
+	 source );
+
+	return( result );
+}
+
+/* Scans a source and writes the resulting record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	scan_record_t scan_record;
+
+	libcerror_error_t *volume_error = NULL;
+	static char *function           = "scan_handle_scan_source";
+	int64_t start_time              = 0;
+	int result                      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sources that are not scanned because of an abort are not recorded
+	 */
+	if( scan_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &scan_record,
+	     0,
+	     sizeof( scan_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle_escape_source(
+	     source,
+	     &( scan_record.source ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to escape source.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = scan_handle_get_current_time();
+
+	result = scan_handle_read_volume(
+	          scan_handle,
+	          source,
+	          &scan_record,
+	          &volume_error );
+
+	scan_record.elapsed_time = scan_handle_get_current_time() - start_time;
+
+	if( result != 1 )
+	{
+		/* An error of an individual source is recorded and does not stop the scan
+		 */
+		if( volume_error != NULL )
+		{
+			libcnotify_print_error_backtrace(
+			 volume_error );
+			libcerror_error_free(
+			 &volume_error );
+		}
+		scan_record.status = SCAN_RECORD_STATUS_ERROR;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scan_handle->output_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab output mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = scan_handle_record_fprint(
+	          scan_handle,
+	          &scan_record,
+	          error );
+
+	scan_handle->number_of_scanned_sources += 1;
+
+	if( scan_record.status == SCAN_RECORD_STATUS_GPT )
+	{
+		scan_handle->number_of_gpt_volumes += 1;
+	}
+	else if( scan_record.status == SCAN_RECORD_STATUS_ERROR )
+	{
+		scan_handle->number_of_errors += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scan_handle->output_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release output mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print scan record.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record.partitions != NULL )
+	{
+		memory_free(
+		 scan_record.partitions );
+	}
+	memory_free(
+	 scan_record.source );
+
+	return( 1 );
+
+on_error:
+	if( scan_record.partitions != NULL )
+	{
+		memory_free(
+		 scan_record.partitions );
+	}
+	if( scan_record.source != NULL )
+	{
+		memory_free(
+		 scan_record.source );
+	}
+	return( -1 );
+}
+
+/* Reads the volume of a source into a scan record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_read_volume(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     scan_record_t *scan_record,
+     libcerror_error_t **error )
+{
+	libvsgpt_partition_t *partition = NULL;
+	libvsgpt_volume_t *volume       = NULL;
+	static char *function           = "scan_handle_read_volume";
+	int partition_index             = 0;
+	int result                      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	/* Checking the signature first is cheaper than opening the volume
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libvsgpt_check_volume_signature_wide(
+	          source,
+	          error );
+#else
+	result = libvsgpt_check_volume_signature(
+	          source,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check volume signature.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		scan_record->status = SCAN_RECORD_STATUS_NOT_GPT;
+
+		return( 1 );
+	}
+	if( libvsgpt_volume_initialize(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libvsgpt_volume_open_wide(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          error );
+#else
+	result = libvsgpt_volume_open(
+	          volume,
+	          source,
+	          LIBVSGPT_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libvsgpt_volume_is_corrupted(
+	          volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is corrupted.",
+		 function );
+
+		goto on_error;
+	}
+	scan_record->is_corrupted = (uint8_t) result;
+
+	if( libvsgpt_volume_get_disk_identifier(
+	     volume,
+	     scan_record->disk_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve disk identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_get_bytes_per_sector(
+	     volume,
+	     &( scan_record->bytes_per_sector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes per sector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_get_number_of_partitions(
+	     volume,
+	     &( scan_record->number_of_partitions ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record->number_of_partitions > 0 )
+	{
+		scan_record->partitions = (scan_partition_values_t *) memory_allocate(
+		                                                       sizeof( scan_partition_values_t ) * scan_record->number_of_partitions );
+
+		if( scan_record->partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < scan_record->number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsgpt_volume_get_partition_by_index(
+		     volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_entry_index(
+		     partition,
+		     &( scan_record->partitions[ partition_index ].entry_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d entry index.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_identifier(
+		     partition,
+		     scan_record->partitions[ partition_index ].identifier,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d identifier.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_type_identifier(
+		     partition,
+		     scan_record->partitions[ partition_index ].type_identifier,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d type identifier.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_volume_offset(
+		     partition,
+		     &( scan_record->partitions[ partition_index ].volume_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d volume offset.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_get_size(
+		     partition,
+		     &( scan_record->partitions[ partition_index ].size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d size.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsgpt_partition_free(
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	if( libvsgpt_volume_close(
+	     volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsgpt_volume_free(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		goto on_error;
+	}
+	scan_record->status = SCAN_RECORD_STATUS_GPT;
+
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsgpt_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsgpt_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( scan_record->partitions != NULL )
+	{
+		memory_free(
+		 scan_record->partitions );
+
+		scan_record->partitions = NULL;
+	}
+	scan_record->number_of_partitions = 0;
+
+	return( -1 );
+}
+
+/* Prints a scan record as a JSON Lines record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_record_fprint(
+     scan_handle_t *scan_handle,
+     scan_record_t *scan_record,
+     libcerror_error_t **error )
+{
+	const char *status_string = NULL;
+	static char *function     = "scan_handle_record_fprint";
+	int partition_index       = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan record - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	switch( scan_record->status )
+	{
+		case SCAN_RECORD_STATUS_GPT:
+			status_string = "gpt";
+			break;
+
+		case SCAN_RECORD_STATUS_NOT_GPT:
+			status_string = "not_gpt";
+			break;
+
+		default:
+			status_string = "error";
+			break;
+	}
+	fprintf(
+	 scan_handle->output_stream,
+	 "{\"source\": \"%s\", \"status\": \"%s\"",
+	 scan_record->source,
+	 status_string );
+
+	if( scan_record->status == SCAN_RECORD_STATUS_GPT )
+	{
+		if( scan_handle_guid_value_fprint(
+		     scan_handle,
+		     "disk_identifier",
+		     scan_record->disk_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print disk identifier.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 scan_handle->output_stream,
+		 ", \"bytes_per_sector\": %" PRIu32 ", \"is_corrupted\": %s, \"number_of_partitions\": %d, \"partitions\": [",
+		 scan_record->bytes_per_sector,
+		 ( scan_record->is_corrupted != 0 ) ? "true" : "false",
+		 scan_record->number_of_partitions );
+
+		for( partition_index = 0;
+		     partition_index < scan_record->number_of_partitions;
+		     partition_index++ )
+		{
+			if( partition_index > 0 )
+			{
+				fprintf(
+				 scan_handle->output_stream,
+				 ", " );
+			}
+			fprintf(
+			 scan_handle->output_stream,
+			 "{\"entry_index\": %" PRIu32 "",
+			 scan_record->partitions[ partition_index ].entry_index );
+
+			if( scan_handle_guid_value_fprint(
+			     scan_handle,
+			     "identifier",
+			     scan_record->partitions[ partition_index ].identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print partition: %d identifier.",
+				 function,
+				 partition_index );
+
+				return( -1 );
+			}
+			if( scan_handle_guid_value_fprint(
+			     scan_handle,
+			     "type_identifier",
+			     scan_record->partitions[ partition_index ].type_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print partition: %d type identifier.",
+				 function,
+				 partition_index );
+
+				return( -1 );
+			}
+			fprintf(
+			 scan_handle->output_stream,
+			 ", \"volume_offset\": %" PRIi64 ", \"size\": %" PRIu64 "}",
+			 scan_record->partitions[ partition_index ].volume_offset,
+			 scan_record->partitions[ partition_index ].size );
+		}
+		fprintf(
+		 scan_handle->output_stream,
+		 "]" );
+	}
+	fprintf(
+	 scan_handle->output_stream,
+	 ", \"elapsed_time\": %" PRIi64 "}\n",
+	 scan_record->elapsed_time );
+
+	/* Flush the record so that a resumed scan does not repeat it
+	 */
+	fflush(
+	 scan_handle->output_stream );
+
+	return( 1 );
+}
+
+/* Prints a GUID value as a JSON value
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_guid_value_fprint(
+     scan_handle_t *scan_handle,
+     const char *value_name,
+     const uint8_t *guid_data,
+     libcerror_error_t **error )
+{
+	uint8_t guid_string[ 48 ];
+
+	libfguid_identifier_t *guid = NULL;
+	static char *function       = "scan_handle_guid_value_fprint";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     guid,
+	     guid_data,
+	     16,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_to_utf8_string(
+	     guid,
+	     guid_string,
+	     48,
+	     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 scan_handle->output_stream,
+	 ", \"%s\": \"%s\"",
+	 value_name,
+	 (char *) guid_string );
+
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints a summary of the scan
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_summary_fprint(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_summary_fprint";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Scan summary:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of scanned sources\t: %d\n",
+	 scan_handle->number_of_scanned_sources );
+
+	fprintf(
+	 stream,
+	 "\tNumber of GPT volumes\t\t: %d\n",
+	 scan_handle->number_of_gpt_volumes );
+
+	fprintf(
+	 stream,
+	 "\tNumber of errors\t\t: %d\n",
+	 scan_handle->number_of_errors );
+
+	fprintf(
+	 stream,
+	 "\tNumber of skipped sources\t: %d\n",
+	 scan_handle->number_of_skipped_sources );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Escapes a source as a JSON string
+ * Characters outside the ASCII range of a wide character source are escaped as \u sequences
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_escape_source(
+     const system_character_t *source,
+     char **escaped_source,
+     libcerror_error_t **error )
+{
+	const char *hexadecimal_digits = "0123456789abcdef";
+	char *safe_escaped_source      = NULL;
+	static char *function          = "scan_handle_escape_source";
+	size_t escaped_source_index    = 0;
+	size_t source_index            = 0;
+	size_t source_length           = 0;
+	uint32_t character_value       = 0;
+	uint32_t escaped_value         = 0;
+	int escape_index               = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( escaped_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid escaped source.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+	/* An escaped character requires at most 12 bytes: a surrogate pair of \u sequences
+	 */
+	if( source_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_escaped_source = narrow_string_allocate(
+	                       ( source_length * 12 ) + 1 );
+
+	if( safe_escaped_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create escaped source.",
+		 function );
+
+		return( -1 );
+	}
+	for( source_index = 0;
+	     source_index < source_length;
+	     source_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		character_value = (uint32_t) source[ source_index ];
+#else
+		character_value = (uint8_t) source[ source_index ];
+#endif
+		if( ( character_value == (uint32_t) '"' )
+		 || ( character_value == (uint32_t) '\\' ) )
+		{
+			safe_escaped_source[ escaped_source_index++ ] = '\\';
+			safe_escaped_source[ escaped_source_index++ ] = (char) character_value;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		else if( ( character_value < 0x20 )
+		      || ( character_value >= 0x7f ) )
+#else
+		else if( ( character_value < 0x20 )
+		      || ( character_value == 0x7f ) )
+#endif
+		{
+			if( character_value > 0xffff )
+			{
+				/* Encode the character as an UTF-16 surrogate pair
+				 */
+				character_value -= 0x10000;
+				escaped_value    = 0xd800 + ( ( character_value >> 10 ) & 0x03ff );
+
+				safe_escaped_source[ escaped_source_index++ ] = '\\';
+				safe_escaped_source[ escaped_source_index++ ] = 'u';
+
+				for( escape_index = 12;
+				     escape_index >= 0;
+				     escape_index -= 4 )
+				{
+					safe_escaped_source[ escaped_source_index++ ] = hexadecimal_digits[ ( escaped_value >> escape_index ) & 0x0f ];
+				}
+				character_value = 0xdc00 + ( character_value & 0x03ff );
+			}
+			safe_escaped_source[ escaped_source_index++ ] = '\\';
+			safe_escaped_source[ escaped_source_index++ ] = 'u';
+
+			for( escape_index = 12;
+			     escape_index >= 0;
+			     escape_index -= 4 )
+			{
+				safe_escaped_source[ escaped_source_index++ ] = hexadecimal_digits[ ( character_value >> escape_index ) & 0x0f ];
+			}
+		}
+		else
+		{
+			/* A narrow source is expected to be UTF-8 encoded and is copied as-is
+			 */
+			safe_escaped_source[ escaped_source_index++ ] = (char) character_value;
+		}
+	}
+	safe_escaped_source[ escaped_source_index ] = 0;
+
+	*escaped_source = safe_escaped_source;
+
+	return( 1 );
+}
+
+/* Retrieves the current time in microseconds
+ * The time is only meaningful relative to another value retrieved by this function
+ * Returns the current time
+ */
+int64_t scan_handle_get_current_time(
+         void )
+{
+#if defined( WINAPI )
+	return( (int64_t) GetTickCount() * 1000 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+#else
+	return( (int64_t) time( NULL ) * 1000000 );
+#endif
+}
+
@@ -0,0 +1,288 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_HANDLE_H )
+#define _SCAN_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcthreads.h"
+#include "vsgpttools_libvsgpt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of scan threads
+ */
+#define SCAN_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+
+/* The maximum number of scan threads
+ */
+#define SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The maximum directory recursion depth
+ */
+#define SCAN_HANDLE_MAXIMUM_RECURSION_DEPTH		64
+
+enum SCAN_RECORD_STATUSES
+{
+	SCAN_RECORD_STATUS_ERROR			= -1,
+	SCAN_RECORD_STATUS_NOT_GPT			= 0,
+	SCAN_RECORD_STATUS_GPT				= 1
+};
+
+typedef struct scan_partition_values scan_partition_values_t;
+
+struct scan_partition_values
+{
+	/* The entry index
+	 */
+	uint32_t entry_index;
+
+	/* The identifier
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The type identifier
+	 */
+	uint8_t type_identifier[ 16 ];
+
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+typedef struct scan_record scan_record_t;
+
+struct scan_record
+{
+	/* The source as an escaped JSON string
+	 */
+	char *source;
+
+	/* The status
+	 */
+	int status;
+
+	/* The disk identifier
+	 */
+	uint8_t disk_identifier[ 16 ];
+
+	/* The bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* Value to indicate the volume is corrupted
+	 */
+	uint8_t is_corrupted;
+
+	/* The partitions values
+	 */
+	scan_partition_values_t *partitions;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The elapsed time in microseconds
+	 */
+	int64_t elapsed_time;
+};
+
+typedef struct scan_handle scan_handle_t;
+
+struct scan_handle
+{
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate the output stream was opened by the scan handle
+	 */
+	uint8_t output_stream_opened;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The sources that were completed by a previous scan, sorted
+	 */
+	char **completed_sources;
+
+	/* The number of completed sources
+	 */
+	int number_of_completed_sources;
+
+	/* The number of scan threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The scan thread pool
+	 */
+	libcthreads_thread_pool_t *scan_thread_pool;
+
+	/* The output mutex
+	 */
+	libcthreads_mutex_t *output_mutex;
+#endif
+
+	/* The number of scanned sources
+	 */
+	int number_of_scanned_sources;
+
+	/* The number of GPT volumes
+	 */
+	int number_of_gpt_volumes;
+
+	/* The number of sources that could not be scanned
+	 */
+	int number_of_errors;
+
+	/* The number of sources skipped since they were completed by a previous scan
+	 */
+	int number_of_skipped_sources;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int scan_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_open_output(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     uint8_t resume,
+     libcerror_error_t **error );
+
+int scan_handle_close_output(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_compare_completed_sources(
+     const void *first_source,
+     const void *second_source );
+
+int scan_handle_read_completed_sources(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     size64_t *records_data_size,
+     libcerror_error_t **error );
+
+int scan_handle_is_completed_source(
+     scan_handle_t *scan_handle,
+     const char *escaped_source,
+     libcerror_error_t **error );
+
+int scan_handle_start(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_stop(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_scan_path(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int scan_handle_scan_sources_file(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_push_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int scan_handle_scan_source_callback(
+     system_character_t *source,
+     scan_handle_t *scan_handle );
+
+int scan_handle_scan_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int scan_handle_read_volume(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     scan_record_t *scan_record,
+     libcerror_error_t **error );
+
+int scan_handle_record_fprint(
+     scan_handle_t *scan_handle,
+     scan_record_t *scan_record,
+     libcerror_error_t **error );
+
+int scan_handle_guid_value_fprint(
+     scan_handle_t *scan_handle,
+     const char *value_name,
+     const uint8_t *guid_data,
+     libcerror_error_t **error );
+
+int scan_handle_summary_fprint(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int scan_handle_escape_source(
+     const system_character_t *source,
+     char **escaped_source,
+     libcerror_error_t **error );
+
+int64_t scan_handle_get_current_time(
+         void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_HANDLE_H ) */
+
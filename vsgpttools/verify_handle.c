@@ -0,0 +1,2975 @@
+/*
+ * Verify handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "verify_handle.h"
+#include "vsgpttools_checksum.h"
+#include "vsgpttools_libbfio.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libcthreads.h"
+
+#define VERIFY_HANDLE_NOTIFY_STREAM	stdout
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define verify_handle_open_file( filename, mode ) \
+	file_stream_open_wide( filename, _SYSTEM_STRING( mode ) )
+#else
+#define verify_handle_open_file( filename, mode ) \
+	file_stream_open( filename, mode )
+#endif
+
+/* The prefix of a manifest line, which matches the CRC-32 output of vsgptexport
+ */
+#define VERIFY_HANDLE_MANIFEST_PREFIX		"CRC-32 of partition: "
+#define VERIFY_HANDLE_MANIFEST_PREFIX_LENGTH	21
+
+/* The descriptions of the check types
+ */
+const char *verify_handle_check_descriptions[ VERIFY_HANDLE_NUMBER_OF_CHECKS ] = {
+	"Protective MBR\t\t",
+	"Primary header\t\t",
+	"Primary entries\t\t",
+	"Backup header\t\t",
+	"Backup entries\t\t",
+	"Partition layout\t",
+	"Partition hashes\t" };
+
+/* Creates a verify handle
+ * Make sure the value verify_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_initialize";
+	int check_type        = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*verify_handle = memory_allocate_structure(
+	                  verify_handle_t );
+
+	if( *verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *verify_handle,
+	     0,
+	     sizeof( verify_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verify handle.",
+		 function );
+
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+
+		return( -1 );
+	}
+	/* The CRC-32 table is computed here since the table is not protected
+	 * against concurrent initialization
+	 */
+	if( vsgpttools_checksum_crc32_table_computed == 0 )
+	{
+		vsgpttools_checksum_initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	for( check_type = 0;
+	     check_type < VERIFY_HANDLE_NUMBER_OF_CHECKS;
+	     check_type++ )
+	{
+		( *verify_handle )->checks[ check_type ].type = check_type;
+	}
+	( *verify_handle )->notify_stream     = VERIFY_HANDLE_NOTIFY_STREAM;
+	( *verify_handle )->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Frees a verify handle
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_free";
+	int result            = 1;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *verify_handle )->check_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *verify_handle )->check_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join check thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *verify_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *verify_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( verify_handle_clear_volume_values(
+		     *verify_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear volume values.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *verify_handle )->manifest_entries != NULL )
+		{
+			memory_free(
+			 ( *verify_handle )->manifest_entries );
+		}
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( result );
+}
+
+/* Parses a number of threads from a string
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function      = "verify_handle_parse_number_of_threads";
+	size_t string_index        = 0;
+	int safe_number_of_threads = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported empty string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_number_of_threads *= 10;
+		safe_number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_number_of_threads > VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			break;
+		}
+	}
+	if( ( safe_number_of_threads <= 0 )
+	 || ( safe_number_of_threads > VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = safe_number_of_threads;
+
+	return( 1 );
+}
+
+/* Signals the verify handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_signal_abort";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "verify_handle_open_input";
+	size_t filename_length = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->input_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle - input file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     &( verify_handle->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     verify_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     verify_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     verify_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     verify_handle->input_file_io_handle,
+	     &( verify_handle->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( verify_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( verify_handle->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_close_input";
+	int result            = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->input_file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     verify_handle->input_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( verify_handle->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( verify_handle_clear_volume_values(
+	     verify_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear volume values.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Clears the values read from the volume
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_clear_volume_values(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_clear_volume_values";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->mbr_data != NULL )
+	{
+		memory_free(
+		 verify_handle->mbr_data );
+	}
+	if( verify_handle->primary_header.data != NULL )
+	{
+		memory_free(
+		 verify_handle->primary_header.data );
+	}
+	if( verify_handle->primary_header.entries_data != NULL )
+	{
+		memory_free(
+		 verify_handle->primary_header.entries_data );
+	}
+	if( verify_handle->backup_header.data != NULL )
+	{
+		memory_free(
+		 verify_handle->backup_header.data );
+	}
+	if( verify_handle->backup_header.entries_data != NULL )
+	{
+		memory_free(
+		 verify_handle->backup_header.entries_data );
+	}
+	if( verify_handle->partitions != NULL )
+	{
+		memory_free(
+		 verify_handle->partitions );
+	}
+	verify_handle->mbr_data             = NULL;
+	verify_handle->partitions           = NULL;
+	verify_handle->number_of_partitions = 0;
+
+	if( memory_set(
+	     &( verify_handle->primary_header ),
+	     0,
+	     sizeof( verify_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear primary header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( verify_handle->backup_header ),
+	     0,
+	     sizeof( verify_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear backup header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a manifest file
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_read_manifest(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "verify_handle_read_manifest";
+	int result            = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	stream = verify_handle_open_file(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = verify_handle_read_manifest_stream(
+	          verify_handle,
+	          stream,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close manifest.",
+			 function );
+		}
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads the manifest entries from a stream
+ * The manifest contains a line per partition in the same format as the CRC-32 output of vsgptexport:
+ * "CRC-32 of partition: <number>\t: 0x<crc32>", other lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_read_manifest_stream(
+     verify_handle_t *verify_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	char line[ 128 ];
+
+	verify_manifest_entry_t *manifest_entries = NULL;
+	static char *function                     = "verify_handle_read_manifest_stream";
+	size_t line_index                         = 0;
+	uint32_t crc32                            = 0;
+	int maximum_number_of_manifest_entries    = 0;
+	int number_of_digits                      = 0;
+	int partition_number                      = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_manifest_entries = verify_handle->number_of_manifest_entries;
+
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        128 ) != NULL )
+	{
+		if( narrow_string_compare(
+		     line,
+		     VERIFY_HANDLE_MANIFEST_PREFIX,
+		     VERIFY_HANDLE_MANIFEST_PREFIX_LENGTH ) != 0 )
+		{
+			continue;
+		}
+		line_index       = VERIFY_HANDLE_MANIFEST_PREFIX_LENGTH;
+		partition_number = 0;
+
+		while( ( line[ line_index ] >= '0' )
+		    && ( line[ line_index ] <= '9' )
+		    && ( partition_number <= (int) UINT16_MAX ) )
+		{
+			partition_number *= 10;
+			partition_number += (int) ( line[ line_index ] - '0' );
+
+			line_index++;
+		}
+		if( ( partition_number <= 0 )
+		 || ( partition_number > (int) UINT16_MAX ) )
+		{
+			continue;
+		}
+		while( ( line[ line_index ] == ' ' )
+		    || ( line[ line_index ] == '\t' )
+		    || ( line[ line_index ] == ':' ) )
+		{
+			line_index++;
+		}
+		if( ( line[ line_index ] != '0' )
+		 || ( line[ line_index + 1 ] != 'x' ) )
+		{
+			continue;
+		}
+		line_index += 2;
+
+		crc32 = 0;
+
+		for( number_of_digits = 0;
+		     number_of_digits < 8;
+		     number_of_digits++ )
+		{
+			crc32 <<= 4;
+
+			if( ( line[ line_index ] >= '0' )
+			 && ( line[ line_index ] <= '9' ) )
+			{
+				crc32 |= (uint32_t) ( line[ line_index ] - '0' );
+			}
+			else if( ( line[ line_index ] >= 'a' )
+			      && ( line[ line_index ] <= 'f' ) )
+			{
+				crc32 |= (uint32_t) ( line[ line_index ] - 'a' + 10 );
+			}
+			else if( ( line[ line_index ] >= 'A' )
+			      && ( line[ line_index ] <= 'F' ) )
+			{
+				crc32 |= (uint32_t) ( line[ line_index ] - 'A' + 10 );
+			}
+			else
+			{
+				break;
+			}
+			line_index++;
+		}
+		if( number_of_digits != 8 )
+		{
+			continue;
+		}
+		if( verify_handle->number_of_manifest_entries >= maximum_number_of_manifest_entries )
+		{
+			if( maximum_number_of_manifest_entries >= (int) UINT16_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of manifest entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			maximum_number_of_manifest_entries += 16;
+
+			manifest_entries = (verify_manifest_entry_t *) memory_reallocate(
+			                                                verify_handle->manifest_entries,
+			                                                sizeof( verify_manifest_entry_t ) * maximum_number_of_manifest_entries );
+
+			if( manifest_entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize manifest entries.",
+				 function );
+
+				return( -1 );
+			}
+			verify_handle->manifest_entries = manifest_entries;
+		}
+		verify_handle->manifest_entries[ verify_handle->number_of_manifest_entries ].partition_number = partition_number;
+		verify_handle->manifest_entries[ verify_handle->number_of_manifest_entries ].crc32            = crc32;
+
+		verify_handle->number_of_manifest_entries += 1;
+	}
+	return( 1 );
+}
+
+/* Reads data from the input at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_read_data(
+     verify_handle_t *verify_handle,
+     uint64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_read_data";
+	ssize_t read_count    = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              verify_handle->input_file_io_handle,
+	              data,
+	              data_size,
+	              (off64_t) offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses the values of a partition table header
+ * Returns 1 if successful, 0 if the data does not contain the signature or -1 on error
+ */
+int verify_handle_parse_header(
+     verify_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_parse_header";
+
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < VERIFY_HANDLE_MINIMUM_HEADER_DATA_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header->has_signature = 0;
+
+	if( memory_compare(
+	     data,
+	     "EFI PART",
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	header->has_signature = 1;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 header->header_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 header->header_data_checksum );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 header->header_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 32 ] ),
+	 header->backup_header_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 40 ] ),
+	 header->area_start_block_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 48 ] ),
+	 header->area_end_block_number );
+
+	if( memory_copy(
+	     header->disk_identifier,
+	     &( data[ 56 ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy disk identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 72 ] ),
+	 header->entries_start_block_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 80 ] ),
+	 header->number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 header->entry_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 88 ] ),
+	 header->entries_data_checksum );
+
+	return( 1 );
+}
+
+/* Reads the partition entries data of a partition table header
+ * Returns 1 if successful, 0 if the header does not describe readable partition entries or -1 on error
+ */
+int verify_handle_read_entries(
+     verify_handle_t *verify_handle,
+     verify_header_t *header,
+     libcerror_error_t **error )
+{
+	static char *function      = "verify_handle_read_entries";
+	uint64_t entries_data_size = 0;
+	uint64_t entries_offset    = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->entries_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid header - entries data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header->has_signature == 0 )
+	 || ( header->number_of_entries == 0 )
+	 || ( header->entry_data_size < VERIFY_HANDLE_MINIMUM_ENTRY_DATA_SIZE ) )
+	{
+		return( 0 );
+	}
+	entries_data_size = (uint64_t) header->number_of_entries * header->entry_data_size;
+
+	if( entries_data_size > VERIFY_HANDLE_MAXIMUM_ENTRIES_DATA_SIZE )
+	{
+		return( 0 );
+	}
+	if( header->entries_start_block_number > ( verify_handle->media_size / verify_handle->bytes_per_sector ) )
+	{
+		return( 0 );
+	}
+	entries_offset = header->entries_start_block_number * verify_handle->bytes_per_sector;
+
+	if( entries_data_size > ( verify_handle->media_size - entries_offset ) )
+	{
+		return( 0 );
+	}
+	header->entries_data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * (size_t) entries_data_size );
+
+	if( header->entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries data.",
+		 function );
+
+		return( -1 );
+	}
+	header->entries_data_size = (size_t) entries_data_size;
+
+	if( verify_handle_read_data(
+	     verify_handle,
+	     entries_offset,
+	     header->entries_data,
+	     header->entries_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries data.",
+		 function );
+
+		memory_free(
+		 header->entries_data );
+
+		header->entries_data      = NULL;
+		header->entries_data_size = 0;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses the partitions from the partition entries data of a partition table header
+ * The partitions are sorted by start block number
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_parse_partitions(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     libcerror_error_t **error )
+{
+	uint8_t empty_identifier[ 16 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	verify_partition_t *partition = NULL;
+	const uint8_t *entry_data     = NULL;
+	static char *function         = "verify_handle_parse_partitions";
+	size_t entry_offset           = 0;
+	uint64_t end_block_number     = 0;
+	uint64_t start_block_number   = 0;
+	uint32_t entry_index          = 0;
+	int partition_index           = 0;
+	int partition_number          = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->partitions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle - partitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header->entries_data == NULL )
+	 || ( header->number_of_entries == 0 )
+	 || ( header->entry_data_size < VERIFY_HANDLE_MINIMUM_ENTRY_DATA_SIZE )
+	 || ( header->entries_data_size < ( (size_t) header->number_of_entries * header->entry_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header - entries data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->partitions = (verify_partition_t *) memory_allocate(
+	                                                    sizeof( verify_partition_t ) * header->number_of_entries );
+
+	if( verify_handle->partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partitions.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->number_of_partitions = 0;
+
+	for( entry_index = 0;
+	     entry_index < header->number_of_entries;
+	     entry_index++ )
+	{
+		entry_data = &( header->entries_data[ entry_offset ] );
+
+		entry_offset += header->entry_data_size;
+
+		/* An entry with an empty partition type identifier is unused
+		 */
+		if( memory_compare(
+		     entry_data,
+		     empty_identifier,
+		     16 ) == 0 )
+		{
+			continue;
+		}
+		partition_number++;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_data[ 32 ] ),
+		 start_block_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_data[ 40 ] ),
+		 end_block_number );
+
+		/* Insert the partition sorted by start block number
+		 */
+		partition_index = verify_handle->number_of_partitions;
+
+		while( ( partition_index > 0 )
+		    && ( verify_handle->partitions[ partition_index - 1 ].start_block_number > start_block_number ) )
+		{
+			verify_handle->partitions[ partition_index ] = verify_handle->partitions[ partition_index - 1 ];
+
+			partition_index--;
+		}
+		partition = &( verify_handle->partitions[ partition_index ] );
+
+		partition->partition_number   = partition_number;
+		partition->start_block_number = start_block_number;
+		partition->end_block_number   = end_block_number;
+		partition->crc32              = 0;
+		partition->has_crc32          = 0;
+
+		verify_handle->number_of_partitions += 1;
+	}
+	return( 1 );
+}
+
+/* Checks the protective MBR
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_check_protective_mbr(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data                 = NULL;
+	static char *function                     = "verify_handle_check_protective_mbr";
+	uint64_t expected_number_of_sectors       = 0;
+	uint32_t number_of_sectors                = 0;
+	uint32_t start_sector                     = 0;
+	int entry_index                           = 0;
+	int number_of_other_entries               = 0;
+	int number_of_protective_entries          = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_FAILED;
+
+	if( ( verify_handle->mbr_data == NULL )
+	 || ( verify_handle->bytes_per_sector == 0 ) )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "MBR not available" );
+
+		return( 1 );
+	}
+	if( ( verify_handle->mbr_data[ 510 ] != 0x55 )
+	 || ( verify_handle->mbr_data[ 511 ] != 0xaa ) )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "missing boot signature" );
+
+		return( 1 );
+	}
+	/* The protective partition covers the volume after the MBR or
+	 * as much of it as can be represented
+	 */
+	expected_number_of_sectors = ( verify_handle->media_size / verify_handle->bytes_per_sector ) - 1;
+
+	if( expected_number_of_sectors > (uint64_t) UINT32_MAX )
+	{
+		expected_number_of_sectors = (uint64_t) UINT32_MAX;
+	}
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		entry_data = &( verify_handle->mbr_data[ 446 + ( entry_index * 16 ) ] );
+
+		if( entry_data[ 4 ] == 0x00 )
+		{
+			continue;
+		}
+		if( entry_data[ 4 ] != 0xee )
+		{
+			number_of_other_entries++;
+
+			continue;
+		}
+		number_of_protective_entries++;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 8 ] ),
+		 start_sector );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 12 ] ),
+		 number_of_sectors );
+
+		if( start_sector != 1 )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "protective partition starts at sector: %" PRIu32 " instead of 1",
+			 start_sector );
+
+			return( 1 );
+		}
+		if( ( (uint64_t) number_of_sectors != expected_number_of_sectors )
+		 && ( number_of_sectors != UINT32_MAX ) )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "protective partition size: %" PRIu32 " sectors does not match volume size: %" PRIu64 " sectors",
+			 number_of_sectors,
+			 expected_number_of_sectors );
+
+			return( 1 );
+		}
+	}
+	if( number_of_protective_entries == 0 )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "missing protective partition entry" );
+
+		return( 1 );
+	}
+	if( number_of_protective_entries > 1 )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "multiple protective partition entries" );
+
+		return( 1 );
+	}
+	if( number_of_other_entries != 0 )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "hybrid MBR with %d other partition entries",
+		 number_of_other_entries );
+
+		return( 1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_PASSED;
+
+	return( 1 );
+}
+
+/* Checks a partition table header
+ * If primary header is not NULL, the header is the backup and is compared with the primary header
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_check_header(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     const verify_header_t *primary_header,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	uint8_t empty_checksum[ 4 ] = {
+		0, 0, 0, 0 };
+
+	const char *mismatch        = NULL;
+	static char *function       = "verify_handle_check_header";
+	uint64_t number_of_blocks   = 0;
+	uint32_t calculated_checksum = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_FAILED;
+
+	if( ( header->data == NULL )
+	 || ( header->has_signature == 0 )
+	 || ( verify_handle->bytes_per_sector == 0 ) )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "missing signature" );
+
+		return( 1 );
+	}
+	if( ( header->header_data_size < VERIFY_HANDLE_MINIMUM_HEADER_DATA_SIZE )
+	 || ( header->header_data_size > verify_handle->bytes_per_sector ) )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "unsupported header data size: %" PRIu32 "",
+		 header->header_data_size );
+
+		return( 1 );
+	}
+	/* The checksum is calculated with the checksum value itself set to 0
+	 */
+	if( vsgpttools_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     header->data,
+	     16,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsgpttools_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     empty_checksum,
+	     4,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsgpttools_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     &( header->data[ 20 ] ),
+	     header->header_data_size - 20,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->header_data_checksum != calculated_checksum )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "mismatch in header checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " )",
+		 header->header_data_checksum,
+		 calculated_checksum );
+
+		return( 1 );
+	}
+	if( header->header_block_number != header->block_number )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "header block number: %" PRIu64 " does not match location: %" PRIu64 "",
+		 header->header_block_number,
+		 header->block_number );
+
+		return( 1 );
+	}
+	number_of_blocks = verify_handle->media_size / verify_handle->bytes_per_sector;
+
+	if( header->backup_header_block_number >= number_of_blocks )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "backup header block number: %" PRIu64 " out of bounds",
+		 header->backup_header_block_number );
+
+		return( 1 );
+	}
+	if( ( header->area_start_block_number > header->area_end_block_number )
+	 || ( header->area_end_block_number >= number_of_blocks ) )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "partition area: %" PRIu64 " - %" PRIu64 " out of bounds",
+		 header->area_start_block_number,
+		 header->area_end_block_number );
+
+		return( 1 );
+	}
+	if( ( primary_header != NULL )
+	 && ( primary_header->has_signature != 0 ) )
+	{
+		if( memory_compare(
+		     header->disk_identifier,
+		     primary_header->disk_identifier,
+		     16 ) != 0 )
+		{
+			mismatch = "disk identifier";
+		}
+		else if( ( header->area_start_block_number != primary_header->area_start_block_number )
+		      || ( header->area_end_block_number != primary_header->area_end_block_number ) )
+		{
+			mismatch = "partition area";
+		}
+		else if( ( header->number_of_entries != primary_header->number_of_entries )
+		      || ( header->entry_data_size != primary_header->entry_data_size ) )
+		{
+			mismatch = "partition entries size";
+		}
+		else if( header->entries_data_checksum != primary_header->entries_data_checksum )
+		{
+			mismatch = "partition entries checksum";
+		}
+		else if( ( header->header_block_number != primary_header->backup_header_block_number )
+		      || ( header->backup_header_block_number != primary_header->header_block_number ) )
+		{
+			mismatch = "header block numbers";
+		}
+		if( mismatch != NULL )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "mismatch in %s with primary header",
+			 mismatch );
+
+			return( 1 );
+		}
+	}
+	check->status = VERIFY_CHECK_STATUS_PASSED;
+
+	return( 1 );
+}
+
+/* Checks the partition entries of a partition table header
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_check_entries(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	static char *function        = "verify_handle_check_entries";
+	uint32_t calculated_checksum = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_FAILED;
+
+	if( header->has_signature == 0 )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "header not available" );
+
+		return( 1 );
+	}
+	if( header->entries_data == NULL )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "unsupported partition entries location or size" );
+
+		return( 1 );
+	}
+	if( vsgpttools_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     header->entries_data,
+	     header->entries_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate entries checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->entries_data_checksum != calculated_checksum )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "mismatch in partition entries checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " )",
+		 header->entries_data_checksum,
+		 calculated_checksum );
+
+		return( 1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_PASSED;
+
+	return( 1 );
+}
+
+/* Checks if the partitions are within the partition area and do not overlap
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_check_partition_layout(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	const verify_header_t *header         = NULL;
+	const verify_partition_t *partition   = NULL;
+	static char *function                 = "verify_handle_check_partition_layout";
+	uint64_t maximum_end_block_number     = 0;
+	int maximum_end_partition_number      = 0;
+	int partition_index                   = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_FAILED;
+
+	/* The partitions are parsed from the primary partition entries if available
+	 */
+	if( verify_handle->primary_header.entries_data != NULL )
+	{
+		header = &( verify_handle->primary_header );
+	}
+	else
+	{
+		header = &( verify_handle->backup_header );
+	}
+	if( verify_handle->partitions == NULL )
+	{
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "partition entries not available" );
+
+		return( 1 );
+	}
+	for( partition_index = 0;
+	     partition_index < verify_handle->number_of_partitions;
+	     partition_index++ )
+	{
+		partition = &( verify_handle->partitions[ partition_index ] );
+
+		if( partition->start_block_number > partition->end_block_number )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "partition: %d start block number exceeds end block number",
+			 partition->partition_number );
+
+			return( 1 );
+		}
+		if( ( partition->start_block_number < header->area_start_block_number )
+		 || ( partition->end_block_number > header->area_end_block_number ) )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "partition: %d outside of partition area",
+			 partition->partition_number );
+
+			return( 1 );
+		}
+		/* The partitions are sorted by start block number
+		 */
+		if( ( partition_index > 0 )
+		 && ( partition->start_block_number <= maximum_end_block_number ) )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "partitions: %d and %d overlap",
+			 maximum_end_partition_number,
+			 partition->partition_number );
+
+			return( 1 );
+		}
+		if( ( partition_index == 0 )
+		 || ( partition->end_block_number > maximum_end_block_number ) )
+		{
+			maximum_end_block_number     = partition->end_block_number;
+			maximum_end_partition_number = partition->partition_number;
+		}
+	}
+	check->status = VERIFY_CHECK_STATUS_PASSED;
+
+	return( 1 );
+}
+
+/* Checks the CRC-32 of the partition data against the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_check_partition_hashes(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	verify_manifest_entry_t *manifest_entry = NULL;
+	verify_partition_t *partition           = NULL;
+	static char *function                   = "verify_handle_check_partition_hashes";
+	int manifest_entry_index                = 0;
+	int partition_index                     = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->number_of_manifest_entries == 0 )
+	{
+		check->status = VERIFY_CHECK_STATUS_NOT_RUN;
+
+		return( 1 );
+	}
+	check->status = VERIFY_CHECK_STATUS_FAILED;
+
+	for( manifest_entry_index = 0;
+	     manifest_entry_index < verify_handle->number_of_manifest_entries;
+	     manifest_entry_index++ )
+	{
+		manifest_entry = &( verify_handle->manifest_entries[ manifest_entry_index ] );
+		partition      = NULL;
+
+		for( partition_index = 0;
+		     partition_index < verify_handle->number_of_partitions;
+		     partition_index++ )
+		{
+			if( verify_handle->partitions[ partition_index ].partition_number == manifest_entry->partition_number )
+			{
+				partition = &( verify_handle->partitions[ partition_index ] );
+
+				break;
+			}
+		}
+		if( partition == NULL )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "partition: %d in manifest not found",
+			 manifest_entry->partition_number );
+
+			return( 1 );
+		}
+		if( partition->has_crc32 == 0 )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "partition: %d CRC-32 not calculated",
+			 manifest_entry->partition_number );
+
+			return( 1 );
+		}
+		if( partition->crc32 != manifest_entry->crc32 )
+		{
+			narrow_string_snprintf(
+			 check->message,
+			 128,
+			 "mismatch in partition: %d CRC-32 ( 0x%08" PRIx32 " != 0x%08" PRIx32 " )",
+			 manifest_entry->partition_number,
+			 manifest_entry->crc32,
+			 partition->crc32 );
+
+			return( 1 );
+		}
+	}
+	check->status = VERIFY_CHECK_STATUS_PASSED;
+
+	return( 1 );
+}
+
+/* Runs a check
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_run_check(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_run_check";
+	int result            = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	switch( check->type )
+	{
+		case VERIFY_CHECK_TYPE_PROTECTIVE_MBR:
+			result = verify_handle_check_protective_mbr(
+			          verify_handle,
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_PRIMARY_HEADER:
+			result = verify_handle_check_header(
+			          verify_handle,
+			          &( verify_handle->primary_header ),
+			          NULL,
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_PRIMARY_ENTRIES:
+			result = verify_handle_check_entries(
+			          verify_handle,
+			          &( verify_handle->primary_header ),
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_BACKUP_HEADER:
+			result = verify_handle_check_header(
+			          verify_handle,
+			          &( verify_handle->backup_header ),
+			          &( verify_handle->primary_header ),
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_BACKUP_ENTRIES:
+			result = verify_handle_check_entries(
+			          verify_handle,
+			          &( verify_handle->backup_header ),
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_PARTITION_LAYOUT:
+			result = verify_handle_check_partition_layout(
+			          verify_handle,
+			          check,
+			          error );
+			break;
+
+		case VERIFY_CHECK_TYPE_PARTITION_HASHES:
+			result = verify_handle_check_partition_hashes(
+			          verify_handle,
+			          check,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported check type: %d.",
+			 function,
+			 check->type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run check: %d.",
+		 function,
+		 check->type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs a check
+ * Callback function for the check thread pool
+ * A check that could not be run is marked as failed
+ * Returns 1
+ */
+int verify_handle_run_check_callback(
+     verify_check_t *check,
+     verify_handle_t *verify_handle )
+{
+	libcerror_error_t *error = NULL;
+
+	if( check == NULL )
+	{
+		return( 1 );
+	}
+	if( verify_handle_run_check(
+	     verify_handle,
+	     check,
+	     &error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		check->status = VERIFY_CHECK_STATUS_FAILED;
+
+		narrow_string_snprintf(
+		 check->message,
+		 128,
+		 "unable to run check" );
+	}
+	return( 1 );
+}
+
+/* Pushes a check onto the check thread pool or runs it if there is no thread pool
+ * The check must only depend on values that are no longer changed
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_push_check(
+     verify_handle_t *verify_handle,
+     int check_type,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_push_check";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( check_type < 0 )
+	 || ( check_type >= VERIFY_HANDLE_NUMBER_OF_CHECKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid check type value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->check_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     verify_handle->check_thread_pool,
+		     (intptr_t *) &( verify_handle->checks[ check_type ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push check: %d onto check thread pool queue.",
+			 function,
+			 check_type );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	verify_handle_run_check_callback(
+	 &( verify_handle->checks[ check_type ] ),
+	 verify_handle );
+
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of the data of the partitions
+ * The partitions are read in order of their start block number
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int verify_handle_calculate_partition_crc32s(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	verify_partition_t *partition = NULL;
+	uint8_t *buffer               = NULL;
+	static char *function         = "verify_handle_calculate_partition_crc32s";
+	size64_t remaining_size       = 0;
+	size_t read_size              = 0;
+	uint64_t number_of_blocks     = 0;
+	uint64_t offset               = 0;
+	uint32_t crc32                = 0;
+	int partition_index           = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * VERIFY_HANDLE_READ_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_blocks = verify_handle->media_size / verify_handle->bytes_per_sector;
+
+	for( partition_index = 0;
+	     partition_index < verify_handle->number_of_partitions;
+	     partition_index++ )
+	{
+		partition = &( verify_handle->partitions[ partition_index ] );
+
+		partition->has_crc32 = 0;
+
+		/* Partitions that are not within the volume are reported by the partition layout check
+		 */
+		if( ( partition->start_block_number > partition->end_block_number )
+		 || ( partition->end_block_number >= number_of_blocks ) )
+		{
+			continue;
+		}
+		offset         = partition->start_block_number * verify_handle->bytes_per_sector;
+		remaining_size = ( partition->end_block_number - partition->start_block_number + 1 ) * verify_handle->bytes_per_sector;
+		crc32          = 0;
+
+		while( remaining_size > 0 )
+		{
+			if( verify_handle->abort != 0 )
+			{
+				memory_free(
+				 buffer );
+
+				return( 0 );
+			}
+			read_size = VERIFY_HANDLE_READ_SIZE;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			if( verify_handle_read_data(
+			     verify_handle,
+			     offset,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of partition: %d.",
+				 function,
+				 partition->partition_number );
+
+				goto on_error;
+			}
+			if( vsgpttools_checksum_calculate_crc32(
+			     &crc32,
+			     buffer,
+			     read_size,
+			     crc32,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate CRC-32 of partition: %d.",
+				 function,
+				 partition->partition_number );
+
+				goto on_error;
+			}
+			offset         += read_size;
+			remaining_size -= read_size;
+		}
+		partition->crc32     = crc32;
+		partition->has_crc32 = 1;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Reads a partition table header at a specific block
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_read_header(
+     verify_handle_t *verify_handle,
+     verify_header_t *header,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_read_header";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->bytes_per_sector < VERIFY_HANDLE_MINIMUM_HEADER_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid verify handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid header - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= ( verify_handle->media_size / verify_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * verify_handle->bytes_per_sector );
+
+	if( header->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create header data.",
+		 function );
+
+		return( -1 );
+	}
+	header->block_number = block_number;
+
+	if( verify_handle_read_data(
+	     verify_handle,
+	     block_number * verify_handle->bytes_per_sector,
+	     header->data,
+	     verify_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle_parse_header(
+	     header,
+	     header->data,
+	     verify_handle->bytes_per_sector,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse header.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->has_signature != 0 )
+	{
+		if( verify_handle_read_entries(
+		     verify_handle,
+		     header,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Verifies the input
+ * The volume is read front to back: the MBR and primary partition table,
+ * the partition data if hashes are needed and the backup partition table last.
+ * The checks run on the check thread pool while reading continues.
+ * Returns 1 if all checks passed, 0 if a check failed or verification was aborted or -1 on error
+ */
+int verify_handle_verify(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	uint8_t start_data[ VERIFY_HANDLE_START_DATA_SIZE ];
+
+	static char *function        = "verify_handle_verify";
+	size_t start_data_size       = 0;
+	uint64_t backup_block_number = 0;
+	uint64_t number_of_blocks    = 0;
+	uint32_t bytes_per_sector    = 0;
+	int check_type               = 0;
+	int result                   = 1;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->input_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->media_size < 1024 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported media size: %" PRIu64 ".",
+		 function,
+		 verify_handle->media_size );
+
+		return( -1 );
+	}
+	if( verify_handle_clear_volume_values(
+	     verify_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear volume values.",
+		 function );
+
+		return( -1 );
+	}
+	for( check_type = 0;
+	     check_type < VERIFY_HANDLE_NUMBER_OF_CHECKS;
+	     check_type++ )
+	{
+		verify_handle->checks[ check_type ].status       = VERIFY_CHECK_STATUS_NOT_RUN;
+		verify_handle->checks[ check_type ].message[ 0 ] = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( verify_handle->check_thread_pool ),
+		     NULL,
+		     verify_handle->number_of_threads,
+		     VERIFY_HANDLE_NUMBER_OF_CHECKS,
+		     (int (*)(intptr_t *, void *)) &verify_handle_run_check_callback,
+		     (void *) verify_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create check thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	start_data_size = VERIFY_HANDLE_START_DATA_SIZE;
+
+	if( (size64_t) start_data_size > verify_handle->media_size )
+	{
+		start_data_size = (size_t) verify_handle->media_size;
+	}
+	if( verify_handle_read_data(
+	     verify_handle,
+	     0,
+	     start_data,
+	     start_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read start data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The primary partition table header is stored in the second block,
+	 * the supported sector sizes are: 512, 1024, 2048 and 4096
+	 */
+	verify_handle->bytes_per_sector = 512;
+
+	for( bytes_per_sector = 512;
+	     bytes_per_sector <= 4096;
+	     bytes_per_sector *= 2 )
+	{
+		if( ( start_data_size >= (size_t) ( bytes_per_sector + VERIFY_HANDLE_MINIMUM_HEADER_DATA_SIZE ) )
+		 && ( verify_handle->media_size >= (size64_t) ( 3 * bytes_per_sector ) )
+		 && ( memory_compare(
+		       &( start_data[ bytes_per_sector ] ),
+		       "EFI PART",
+		       8 ) == 0 ) )
+		{
+			verify_handle->bytes_per_sector = bytes_per_sector;
+
+			break;
+		}
+	}
+	number_of_blocks = verify_handle->media_size / verify_handle->bytes_per_sector;
+
+	verify_handle->mbr_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * 512 );
+
+	if( verify_handle->mbr_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MBR data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     verify_handle->mbr_data,
+	     start_data,
+	     512 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy MBR data.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle_push_check(
+	     verify_handle,
+	     VERIFY_CHECK_TYPE_PROTECTIVE_MBR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to push protective MBR check.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle_read_header(
+	     verify_handle,
+	     &( verify_handle->primary_header ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read primary header.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle_push_check(
+	     verify_handle,
+	     VERIFY_CHECK_TYPE_PRIMARY_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to push primary header check.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle_push_check(
+	     verify_handle,
+	     VERIFY_CHECK_TYPE_PRIMARY_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to push primary entries check.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle->primary_header.entries_data != NULL )
+	{
+		if( verify_handle_parse_partitions(
+		     verify_handle,
+		     &( verify_handle->primary_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse primary partition entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The partition data is read before the backup partition table so that
+	 * the volume is read front to back
+	 */
+	if( ( verify_handle->partitions != NULL )
+	 && ( ( verify_handle->calculate_crc32 != 0 )
+	  || ( verify_handle->number_of_manifest_entries > 0 ) ) )
+	{
+		result = verify_handle_calculate_partition_crc32s(
+		          verify_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate partition CRC-32s.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		backup_block_number = number_of_blocks - 1;
+
+		if( ( verify_handle->primary_header.has_signature != 0 )
+		 && ( verify_handle->primary_header.backup_header_block_number > 1 )
+		 && ( verify_handle->primary_header.backup_header_block_number < number_of_blocks ) )
+		{
+			backup_block_number = verify_handle->primary_header.backup_header_block_number;
+		}
+		if( verify_handle_read_header(
+		     verify_handle,
+		     &( verify_handle->backup_header ),
+		     backup_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read backup header.",
+			 function );
+
+			goto on_error;
+		}
+		/* Fall back to the backup partition entries if the primary are not usable
+		 */
+		if( ( verify_handle->partitions == NULL )
+		 && ( verify_handle->backup_header.entries_data != NULL ) )
+		{
+			if( verify_handle_parse_partitions(
+			     verify_handle,
+			     &( verify_handle->backup_header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse backup partition entries.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( verify_handle->calculate_crc32 != 0 )
+			 || ( verify_handle->number_of_manifest_entries > 0 ) )
+			{
+				result = verify_handle_calculate_partition_crc32s(
+				          verify_handle,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to calculate partition CRC-32s.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		for( check_type = VERIFY_CHECK_TYPE_BACKUP_HEADER;
+		     check_type <= VERIFY_CHECK_TYPE_PARTITION_LAYOUT;
+		     check_type++ )
+		{
+			if( verify_handle_push_check(
+			     verify_handle,
+			     check_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to push check: %d.",
+				 function,
+				 check_type );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->check_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( verify_handle->check_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join check thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( ( result == 0 )
+	 || ( verify_handle->abort != 0 ) )
+	{
+		return( 0 );
+	}
+	if( verify_handle_run_check(
+	     verify_handle,
+	     &( verify_handle->checks[ VERIFY_CHECK_TYPE_PARTITION_HASHES ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run partition hashes check.",
+		 function );
+
+		goto on_error;
+	}
+	for( check_type = 0;
+	     check_type < VERIFY_HANDLE_NUMBER_OF_CHECKS;
+	     check_type++ )
+	{
+		if( verify_handle->checks[ check_type ].status == VERIFY_CHECK_STATUS_FAILED )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->check_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( verify_handle->check_thread_pool ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the verification results
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_results_fprint(
+     verify_handle_t *verify_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	verify_check_t *check         = NULL;
+	verify_partition_t *partition = NULL;
+	static char *function         = "verify_handle_results_fprint";
+	int check_type                = 0;
+	int partition_index           = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The CRC-32 lines are printed in the format of the manifest
+	 */
+	if( verify_handle->calculate_crc32 != 0 )
+	{
+		for( partition_index = 0;
+		     partition_index < verify_handle->number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( verify_handle->partitions[ partition_index ] );
+
+			if( partition->has_crc32 != 0 )
+			{
+				fprintf(
+				 stream,
+				 "%s%d\t: 0x%08" PRIx32 "\n",
+				 VERIFY_HANDLE_MANIFEST_PREFIX,
+				 partition->partition_number,
+				 partition->crc32 );
+			}
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	fprintf(
+	 stream,
+	 "Verification results:\n" );
+
+	for( check_type = 0;
+	     check_type < VERIFY_HANDLE_NUMBER_OF_CHECKS;
+	     check_type++ )
+	{
+		check = &( verify_handle->checks[ check_type ] );
+
+		fprintf(
+		 stream,
+		 "\t%s: ",
+		 verify_handle_check_descriptions[ check_type ] );
+
+		switch( check->status )
+		{
+			case VERIFY_CHECK_STATUS_PASSED:
+				fprintf(
+				 stream,
+				 "OK\n" );
+				break;
+
+			case VERIFY_CHECK_STATUS_FAILED:
+				fprintf(
+				 stream,
+				 "FAILED: %s\n",
+				 check->message );
+				break;
+
+			default:
+				fprintf(
+				 stream,
+				 "N/A\n" );
+				break;
+		}
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
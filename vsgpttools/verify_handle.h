@@ -0,0 +1,417 @@
+/*
+ * Verify handle
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFY_HANDLE_H )
+#define _VERIFY_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsgpttools_libbfio.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of check threads
+ */
+#define VERIFY_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+
+/* The maximum number of check threads
+ */
+#define VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The size of the data that is read at once when calculating partition hashes
+ */
+#define VERIFY_HANDLE_READ_SIZE				( 4 * 1024 * 1024 )
+
+/* The size of the data at the start of the source that is read at once
+ * It contains the protective MBR and the partition table header for 512 and 4096 bytes per sector
+ */
+#define VERIFY_HANDLE_START_DATA_SIZE			8192
+
+/* The minimum size of the partition table header data
+ */
+#define VERIFY_HANDLE_MINIMUM_HEADER_DATA_SIZE		92
+
+/* The minimum size of a partition entry
+ */
+#define VERIFY_HANDLE_MINIMUM_ENTRY_DATA_SIZE		128
+
+/* The maximum size of the partition entries data
+ */
+#define VERIFY_HANDLE_MAXIMUM_ENTRIES_DATA_SIZE		( 16 * 1024 * 1024 )
+
+/* The check types, in the order the results are printed
+ */
+enum VERIFY_CHECK_TYPES
+{
+	VERIFY_CHECK_TYPE_PROTECTIVE_MBR		= 0,
+	VERIFY_CHECK_TYPE_PRIMARY_HEADER		= 1,
+	VERIFY_CHECK_TYPE_PRIMARY_ENTRIES		= 2,
+	VERIFY_CHECK_TYPE_BACKUP_HEADER			= 3,
+	VERIFY_CHECK_TYPE_BACKUP_ENTRIES		= 4,
+	VERIFY_CHECK_TYPE_PARTITION_LAYOUT		= 5,
+	VERIFY_CHECK_TYPE_PARTITION_HASHES		= 6
+};
+
+/* The number of check types
+ */
+#define VERIFY_HANDLE_NUMBER_OF_CHECKS			7
+
+/* The check statuses
+ */
+enum VERIFY_CHECK_STATUSES
+{
+	VERIFY_CHECK_STATUS_NOT_RUN			= 0,
+	VERIFY_CHECK_STATUS_PASSED			= 1,
+	VERIFY_CHECK_STATUS_FAILED			= 2
+};
+
+typedef struct verify_check verify_check_t;
+
+struct verify_check
+{
+	/* The check type
+	 */
+	int type;
+
+	/* The check status
+	 */
+	int status;
+
+	/* The message that describes the first problem found
+	 */
+	char message[ 128 ];
+};
+
+typedef struct verify_header verify_header_t;
+
+struct verify_header
+{
+	/* The sector data that contains the header
+	 */
+	uint8_t *data;
+
+	/* The block number of the sector that contains the header
+	 */
+	uint64_t block_number;
+
+	/* Value to indicate the sector contains the signature
+	 */
+	uint8_t has_signature;
+
+	/* The header data size
+	 */
+	uint32_t header_data_size;
+
+	/* The stored header data checksum
+	 */
+	uint32_t header_data_checksum;
+
+	/* The header block number stored in the header
+	 */
+	uint64_t header_block_number;
+
+	/* The backup header block number
+	 */
+	uint64_t backup_header_block_number;
+
+	/* The partition area start block number
+	 */
+	uint64_t area_start_block_number;
+
+	/* The partition area end block number
+	 */
+	uint64_t area_end_block_number;
+
+	/* The disk identifier
+	 */
+	uint8_t disk_identifier[ 16 ];
+
+	/* The partition entries start block number
+	 */
+	uint64_t entries_start_block_number;
+
+	/* The number of partition entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The partition entry data size
+	 */
+	uint32_t entry_data_size;
+
+	/* The stored partition entries data checksum
+	 */
+	uint32_t entries_data_checksum;
+
+	/* The partition entries data
+	 */
+	uint8_t *entries_data;
+
+	/* The partition entries data size
+	 */
+	size_t entries_data_size;
+};
+
+typedef struct verify_partition verify_partition_t;
+
+struct verify_partition
+{
+	/* The partition number, which is the 1-based index of the used partition entries
+	 */
+	int partition_number;
+
+	/* The partition start block number
+	 */
+	uint64_t start_block_number;
+
+	/* The partition end block number
+	 */
+	uint64_t end_block_number;
+
+	/* The CRC-32 of the partition data
+	 */
+	uint32_t crc32;
+
+	/* Value to indicate the CRC-32 was calculated
+	 */
+	uint8_t has_crc32;
+};
+
+typedef struct verify_manifest_entry verify_manifest_entry_t;
+
+struct verify_manifest_entry
+{
+	/* The partition number
+	 */
+	int partition_number;
+
+	/* The expected CRC-32 of the partition data
+	 */
+	uint32_t crc32;
+};
+
+typedef struct verify_handle verify_handle_t;
+
+struct verify_handle
+{
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The protective MBR data
+	 */
+	uint8_t *mbr_data;
+
+	/* The primary partition table header
+	 */
+	verify_header_t primary_header;
+
+	/* The backup partition table header
+	 */
+	verify_header_t backup_header;
+
+	/* The partitions, sorted by start block number
+	 */
+	verify_partition_t *partitions;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The manifest entries
+	 */
+	verify_manifest_entry_t *manifest_entries;
+
+	/* The number of manifest entries
+	 */
+	int number_of_manifest_entries;
+
+	/* Value to indicate the CRC-32 of the partition data should be calculated
+	 */
+	uint8_t calculate_crc32;
+
+	/* The checks
+	 */
+	verify_check_t checks[ VERIFY_HANDLE_NUMBER_OF_CHECKS ];
+
+	/* The number of check threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The check thread pool
+	 */
+	libcthreads_thread_pool_t *check_thread_pool;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_parse_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_clear_volume_values(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_read_manifest(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_read_manifest_stream(
+     verify_handle_t *verify_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int verify_handle_read_data(
+     verify_handle_t *verify_handle,
+     uint64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int verify_handle_parse_header(
+     verify_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int verify_handle_parse_partitions(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     libcerror_error_t **error );
+
+int verify_handle_read_entries(
+     verify_handle_t *verify_handle,
+     verify_header_t *header,
+     libcerror_error_t **error );
+
+int verify_handle_check_protective_mbr(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_check_header(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     const verify_header_t *primary_header,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_check_entries(
+     verify_handle_t *verify_handle,
+     const verify_header_t *header,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_check_partition_layout(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_check_partition_hashes(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_run_check(
+     verify_handle_t *verify_handle,
+     verify_check_t *check,
+     libcerror_error_t **error );
+
+int verify_handle_run_check_callback(
+     verify_check_t *check,
+     verify_handle_t *verify_handle );
+
+int verify_handle_push_check(
+     verify_handle_t *verify_handle,
+     int check_type,
+     libcerror_error_t **error );
+
+int verify_handle_calculate_partition_crc32s(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_read_header(
+     verify_handle_t *verify_handle,
+     verify_header_t *header,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int verify_handle_verify(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_results_fprint(
+     verify_handle_t *verify_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFY_HANDLE_H ) */
+
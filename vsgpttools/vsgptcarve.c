@@ -0,0 +1,383 @@
+/*
+ * Scans for GUID Partition Table (GPT) partition table headers.
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "carve_handle.h"
+#include "vsgpttools_getopt.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_output.h"
+#include "vsgpttools_signal.h"
+#include "vsgpttools_unused.h"
+
+carve_handle_t *vsgptcarve_carve_handle = NULL;
+int vsgptcarve_abort                     = 0;
+
+/* Signal handler for vsgptcarve
+ */
+void vsgptcarve_signal_handler(
+      vsgpttools_signal_t signal VSGPTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsgptcarve_signal_handler";
+
+	VSGPTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsgptcarve_abort = 1;
+
+	if( vsgptcarve_carve_handle != NULL )
+	{
+		if( carve_handle_signal_abort(
+		     vsgptcarve_carve_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal carve handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsgptcarve to scan a source for GUID Partition Table (GPT) partition table headers.\n"
+		"Every header with a valid checksum is printed with its offset, implied sector size\n"
+		"and disk identifier, which is useful when the start of a disk was overwritten.";
+
+	vsgpttools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'o', "offset", "the offset to start scanning at, decimal or hexadecimal with a 0x prefix, default is 0" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file or device" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	system_character_t *option_offset = NULL;
+	system_character_t *source        = NULL;
+	char *program                     = "vsgptcarve";
+	system_integer_t option           = 0;
+	off64_t start_offset              = 0;
+	int number_of_options             = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int result                        = 0;
+	int verbose                       = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsgpttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsgpttools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsgpttools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsgpttools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsgpttools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_offset != NULL )
+	{
+		if( carve_handle_parse_offset(
+		     option_offset,
+		     &start_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported offset: %" PRIs_SYSTEM ".\n",
+			 option_offset );
+
+			goto on_error;
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( carve_handle_initialize(
+	     &vsgptcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize carve handle.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_signal_attach(
+	     vsgptcarve_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle_open_input(
+	     vsgptcarve_carve_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = carve_handle_carve(
+	          vsgptcarve_carve_handle,
+	          start_offset,
+	          stdout,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to scan for partition table headers.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptcarve_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	else if( carve_handle_summary_fprint(
+	          vsgptcarve_carve_handle,
+	          stdout,
+	          &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print summary.\n" );
+
+		goto on_error;
+	}
+	if( carve_handle_close_input(
+	     vsgptcarve_carve_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input.\n" );
+
+		goto on_error;
+	}
+	if( carve_handle_free(
+	     &vsgptcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free carve handle.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: FAILURE\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "%s: SUCCESS\n",
+	 program );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptcarve_carve_handle != NULL )
+	{
+		carve_handle_close_input(
+		 vsgptcarve_carve_handle,
+		 NULL );
+		carve_handle_free(
+		 &vsgptcarve_carve_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
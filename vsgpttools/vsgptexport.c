@@ -0,0 +1,444 @@
+/*
+ * Exports the partitions of a GUID Partition Table (GPT) volume system.
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "vsgpttools_getopt.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libvsgpt.h"
+#include "vsgpttools_output.h"
+#include "vsgpttools_signal.h"
+#include "vsgpttools_unused.h"
+
+export_handle_t *vsgptexport_export_handle = NULL;
+int vsgptexport_abort                      = 0;
+
+/* Signal handler for vsgptexport
+ */
+void vsgptexport_signal_handler(
+      vsgpttools_signal_t signal VSGPTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsgptexport_signal_handler";
+
+	VSGPTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsgptexport_abort = 1;
+
+	if( vsgptexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     vsgptexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsgptexport to export the partitions of a GUID Partition Table (GPT) volume system.\n"
+		"Chunks that only contain 0-byte values are written as holes in a sparse file.";
+
+	vsgpttools_option_t options[ ] = {
+		{ 'c', NULL, "calculate a CRC-32 of the exported data" },
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of read threads, default is 4" },
+		{ 'p', "partition", "the partition to export, either a number or all, default is all" },
+		{ 'r', NULL, "resume an interrupted export from its checkpoint" },
+		{ 't', "target", "the target file, if all partitions are exported .p and the partition number are appended" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file or device" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvsgpt_error_t *error                       = NULL;
+	system_character_t *option_number_of_threads  = NULL;
+	system_character_t *option_partition_number   = NULL;
+	system_character_t *option_target             = NULL;
+	system_character_t *source                    = NULL;
+	char *program                                 = "vsgptexport";
+	system_integer_t option                       = 0;
+	uint8_t calculate_crc32                       = 0;
+	uint8_t resume                                = 0;
+	int number_of_options                         = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int number_of_threads                         = EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	int partition_number                          = 0;
+	int result                                    = 0;
+	int verbose                                   = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsgpttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsgpttools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsgpttools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsgpttools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				calculate_crc32 = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_partition_number = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsgpttools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_target == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_number_of_threads != NULL )
+	{
+		if( export_handle_parse_number_of_threads(
+		     option_number_of_threads,
+		     &number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+	}
+	if( option_partition_number != NULL )
+	{
+		if( export_handle_parse_partition_number(
+		     option_partition_number,
+		     &partition_number,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported partition: %" PRIs_SYSTEM ".\n",
+			 option_partition_number );
+
+			goto on_error;
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libvsgpt_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvsgpt_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &vsgptexport_export_handle,
+	     number_of_threads,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vsgptexport_export_handle != NULL );
+#endif
+	vsgptexport_export_handle->calculate_crc32 = calculate_crc32;
+	vsgptexport_export_handle->resume          = resume;
+
+	if( vsgpttools_signal_attach(
+	     vsgptexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_open_input(
+	     vsgptexport_export_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = export_handle_export_partitions(
+	          vsgptexport_export_handle,
+	          partition_number,
+	          option_target,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export partitions.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	if( export_handle_summary_fprint(
+	     vsgptexport_export_handle,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print export summary.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_close_input(
+	     vsgptexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &vsgptexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptexport_export_handle != NULL )
+	{
+		export_handle_close_input(
+		 vsgptexport_export_handle,
+		 NULL );
+		export_handle_free(
+		 &vsgptexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
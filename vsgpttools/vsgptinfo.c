@@ -40,6 +40,7 @@
 #include <unistd.h>
 #endif
 
+#include "benchmark_handle.h"
 #include "info_handle.h"
 #include "vsgpttools_getopt.h"
 #include "vsgpttools_libcerror.h"
@@ -50,8 +51,9 @@
 #include "vsgpttools_signal.h"
 #include "vsgpttools_unused.h"
 
-info_handle_t *vsgptinfo_info_handle = NULL;
-int vsgptinfo_abort                  = 0;
+benchmark_handle_t *vsgptinfo_benchmark_handle = NULL;
+info_handle_t *vsgptinfo_info_handle           = NULL;
+int vsgptinfo_abort                            = 0;
 
 /* Signal handler for vsgptinfo
  */
@@ -81,6 +83,22 @@ void vsgptinfo_signal_handler(
 			 &error );
 		}
 	}
+	if( vsgptinfo_benchmark_handle != NULL )
+	{
+		if( benchmark_handle_signal_abort(
+		     vsgptinfo_benchmark_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal benchmark handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -109,19 +127,29 @@ int main( int argc, char * const argv[] )
 		"Use vsgptinfo to determine information about a GUID Partition Table (GPT) volume system.";
 
 	vsgpttools_option_t options[ ] = {
+		{ 'b', NULL, "benchmark the read throughput of the partitions instead of printing information" },
+		{ 'f', "file_list", "process the sources listed in a file, one per line, use - for stdin" },
 		{ 'h', NULL, "shows this help" },
+		{ 'o', "format", "output format, options: text (default), json, jsonl, csv" },
+		{ 't', NULL, "trace the reads done when opening the source image" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source image" },
+		{ 0, "source", "the source image, optional if a file list is provided" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libvsgpt_error_t *error    = NULL;
-	system_character_t *source = NULL;
-	char *program              = "vsgptinfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
-	int verbose                = 0;
+	libvsgpt_error_t *error                   = NULL;
+	system_character_t *option_file_list      = NULL;
+	system_character_t *option_output_format  = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "vsgptinfo";
+	FILE *file_list_stream                    = NULL;
+	system_integer_t option                   = 0;
+	int number_of_options                     = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int benchmark                             = 0;
+	int result                                = 0;
+	int trace_io                              = 0;
+	int verbose                               = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -154,10 +182,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	vsgpttools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( vsgpttools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -179,6 +203,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				vsgpttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -193,7 +221,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				benchmark = 1;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_file_list = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
+				vsgpttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				vsgpttools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -203,20 +245,39 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				trace_io = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				vsgpttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				vsgpttools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( option_file_list == NULL ) )
 	{
+		vsgpttools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source image.\n" );
@@ -230,8 +291,20 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( ( benchmark != 0 )
+	 && ( ( source == NULL )
+	  ||  ( option_file_list != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Benchmark requires a single source image.\n" );
 
+		return( EXIT_FAILURE );
+	}
 	libcnotify_verbose_set(
 	 verbose );
 	libvsgpt_notify_set_stream(
@@ -253,36 +326,204 @@ int main( int argc, char * const argv[] )
 #if defined( __clang_analyzer__ )
 	__builtin_assume( vsgptinfo_info_handle != NULL );
 #endif
-	if( info_handle_open_input(
-	     vsgptinfo_info_handle,
-	     source,
-	     &error ) != 1 )
+	vsgptinfo_info_handle->trace_io = trace_io;
+
+	if( option_output_format != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open source image.\n" );
+		result = info_handle_set_output_format(
+		          vsgptinfo_info_handle,
+		          option_output_format,
+		          &error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format.\n" );
+
+			goto on_error;
+		}
 	}
-	if( info_handle_partitions_fprint(
-	     vsgptinfo_info_handle,
-	     &error ) != 1 )
+	if( vsgptinfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to print partitions information.\n" );
+		vsgpttools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( benchmark != 0 )
+	{
+		if( vsgptinfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format for benchmark.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( benchmark_handle_initialize(
+		     &vsgptinfo_benchmark_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize benchmark handle.\n" );
+
+			goto on_error;
+		}
+#if defined( __clang_analyzer__ )
+		__builtin_assume( vsgptinfo_benchmark_handle != NULL );
+#endif
+		if( vsgptinfo_info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+		{
+			vsgptinfo_benchmark_handle->output_json = 1;
+		}
+		if( benchmark_handle_open_input(
+		     vsgptinfo_benchmark_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source image.\n" );
+
+			goto on_error;
+		}
+		result = benchmark_handle_benchmark_partitions(
+		          vsgptinfo_benchmark_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark partitions.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Benchmark aborted.\n" );
+		}
+		if( benchmark_handle_close_input(
+		     vsgptinfo_benchmark_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close benchmark handle.\n" );
+
+			goto on_error;
+		}
+		if( benchmark_handle_free(
+		     &vsgptinfo_benchmark_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free benchmark handle.\n" );
+
+			goto on_error;
+		}
 	}
-	if( info_handle_close_input(
-	     vsgptinfo_info_handle,
-	     &error ) != 0 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to close info handle.\n" );
+		if( info_handle_output_header_write(
+		     vsgptinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write output header.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = 1;
+
+		if( source != NULL )
+		{
+			if( info_handle_process_source(
+			     vsgptinfo_info_handle,
+			     source,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to process source image.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_file_list != NULL )
+		{
+			if( system_string_compare(
+			     option_file_list,
+			     _SYSTEM_STRING( "-" ),
+			     2 ) == 0 )
+			{
+				file_list_stream = stdin;
+			}
+			else
+			{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				file_list_stream = file_stream_open_wide(
+				                    option_file_list,
+				                    _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+				file_list_stream = file_stream_open(
+				                    option_file_list,
+				                    FILE_STREAM_OPEN_READ );
+#endif
+			}
+			if( file_list_stream == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open file list: %" PRIs_SYSTEM ".\n",
+				 option_file_list );
+
+				goto on_error;
+			}
+			result = info_handle_process_file_list_stream(
+			          vsgptinfo_info_handle,
+			          file_list_stream,
+			          &error );
+
+			if( file_list_stream != stdin )
+			{
+				file_stream_close(
+				 file_list_stream );
+			}
+			file_list_stream = NULL;
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to process file list.\n" );
+
+				goto on_error;
+			}
+		}
+		if( info_handle_output_footer_write(
+		     vsgptinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write output footer.\n" );
+
+			goto on_error;
+		}
 	}
 	if( info_handle_free(
 	     &vsgptinfo_info_handle,
@@ -294,6 +535,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -304,6 +549,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( vsgptinfo_benchmark_handle != NULL )
+	{
+		benchmark_handle_free(
+		 &vsgptinfo_benchmark_handle,
+		 NULL );
+	}
 	if( vsgptinfo_info_handle != NULL )
 	{
 		info_handle_free(
@@ -0,0 +1,501 @@
+/*
+ * Mounts a GUID Partition Table (GPT) volume system.
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mount_fuse.h"
+#include "mount_handle.h"
+#include "vsgpttools_getopt.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libvsgpt.h"
+#include "vsgpttools_output.h"
+#include "vsgpttools_signal.h"
+#include "vsgpttools_unused.h"
+
+mount_handle_t *vsgptmount_mount_handle = NULL;
+int vsgptmount_abort                    = 0;
+
+/* Signal handler for vsgptmount
+ */
+void vsgptmount_signal_handler(
+      vsgpttools_signal_t signal VSGPTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsgptmount_signal_handler";
+
+	VSGPTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsgptmount_abort = 1;
+
+	if( vsgptmount_mount_handle != NULL )
+	{
+		if( mount_handle_signal_abort(
+		     vsgptmount_mount_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal mount handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+	if( close(
+	     0 ) != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsgptmount to mount the partitions of a GUID Partition Table (GPT) volume system.";
+
+	vsgpttools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr, while vsgptmount will remain running in the foreground" },
+		{ 'V', NULL, "print version" },
+		{ 'X', "extended_options", "extended options to pass to sub system" },
+		{ 0, "source", "the source image" },
+		{ 0, "mount_point", "the directory to serve as mount point" },
+	};
+	system_character_t options_string[ 32 ];
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	struct fuse_operations vsgptmount_fuse_operations;
+
+	struct fuse_args vsgptmount_fuse_arguments   = FUSE_ARGS_INIT(0, NULL);
+	struct fuse *vsgptmount_fuse_handle          = NULL;
+
+#if !defined( HAVE_LIBFUSE3 )
+	struct fuse_chan *vsgptmount_fuse_channel    = NULL;
+#endif
+	int result                                   = 0;
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) */
+
+	libvsgpt_error_t *error                      = NULL;
+	system_character_t *mount_point              = NULL;
+	system_character_t *option_extended_options  = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "vsgptmount";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsgpttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsgpttools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsgpttools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsgpttools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsgpttools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'X':
+				option_extended_options = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source image.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind++ ];
+
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing mount point.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	mount_point = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libvsgpt_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvsgpt_notify_set_verbose(
+	 verbose );
+
+	if( vsgpttools_signal_attach(
+	     vsgptmount_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( mount_handle_initialize(
+	     &vsgptmount_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mount handle.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_open(
+	     vsgptmount_mount_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source image\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	if( option_extended_options != NULL )
+	{
+		/* This argument is required but ignored
+		 */
+		if( fuse_opt_add_arg(
+		     &vsgptmount_fuse_arguments,
+		     "" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &vsgptmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &vsgptmount_fuse_arguments,
+		     option_extended_options ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( memory_set(
+	     &vsgptmount_fuse_operations,
+	     0,
+	     sizeof( struct fuse_operations ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear fuse operations.\n" );
+
+		goto on_error;
+	}
+	vsgptmount_fuse_operations.open       = &mount_fuse_open;
+	vsgptmount_fuse_operations.read       = &mount_fuse_read;
+	vsgptmount_fuse_operations.release    = &mount_fuse_release;
+	vsgptmount_fuse_operations.opendir    = &mount_fuse_opendir;
+	vsgptmount_fuse_operations.readdir    = &mount_fuse_readdir;
+	vsgptmount_fuse_operations.releasedir = &mount_fuse_releasedir;
+	vsgptmount_fuse_operations.getattr    = &mount_fuse_getattr;
+	vsgptmount_fuse_operations.destroy    = &mount_fuse_destroy;
+
+#if defined( HAVE_LIBFUSE3 )
+	vsgptmount_fuse_handle = fuse_new(
+	                          &vsgptmount_fuse_arguments,
+	                          &vsgptmount_fuse_operations,
+	                          sizeof( struct fuse_operations ),
+	                          vsgptmount_mount_handle );
+
+	if( vsgptmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+	result = fuse_mount(
+	          vsgptmount_fuse_handle,
+	          mount_point );
+
+	if( result != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to fuse mount file system.\n" );
+
+		goto on_error;
+	}
+#else
+	vsgptmount_fuse_channel = fuse_mount(
+	                           mount_point,
+	                           &vsgptmount_fuse_arguments );
+
+	if( vsgptmount_fuse_channel == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse channel.\n" );
+
+		goto on_error;
+	}
+	vsgptmount_fuse_handle = fuse_new(
+	                          vsgptmount_fuse_channel,
+	                          &vsgptmount_fuse_arguments,
+	                          &vsgptmount_fuse_operations,
+	                          sizeof( struct fuse_operations ),
+	                          vsgptmount_mount_handle );
+
+	if( vsgptmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
+	if( verbose == 0 )
+	{
+		if( fuse_daemonize(
+		     0 ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to daemonize fuse.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The partitions are read by multiple fuse threads concurrently
+	 * the file entries are safe to share between the threads
+	 */
+#if defined( HAVE_LIBFUSE3 )
+	result = fuse_loop_mt(
+	          vsgptmount_fuse_handle,
+	          0 );
+#else
+	result = fuse_loop_mt(
+	          vsgptmount_fuse_handle );
+#endif
+	if( result != 0 )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE3 )
+	fuse_unmount(
+	 vsgptmount_fuse_handle );
+#else
+	fuse_unmount(
+	 mount_point,
+	 vsgptmount_fuse_channel );
+#endif
+	/* The mount handle is freed by mount_fuse_destroy
+	 */
+	fuse_destroy(
+	 vsgptmount_fuse_handle );
+
+	fuse_opt_free_args(
+	 &vsgptmount_fuse_arguments );
+
+	return( EXIT_SUCCESS );
+
+#else
+	fprintf(
+	 stderr,
+	 "No sub system to mount VSGPT format.\n" );
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	if( vsgptmount_fuse_handle != NULL )
+	{
+		fuse_destroy(
+		 vsgptmount_fuse_handle );
+	}
+#if !defined( HAVE_LIBFUSE3 )
+	else if( vsgptmount_fuse_channel != NULL )
+	{
+		fuse_unmount(
+		 mount_point,
+		 vsgptmount_fuse_channel );
+	}
+#endif
+	fuse_opt_free_args(
+	 &vsgptmount_fuse_arguments );
+#endif
+	if( vsgptmount_mount_handle != NULL )
+	{
+		mount_handle_free(
+		 &vsgptmount_mount_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
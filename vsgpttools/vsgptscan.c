@@ -0,0 +1,441 @@
+/*
+ * Scans sources for GUID Partition Table (GPT) volume systems.
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "scan_handle.h"
+#include "vsgpttools_getopt.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_libvsgpt.h"
+#include "vsgpttools_output.h"
+#include "vsgpttools_signal.h"
+#include "vsgpttools_unused.h"
+
+scan_handle_t *vsgptscan_scan_handle = NULL;
+int vsgptscan_abort                  = 0;
+
+/* Signal handler for vsgptscan
+ */
+void vsgptscan_signal_handler(
+      vsgpttools_signal_t signal VSGPTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsgptscan_signal_handler";
+
+	VSGPTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsgptscan_abort = 1;
+
+	if( vsgptscan_scan_handle != NULL )
+	{
+		if( scan_handle_signal_abort(
+		     vsgptscan_scan_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal scan handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsgptscan to scan sources for GUID Partition Table (GPT) volume systems.\n"
+		"The results are written as JSON Lines, one record per source.";
+
+	vsgpttools_option_t options[ ] = {
+		{ 'f', "file", "read the sources from a file that contains a source per line" },
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of scan threads, default is 4" },
+		{ 'o', "file", "write the records to a file instead of stdout" },
+		{ 'r', NULL, "resume a previous scan, sources in the output file without an error are skipped" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source image, device or directory" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvsgpt_error_t *error                      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_output_filename   = NULL;
+	system_character_t *option_sources_filename  = NULL;
+	char *program                                = "vsgptscan";
+	system_integer_t option                      = 0;
+	uint8_t resume                               = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int number_of_threads                        = SCAN_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsgpttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The version is printed to stderr so that stdout only contains records
+	 */
+	vsgpttools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( vsgpttools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsgpttools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsgpttools_getopt_usage_fprint(
+				 stderr,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				option_sources_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsgpttools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 && ( option_sources_filename == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stderr,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_number_of_threads != NULL )
+	{
+		if( scan_handle_parse_number_of_threads(
+		     option_number_of_threads,
+		     &number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libvsgpt_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvsgpt_notify_set_verbose(
+	 verbose );
+
+	if( scan_handle_initialize(
+	     &vsgptscan_scan_handle,
+	     number_of_threads,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize scan handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vsgptscan_scan_handle != NULL );
+#endif
+	if( vsgpttools_signal_attach(
+	     vsgptscan_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle_open_output(
+	     vsgptscan_scan_handle,
+	     option_output_filename,
+	     resume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open output.\n" );
+
+		goto on_error;
+	}
+	if( scan_handle_start(
+	     vsgptscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to start scan.\n" );
+
+		goto on_error;
+	}
+	if( option_sources_filename != NULL )
+	{
+		if( scan_handle_scan_sources_file(
+		     vsgptscan_scan_handle,
+		     option_sources_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan sources in file: %" PRIs_SYSTEM ".\n",
+			 option_sources_filename );
+
+			goto on_error;
+		}
+	}
+	while( ( optind < argc )
+	    && ( vsgptscan_abort == 0 ) )
+	{
+		if( scan_handle_scan_path(
+		     vsgptscan_scan_handle,
+		     argv[ optind ],
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan source: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	if( scan_handle_stop(
+	     vsgptscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to stop scan.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptscan_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	if( scan_handle_summary_fprint(
+	     vsgptscan_scan_handle,
+	     stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print scan summary.\n" );
+
+		goto on_error;
+	}
+	if( scan_handle_close_output(
+	     vsgptscan_scan_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close output.\n" );
+
+		goto on_error;
+	}
+	if( scan_handle_free(
+	     &vsgptscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scan handle.\n" );
+
+		goto on_error;
+	}
+	if( vsgptscan_abort != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptscan_scan_handle != NULL )
+	{
+		scan_handle_close_output(
+		 vsgptscan_scan_handle,
+		 NULL );
+		scan_handle_free(
+		 &vsgptscan_scan_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
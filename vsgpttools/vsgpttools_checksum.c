@@ -0,0 +1,137 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "vsgpttools_checksum.h"
+#include "vsgpttools_libcerror.h"
+
+/* Table of CRC-32 values of 8-bit values
+ */
+uint32_t vsgpttools_checksum_crc32_table[ 256 ];
+
+/* Value to indicate the CRC-32 table been computed
+ */
+int vsgpttools_checksum_crc32_table_computed = 0;
+
+/* Initializes the CRC-32 table
+ * The table speeds up the CRC-32 calculation
+ */
+void vsgpttools_checksum_initialize_crc32_table(
+      uint32_t polynomial )
+{
+	uint32_t checksum    = 0;
+	uint32_t table_index = 0;
+	uint8_t bit_iterator = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		checksum = (uint32_t) table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( checksum & 1 )
+			{
+				checksum = polynomial ^ ( checksum >> 1 );
+			}
+			else
+			{
+				checksum = checksum >> 1;
+			}
+		}
+		vsgpttools_checksum_crc32_table[ table_index ] = checksum;
+	}
+	vsgpttools_checksum_crc32_table_computed = 1;
+}
+
+/* Calculates the CRC-32 of data
+ * Returns 1 if successful or -1 on error
+ */
+int vsgpttools_checksum_calculate_crc32(
+     uint32_t *crc32,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "vsgpttools_checksum_calculate_crc32";
+	size_t data_offset    = 0;
+	uint32_t safe_crc32   = 0;
+	uint32_t table_index  = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsgpttools_checksum_crc32_table_computed == 0 )
+	{
+		vsgpttools_checksum_initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		table_index = ( safe_crc32 ^ data[ data_offset ] ) & 0x000000ffUL;
+
+		safe_crc32 = vsgpttools_checksum_crc32_table[ table_index ] ^ ( safe_crc32 >> 8 );
+	}
+	*crc32 = safe_crc32 ^ 0xffffffffUL;
+
+	return( 1 );
+}
+
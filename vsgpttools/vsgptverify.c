@@ -0,0 +1,416 @@
+/*
+ * Verifies the integrity of a GUID Partition Table (GPT) volume system.
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "verify_handle.h"
+#include "vsgpttools_getopt.h"
+#include "vsgpttools_libcerror.h"
+#include "vsgpttools_libclocale.h"
+#include "vsgpttools_libcnotify.h"
+#include "vsgpttools_output.h"
+#include "vsgpttools_signal.h"
+#include "vsgpttools_unused.h"
+
+verify_handle_t *vsgptverify_verify_handle = NULL;
+int vsgptverify_abort                      = 0;
+
+/* Signal handler for vsgptverify
+ */
+void vsgptverify_signal_handler(
+      vsgpttools_signal_t signal VSGPTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsgptverify_signal_handler";
+
+	VSGPTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsgptverify_abort = 1;
+
+	if( vsgptverify_verify_handle != NULL )
+	{
+		if( verify_handle_signal_abort(
+		     vsgptverify_verify_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal verify handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsgptverify to verify the integrity of a GUID Partition Table (GPT) volume system.\n"
+		"The protective MBR, the primary and backup partition table headers and entries\n"
+		"and the partition layout are checked and optionally the partition data against a manifest.";
+
+	vsgpttools_option_t options[ ] = {
+		{ 'c', NULL, "calculate and print a CRC-32 of the data of every partition" },
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of check threads, default is 4" },
+		{ 'm', "manifest", "the manifest with the expected partition CRC-32s, such as the output of vsgptexport -c" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file or device" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libcerror_error_t *error                      = NULL;
+	system_character_t *option_manifest           = NULL;
+	system_character_t *option_number_of_threads  = NULL;
+	system_character_t *source                    = NULL;
+	char *program                                 = "vsgptverify";
+	system_integer_t option                       = 0;
+	uint8_t calculate_crc32                       = 0;
+	int number_of_options                         = (int) ( sizeof( options ) / sizeof( vsgpttools_option_t ) );
+	int number_of_threads                         = VERIFY_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	int result                                    = 0;
+	int verbose                                   = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsgpttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsgpttools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsgpttools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsgpttools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				calculate_crc32 = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vsgpttools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_manifest = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsgpttools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		vsgpttools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_number_of_threads != NULL )
+	{
+		if( verify_handle_parse_number_of_threads(
+		     option_number_of_threads,
+		     &number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( verify_handle_initialize(
+	     &vsgptverify_verify_handle,
+	     number_of_threads,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize verify handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vsgptverify_verify_handle != NULL );
+#endif
+	vsgptverify_verify_handle->calculate_crc32 = calculate_crc32;
+
+	if( option_manifest != NULL )
+	{
+		if( verify_handle_read_manifest(
+		     vsgptverify_verify_handle,
+		     option_manifest,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read manifest: %" PRIs_SYSTEM ".\n",
+			 option_manifest );
+
+			goto on_error;
+		}
+	}
+	if( vsgpttools_signal_attach(
+	     vsgptverify_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle_open_input(
+	     vsgptverify_verify_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = verify_handle_verify(
+	          vsgptverify_verify_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to verify.\n" );
+
+		goto on_error;
+	}
+	if( vsgpttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptverify_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+	}
+	else if( verify_handle_results_fprint(
+	          vsgptverify_verify_handle,
+	          stdout,
+	          &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print verification results.\n" );
+
+		goto on_error;
+	}
+	if( verify_handle_close_input(
+	     vsgptverify_verify_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input.\n" );
+
+		goto on_error;
+	}
+	if( verify_handle_free(
+	     &vsgptverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free verify handle.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: FAILURE\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "%s: SUCCESS\n",
+	 program );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsgptverify_verify_handle != NULL )
+	{
+		verify_handle_close_input(
+		 vsgptverify_verify_handle,
+		 NULL );
+		verify_handle_free(
+		 &vsgptverify_verify_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+